@@ -0,0 +1,44 @@
+#ifndef __ALLOCATION_COUNTER_HPP__
+#define __ALLOCATION_COUNTER_HPP__
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/**
+ * @brief Counts calls to the global operator new and the bytes they
+ * request.
+ *
+ * The header replaces the global allocation functions, so it must be
+ * included by exactly one translation unit of a benchmark executable.
+ */
+namespace bench {
+inline std::size_t allocation_count = 0;
+inline std::size_t allocated_bytes = 0;
+} // namespace bench
+
+// The replacements pair malloc with free, which GCC cannot see through once
+// they are inlined into callers.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void *operator new(std::size_t size) {
+  ++bench::allocation_count;
+  bench::allocated_bytes += size;
+  if (void *ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // __ALLOCATION_COUNTER_HPP__
@@ -0,0 +1,137 @@
+#ifndef __CONTAINER_BENCHMARKS_HPP__
+#define __CONTAINER_BENCHMARKS_HPP__
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Workloads shared by the container-versus-std benchmarks.
+ *
+ * A benchmark executable specializes bench::ContainerOps for each container
+ * it measures, giving static push(), peek() and pop() that map the
+ * container onto one queue-or-stack vocabulary; a specialization without
+ * push() is filled by index instead. register_benchmark() names every run
+ * "<workload><<container><<element>>>/<count>", so the JSON written by
+ * --benchmark_out_format=json can be compared name by name across runs.
+ */
+namespace bench {
+template <typename Container> struct ContainerOps;
+
+template <typename Container, typename = void>
+struct has_push : std::false_type {};
+
+template <typename Container>
+struct has_push<Container,
+                std::void_t<decltype(&ContainerOps<Container>::push)>>
+    : std::true_type {};
+
+// Strings longer than the small-string buffer, so each copy allocates.
+template <typename T> auto make_values(std::size_t count) -> std::vector<T> {
+  std::vector<T> values;
+  values.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      values.push_back(std::string(24, 'x') + std::to_string(i));
+    } else {
+      values.push_back(static_cast<T>(i));
+    }
+  }
+  return values;
+}
+
+inline auto weight(int value) -> std::size_t {
+  return static_cast<std::size_t>(value);
+}
+inline auto weight(const std::string &value) -> std::size_t {
+  return value.size();
+}
+
+template <typename Container, typename T>
+auto fill(Container &container, const std::vector<T> &values) -> void {
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    if constexpr (has_push<Container>::value) {
+      ContainerOps<Container>::push(container, values[i]);
+    } else {
+      container[i] = values[i];
+    }
+  }
+}
+
+// Pushes range(0) copies, then peeks and pops until empty.
+template <typename Container> void BM_PushPop(benchmark::State &state) {
+  using Ops = ContainerOps<Container>;
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto values = make_values<typename Container::value_type>(count);
+  Container container;
+  for (auto _ : state) {
+    fill(container, values);
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      sum += weight(Ops::peek(container));
+      Ops::pop(container);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container> void BM_Iterate(benchmark::State &state) {
+  const auto values = make_values<typename Container::value_type>(
+      static_cast<std::size_t>(state.range(0)));
+  Container container;
+  fill(container, values);
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (const auto &value : container) {
+      sum += weight(value);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container> void BM_IndexedRead(benchmark::State &state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto values = make_values<typename Container::value_type>(count);
+  Container container;
+  fill(container, values);
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      sum += weight(container[i]);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+inline auto register_benchmark(const std::string &workload,
+                               const std::string &container,
+                               const std::string &element,
+                               void (*run)(benchmark::State &),
+                               std::size_t count) -> void {
+  const std::string name = workload + "<" + container + "<" + element + ">>";
+  benchmark::RegisterBenchmark(name.c_str(), run)
+      ->Arg(static_cast<std::int64_t>(count));
+}
+
+// Calls RegisterSize<T, N>::run(element) for every element type and size
+// the containers are measured at. Sizes are template arguments because the
+// Array* containers fix their capacity at compile time.
+template <template <typename, std::size_t> class RegisterSize>
+auto register_all() -> bool {
+  RegisterSize<int, 1 << 6>::run("int");
+  RegisterSize<int, 1 << 10>::run("int");
+  RegisterSize<int, 1 << 14>::run("int");
+  RegisterSize<std::string, 1 << 6>::run("std::string");
+  RegisterSize<std::string, 1 << 10>::run("std::string");
+  RegisterSize<std::string, 1 << 14>::run("std::string");
+  return true;
+}
+} // namespace bench
+
+#endif // __CONTAINER_BENCHMARKS_HPP__
@@ -0,0 +1,28 @@
+#include "../include/Array.hpp"
+#include "ContainerBenchmarks.hpp"
+#include <array>
+#include <cstddef>
+#include <string>
+
+// Array and std::array have no push(), so both are filled by index.
+namespace bench {
+template <typename T, std::size_t N> struct ContainerOps<Array<T, N>> {};
+template <typename T, std::size_t N> struct ContainerOps<std::array<T, N>> {};
+} // namespace bench
+
+namespace {
+template <typename T, std::size_t N> struct RegisterSize {
+  static auto run(const std::string &element) -> void {
+    bench::register_benchmark("BM_IndexedRead", "Array", element,
+                              bench::BM_IndexedRead<Array<T, N>>, N);
+    bench::register_benchmark("BM_IndexedRead", "std::array", element,
+                              bench::BM_IndexedRead<std::array<T, N>>, N);
+    bench::register_benchmark("BM_Iterate", "Array", element,
+                              bench::BM_Iterate<Array<T, N>>, N);
+    bench::register_benchmark("BM_Iterate", "std::array", element,
+                              bench::BM_Iterate<std::array<T, N>>, N);
+  }
+};
+
+[[maybe_unused]] const bool registered = bench::register_all<RegisterSize>();
+} // namespace
@@ -0,0 +1,45 @@
+#include "../include/ArrayDeque.hpp"
+#include "ContainerBenchmarks.hpp"
+#include <cstddef>
+#include <deque>
+#include <string>
+
+// Both deques are used as queues: push_back() and pop_front().
+namespace bench {
+template <typename T, std::size_t N> struct ContainerOps<ArrayDeque<T, N>> {
+  static auto push(ArrayDeque<T, N> &deque, const T &value) -> void {
+    deque.push_back(value);
+  }
+  static auto peek(const ArrayDeque<T, N> &deque) -> const T & {
+    return deque.front();
+  }
+  static auto pop(ArrayDeque<T, N> &deque) -> void { deque.pop_front(); }
+};
+
+template <typename T> struct ContainerOps<std::deque<T>> {
+  static auto push(std::deque<T> &deque, const T &value) -> void {
+    deque.push_back(value);
+  }
+  static auto peek(const std::deque<T> &deque) -> const T & {
+    return deque.front();
+  }
+  static auto pop(std::deque<T> &deque) -> void { deque.pop_front(); }
+};
+} // namespace bench
+
+namespace {
+template <typename T, std::size_t N> struct RegisterSize {
+  static auto run(const std::string &element) -> void {
+    bench::register_benchmark("BM_PushPop", "ArrayDeque", element,
+                              bench::BM_PushPop<ArrayDeque<T, N>>, N);
+    bench::register_benchmark("BM_PushPop", "std::deque", element,
+                              bench::BM_PushPop<std::deque<T>>, N);
+    bench::register_benchmark("BM_Iterate", "ArrayDeque", element,
+                              bench::BM_Iterate<ArrayDeque<T, N>>, N);
+    bench::register_benchmark("BM_Iterate", "std::deque", element,
+                              bench::BM_Iterate<std::deque<T>>, N);
+  }
+};
+
+[[maybe_unused]] const bool registered = bench::register_all<RegisterSize>();
+} // namespace
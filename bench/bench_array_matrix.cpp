@@ -0,0 +1,95 @@
+#include "../include/ArrayMatrix.hpp"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <random>
+#include <thread>
+
+namespace {
+template <typename T> auto random_matrix(std::size_t size) -> Matrix<T> {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  Matrix<T> result(size, size);
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    result.data()[i] = static_cast<T>(value(rng));
+  }
+  return result;
+}
+
+// The i-k-j triple loop a caller writes without a matrix library.
+template <typename T>
+auto naive_product(const Matrix<T> &a, const Matrix<T> &b) -> Matrix<T> {
+  const std::size_t n = a.rows();
+  Matrix<T> c(n, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t k = 0; k < n; ++k) {
+      const T scale = a(i, k);
+      for (std::size_t j = 0; j < n; ++j) {
+        c(i, j) += scale * b(k, j);
+      }
+    }
+  }
+  return c;
+}
+
+auto set_flops(benchmark::State &state, double flops_per_iteration) -> void {
+  state.counters["FLOPS"] = benchmark::Counter(
+      flops_per_iteration, benchmark::Counter::kIsIterationInvariantRate,
+      benchmark::Counter::OneK::kIs1000);
+}
+} // namespace
+
+template <typename T> static void BM_GemmNaive(benchmark::State &state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto a = random_matrix<T>(n);
+  const auto b = random_matrix<T>(n);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(naive_product(a, b));
+  }
+  set_flops(state, 2.0 * n * n * n);
+}
+
+// range(1) is the thread count, 0 meaning one per hardware thread.
+template <typename T> static void BM_GemmBlocked(benchmark::State &state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto threads = state.range(1) == 0
+                           ? std::thread::hardware_concurrency()
+                           : static_cast<std::size_t>(state.range(1));
+  const auto a = random_matrix<T>(n);
+  const auto b = random_matrix<T>(n);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.multiply(b, threads));
+  }
+  set_flops(state, 2.0 * n * n * n);
+}
+
+template <typename T> static void BM_Gemv(benchmark::State &state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto a = random_matrix<T>(n);
+  const Vector<T> x(n, T{1});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.multiply(x));
+  }
+  set_flops(state, 2.0 * n * n);
+}
+
+template <typename T> static void BM_Transpose(benchmark::State &state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto a = random_matrix<T>(n);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.transpose());
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(BM_GemmNaive, float)->RangeMultiplier(2)->Range(64, 1024);
+BENCHMARK_TEMPLATE(BM_GemmNaive, double)->RangeMultiplier(2)->Range(64, 1024);
+BENCHMARK_TEMPLATE(BM_GemmBlocked, float)
+    ->ArgsProduct({{64, 128, 256, 512, 1024}, {1}})
+    ->Args({1024, 0});
+BENCHMARK_TEMPLATE(BM_GemmBlocked, double)
+    ->ArgsProduct({{64, 128, 256, 512, 1024}, {1}})
+    ->Args({1024, 0});
+BENCHMARK_TEMPLATE(BM_Gemv, float)->Arg(1024)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_Gemv, double)->Arg(1024)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_Transpose, float)->Arg(1024)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_Transpose, double)->Arg(1024)->Arg(4096);
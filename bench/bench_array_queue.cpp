@@ -0,0 +1,40 @@
+#include "../include/ArrayQueue.hpp"
+#include "ContainerBenchmarks.hpp"
+#include <cstddef>
+#include <queue>
+#include <string>
+
+namespace bench {
+template <typename T, std::size_t N> struct ContainerOps<ArrayQueue<T, N>> {
+  static auto push(ArrayQueue<T, N> &queue, const T &value) -> void {
+    queue.enqueue(value);
+  }
+  static auto peek(const ArrayQueue<T, N> &queue) -> const T & {
+    return queue.top();
+  }
+  static auto pop(ArrayQueue<T, N> &queue) -> void { queue.dequeue(); }
+};
+
+template <typename T> struct ContainerOps<std::queue<T>> {
+  static auto push(std::queue<T> &queue, const T &value) -> void {
+    queue.push(value);
+  }
+  static auto peek(const std::queue<T> &queue) -> const T & {
+    return queue.front();
+  }
+  static auto pop(std::queue<T> &queue) -> void { queue.pop(); }
+};
+} // namespace bench
+
+namespace {
+template <typename T, std::size_t N> struct RegisterSize {
+  static auto run(const std::string &element) -> void {
+    bench::register_benchmark("BM_PushPop", "ArrayQueue", element,
+                              bench::BM_PushPop<ArrayQueue<T, N>>, N);
+    bench::register_benchmark("BM_PushPop", "std::queue", element,
+                              bench::BM_PushPop<std::queue<T>>, N);
+  }
+};
+
+[[maybe_unused]] const bool registered = bench::register_all<RegisterSize>();
+} // namespace
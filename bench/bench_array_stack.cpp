@@ -0,0 +1,40 @@
+#include "../include/ArrayStack.hpp"
+#include "ContainerBenchmarks.hpp"
+#include <cstddef>
+#include <stack>
+#include <string>
+
+namespace bench {
+template <typename T, std::size_t N> struct ContainerOps<ArrayStack<T, N>> {
+  static auto push(ArrayStack<T, N> &stack, const T &value) -> void {
+    stack.push(value);
+  }
+  static auto peek(const ArrayStack<T, N> &stack) -> const T & {
+    return stack.top();
+  }
+  static auto pop(ArrayStack<T, N> &stack) -> void { stack.pop(); }
+};
+
+template <typename T> struct ContainerOps<std::stack<T>> {
+  static auto push(std::stack<T> &stack, const T &value) -> void {
+    stack.push(value);
+  }
+  static auto peek(const std::stack<T> &stack) -> const T & {
+    return stack.top();
+  }
+  static auto pop(std::stack<T> &stack) -> void { stack.pop(); }
+};
+} // namespace bench
+
+namespace {
+template <typename T, std::size_t N> struct RegisterSize {
+  static auto run(const std::string &element) -> void {
+    bench::register_benchmark("BM_PushPop", "ArrayStack", element,
+                              bench::BM_PushPop<ArrayStack<T, N>>, N);
+    bench::register_benchmark("BM_PushPop", "std::stack", element,
+                              bench::BM_PushPop<std::stack<T>>, N);
+  }
+};
+
+[[maybe_unused]] const bool registered = bench::register_all<RegisterSize>();
+} // namespace
@@ -0,0 +1,73 @@
+#include "../include/ConcurrentHashMap.hpp"
+#include "../include/HashMap.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <random>
+
+namespace {
+using Key = std::uint64_t;
+using ShardedMap = ConcurrentHashMap<Key, Key>;
+
+// The baseline: every operation serializes on one mutex.
+class SingleLockMap {
+  mutable std::mutex m_mutex;
+  HashMap<Key, Key> m_map;
+
+public:
+  [[nodiscard]] auto get(Key key) const -> std::optional<Key> {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto it = m_map.find(key);
+    return it == m_map.end() ? std::nullopt : std::optional(it->second);
+  }
+  auto insert_or_assign(Key key, Key value) -> bool {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_map.insert_or_assign(key, value);
+  }
+};
+
+constexpr Key preload = 1 << 20;
+} // namespace
+
+// Every thread mixes lookups and overwrites of preloaded keys;
+// range(0) is the percentage of lookups.
+template <typename MapType>
+static void BM_Mixed(benchmark::State &state) {
+  static MapType *map = nullptr;
+  if (state.thread_index() == 0) {
+    map = new MapType();
+    for (Key key = 0; key < preload; ++key) {
+      map->insert_or_assign(key, key);
+    }
+  }
+  const auto read_percent = static_cast<std::uint64_t>(state.range(0));
+  std::mt19937_64 rng(static_cast<unsigned>(state.thread_index()) + 1);
+  for (auto _ : state) {
+    const std::uint64_t draw = rng();
+    const Key key = draw % preload;
+    if ((draw >> 40) % 100 < read_percent) {
+      benchmark::DoNotOptimize(map->get(key));
+    } else {
+      map->insert_or_assign(key, draw);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    delete map;
+    map = nullptr;
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_Mixed, ShardedMap)
+    ->ArgName("read_percent")
+    ->Arg(95)
+    ->Arg(50)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Mixed, SingleLockMap)
+    ->ArgName("read_percent")
+    ->Arg(95)
+    ->Arg(50)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
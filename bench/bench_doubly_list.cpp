@@ -0,0 +1,254 @@
+#include "../include/DoublyList.hpp"
+#include "AllocationCounter.hpp"
+#include "ContainerBenchmarks.hpp"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+auto shuffled_values(std::size_t count) -> std::vector<int> {
+  std::vector<int> values(count);
+  std::iota(values.begin(), values.end(), 0);
+  std::shuffle(values.begin(), values.end(), std::mt19937{42});
+  return values;
+}
+
+auto fill(const std::vector<int> &values, DoublyList<int> &list) -> void {
+  for (const auto value : values) {
+    list.add(value);
+  }
+}
+} // namespace
+
+// Node-relinking merge sort
+static void BM_DoublyList_Sort(benchmark::State &state) {
+  const auto values = shuffled_values(static_cast<std::size_t>(state.range(0)));
+  DoublyList<int> list;
+  for (auto _ : state) {
+    state.PauseTiming();
+    fill(values, list);
+    state.ResumeTiming();
+
+    list.sort();
+    benchmark::DoNotOptimize(list.top());
+
+    state.PauseTiming();
+    list.clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DoublyList_Sort)->Arg(1'000)->Arg(1'000'000);
+
+// Copy into an array, sort, and rebuild the list with fresh nodes
+static void BM_DoublyList_CopyOutSort(benchmark::State &state) {
+  const auto values = shuffled_values(static_cast<std::size_t>(state.range(0)));
+  DoublyList<int> list;
+  for (auto _ : state) {
+    state.PauseTiming();
+    fill(values, list);
+    state.ResumeTiming();
+
+    std::vector<int> buffer;
+    buffer.reserve(list.size());
+    for (const auto value : list) {
+      buffer.push_back(value);
+    }
+    std::sort(buffer.begin(), buffer.end());
+    list.clear();
+    for (const auto value : buffer) {
+      list.add(value);
+    }
+    benchmark::DoNotOptimize(list.top());
+
+    state.PauseTiming();
+    list.clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DoublyList_CopyOutSort)->Arg(1'000)->Arg(1'000'000);
+
+namespace {
+constexpr std::size_t payload_length = 64;
+
+auto payloads(std::size_t count) -> std::vector<std::string> {
+  return std::vector<std::string>(count, std::string(payload_length, 'x'));
+}
+
+auto report_allocations(benchmark::State &state, std::size_t allocations)
+    -> void {
+  state.counters["allocs_per_item"] = benchmark::Counter(
+      static_cast<double>(allocations) /
+      static_cast<double>(state.iterations() * state.range(0)));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+// Deep-copies every payload into its node
+static void BM_DoublyList_AddCopy(benchmark::State &state) {
+  const auto values = payloads(static_cast<std::size_t>(state.range(0)));
+  DoublyList<std::string> list;
+  std::size_t allocations = 0;
+  for (auto _ : state) {
+    const auto before = bench::allocation_count;
+    for (const auto &value : values) {
+      list.add(value);
+    }
+    allocations += bench::allocation_count - before;
+
+    state.PauseTiming();
+    list.clear();
+    state.ResumeTiming();
+  }
+  report_allocations(state, allocations);
+}
+BENCHMARK(BM_DoublyList_AddCopy)->Arg(1'000)->Arg(100'000);
+
+// Steals the payload buffer, allocating only the node
+static void BM_DoublyList_AddMove(benchmark::State &state) {
+  DoublyList<std::string> list;
+  std::size_t allocations = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto values = payloads(static_cast<std::size_t>(state.range(0)));
+    state.ResumeTiming();
+
+    const auto before = bench::allocation_count;
+    for (auto &value : values) {
+      list.add(std::move(value));
+    }
+    allocations += bench::allocation_count - before;
+
+    state.PauseTiming();
+    list.clear();
+    values.clear();
+    state.ResumeTiming();
+  }
+  report_allocations(state, allocations);
+}
+BENCHMARK(BM_DoublyList_AddMove)->Arg(1'000)->Arg(100'000);
+
+// Constructs the payload directly inside the node
+static void BM_DoublyList_EmplaceBack(benchmark::State &state) {
+  DoublyList<std::string> list;
+  std::size_t allocations = 0;
+  for (auto _ : state) {
+    const auto before = bench::allocation_count;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      list.emplace_back(payload_length, 'x');
+    }
+    allocations += bench::allocation_count - before;
+
+    state.PauseTiming();
+    list.clear();
+    state.ResumeTiming();
+  }
+  report_allocations(state, allocations);
+}
+BENCHMARK(BM_DoublyList_EmplaceBack)->Arg(1'000)->Arg(100'000);
+
+// Range-for traversal, checked or unchecked depending on the build mode
+static void BM_DoublyList_Traverse(benchmark::State &state) {
+  DoublyList<int> list;
+  fill(shuffled_values(static_cast<std::size_t>(state.range(0))), list);
+  for (auto _ : state) {
+    long long sum = 0;
+    for (const auto &value : list) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DoublyList_Traverse)->Arg(1'000)->Arg(1'000'000);
+
+static void BM_StdList_Traverse(benchmark::State &state) {
+  const auto values = shuffled_values(static_cast<std::size_t>(state.range(0)));
+  const std::list<int> list(values.begin(), values.end());
+  for (auto _ : state) {
+    long long sum = 0;
+    for (const auto &value : list) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdList_Traverse)->Arg(1'000)->Arg(1'000'000);
+
+// Traversal of a list whose nodes were linked in an order unrelated to
+// their addresses: filled with shuffled values, then sorted by relinking.
+// range(1) selects the walk: 0 = iterators, 1 = prefetching for_each,
+// 2 = for_each after compact() restored address order.
+static void BM_DoublyList_TraverseShuffled(benchmark::State &state) {
+  DoublyList<int> list;
+  fill(shuffled_values(static_cast<std::size_t>(state.range(0))), list);
+  list.sort();
+  const auto mode = state.range(1);
+  if (mode == 2) {
+    list.compact();
+  }
+  for (auto _ : state) {
+    std::uint64_t hash = 0;
+    if (mode == 0) {
+      for (const auto &value : list) {
+        hash = (hash ^ static_cast<std::uint64_t>(value)) * 0x100000001B3ULL;
+      }
+    } else {
+      list.for_each([&hash](const int &value) {
+        hash = (hash ^ static_cast<std::uint64_t>(value)) * 0x100000001B3ULL;
+      });
+    }
+    benchmark::DoNotOptimize(hash);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DoublyList_TraverseShuffled)
+    ->ArgsProduct({{100'000, 1'000'000}, {0, 1, 2}});
+
+// DoublyList against std::list, used as a queue.
+namespace bench {
+template <typename T> struct ContainerOps<DoublyList<T>> {
+  static auto push(DoublyList<T> &list, const T &value) -> void {
+    list.add_back(value);
+  }
+  static auto peek(const DoublyList<T> &list) -> const T & {
+    return list.top();
+  }
+  static auto pop(DoublyList<T> &list) -> void { list.erase(list.begin()); }
+};
+
+template <typename T> struct ContainerOps<std::list<T>> {
+  static auto push(std::list<T> &list, const T &value) -> void {
+    list.push_back(value);
+  }
+  static auto peek(const std::list<T> &list) -> const T & {
+    return list.front();
+  }
+  static auto pop(std::list<T> &list) -> void { list.pop_front(); }
+};
+} // namespace bench
+
+namespace {
+template <typename T, std::size_t N> struct RegisterSize {
+  static auto run(const std::string &element) -> void {
+    bench::register_benchmark("BM_PushPop", "DoublyList", element,
+                              bench::BM_PushPop<DoublyList<T>>, N);
+    bench::register_benchmark("BM_PushPop", "std::list", element,
+                              bench::BM_PushPop<std::list<T>>, N);
+    bench::register_benchmark("BM_Iterate", "DoublyList", element,
+                              bench::BM_Iterate<DoublyList<T>>, N);
+    bench::register_benchmark("BM_Iterate", "std::list", element,
+                              bench::BM_Iterate<std::list<T>>, N);
+  }
+};
+
+[[maybe_unused]] const bool registered = bench::register_all<RegisterSize>();
+} // namespace
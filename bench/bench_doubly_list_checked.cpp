@@ -0,0 +1,23 @@
+// Forces checked iterators regardless of the build mode so that traversal
+// can be compared against BM_DoublyList_Traverse in a release build.
+#define DOUBLY_LIST_CHECKED_ITERATORS 1
+
+#include "../include/DoublyList.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+static void BM_DoublyList_CheckedTraverse(benchmark::State &state) {
+  DoublyList<int> list;
+  for (std::int64_t i = 0; i < state.range(0); ++i) {
+    list.add(static_cast<int>(i));
+  }
+  for (auto _ : state) {
+    long long sum = 0;
+    for (const auto &value : list) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DoublyList_CheckedTraverse)->Arg(1'000)->Arg(1'000'000);
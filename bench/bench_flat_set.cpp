@@ -0,0 +1,92 @@
+#include "../include/FlatSet.hpp"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace {
+using SortedFlatSet = FlatSet<int>;
+using EytzingerFlatSet = FlatSet<int, std::less<int>, FlatLayout::Eytzinger>;
+using StdSet = std::set<int>;
+
+// Plain sorted array searched with std::lower_bound, the baseline both
+// FlatSet layouts have to beat.
+class SortedArray {
+private:
+  std::vector<int> m_keys;
+
+public:
+  template <typename InputIt>
+  SortedArray(InputIt first, InputIt last) : m_keys(first, last) {
+    std::sort(m_keys.begin(), m_keys.end());
+  }
+
+  [[nodiscard]] auto contains(int key) const -> bool {
+    const auto it = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+    return it != m_keys.end() && *it == key;
+  }
+};
+
+auto shuffled_keys(std::size_t count) -> std::vector<int> {
+  std::vector<int> keys(count);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+  return keys;
+}
+
+template <typename Set> auto contains(const Set &set, int key) -> bool {
+  return set.contains(key);
+}
+auto contains(const StdSet &set, int key) -> bool {
+  return set.find(key) != set.end();
+}
+} // namespace
+
+// Looks up every key in random order; range(0) sweeps from L1-resident to
+// far larger than the last-level cache.
+template <typename Set> static void BM_ContainsHit(benchmark::State &state) {
+  const auto keys = shuffled_keys(static_cast<std::size_t>(state.range(0)));
+  const Set set(keys.begin(), keys.end());
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(contains(set, keys[i]));
+    i = i + 1 == keys.size() ? 0 : i + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Set> static void BM_Build(benchmark::State &state) {
+  const auto keys = shuffled_keys(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    Set set(keys.begin(), keys.end());
+    benchmark::DoNotOptimize(set);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Set> static void BM_Iterate(benchmark::State &state) {
+  const auto keys = shuffled_keys(static_cast<std::size_t>(state.range(0)));
+  const Set set(keys.begin(), keys.end());
+  for (auto _ : state) {
+    long sum = 0;
+    for (int key : set) {
+      sum += key;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_ContainsHit, SortedFlatSet)->Range(1 << 8, 1 << 24);
+BENCHMARK_TEMPLATE(BM_ContainsHit, EytzingerFlatSet)->Range(1 << 8, 1 << 24);
+BENCHMARK_TEMPLATE(BM_ContainsHit, SortedArray)->Range(1 << 8, 1 << 24);
+BENCHMARK_TEMPLATE(BM_ContainsHit, StdSet)->Range(1 << 8, 1 << 24);
+BENCHMARK_TEMPLATE(BM_Build, SortedFlatSet)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Build, EytzingerFlatSet)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Build, StdSet)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Iterate, SortedFlatSet)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Iterate, EytzingerFlatSet)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Iterate, StdSet)->Arg(1 << 20);
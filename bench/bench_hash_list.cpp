@@ -0,0 +1,158 @@
+#include "../include/HashList.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+using Key = std::uint64_t;
+using FlatList = HashList<Key, Key>;
+
+// The textbook linked hash map: entries in a std::list, an unordered_map
+// from key to list node.
+class StdLinkedMap {
+  using Order = std::list<std::pair<Key, Key>>;
+  Order m_order;
+  std::unordered_map<Key, Order::iterator> m_index;
+
+public:
+  auto insert(Key key, Key value) -> void {
+    if (m_index.count(key) == 0) {
+      m_order.emplace_back(key, value);
+      m_index.emplace(key, std::prev(m_order.end()));
+    }
+  }
+  [[nodiscard]] auto find(Key key) const -> const std::pair<Key, Key> * {
+    const auto it = m_index.find(key);
+    return it == m_index.end() ? nullptr : &*it->second;
+  }
+  auto move_to_back(Key key) -> void {
+    const auto it = m_index.find(key);
+    if (it != m_index.end()) {
+      m_order.splice(m_order.end(), m_order, it->second);
+    }
+  }
+  auto pop_front() -> void {
+    m_index.erase(m_order.front().first);
+    m_order.pop_front();
+  }
+  [[nodiscard]] auto begin() const { return m_order.begin(); }
+  [[nodiscard]] auto end() const { return m_order.end(); }
+};
+
+auto find_value(const FlatList &list, Key key) -> Key {
+  return list.find(key)->second;
+}
+auto find_value(const StdLinkedMap &map, Key key) -> Key {
+  return map.find(key)->second;
+}
+
+auto random_keys(std::size_t count, unsigned seed) -> std::vector<Key> {
+  std::mt19937_64 rng(seed);
+  std::vector<Key> keys(count);
+  for (auto &key : keys) {
+    key = rng();
+  }
+  return keys;
+}
+
+template <typename MapType>
+auto build(const std::vector<Key> &keys) -> MapType {
+  MapType map;
+  for (Key key : keys) {
+    map.insert(key, key);
+  }
+  return map;
+}
+
+// Moves a random quarter of the entries to the back, which scatters list
+// order across the node storage.
+template <typename MapType>
+auto shuffle_order(MapType &map, const std::vector<Key> &keys) -> void {
+  std::mt19937 rng(11);
+  for (std::size_t i = 0; i < keys.size() / 4; ++i) {
+    map.move_to_back(keys[rng() % keys.size()]);
+  }
+}
+} // namespace
+
+// Full traversal in insertion order, summing the values.
+template <typename MapType> static void BM_Iterate(benchmark::State &state) {
+  const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 1);
+  const auto map = build<MapType>(keys);
+  for (auto _ : state) {
+    Key sum = 0;
+    for (const auto &entry : map) {
+      sum += entry.second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Traversal after move_to_back traffic; range(1) == 1 compacts HashList
+// first.
+template <typename MapType>
+static void BM_IterateAfterReorder(benchmark::State &state) {
+  const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 2);
+  auto map = build<MapType>(keys);
+  shuffle_order(map, keys);
+  if constexpr (std::is_same_v<MapType, FlatList>) {
+    if (state.range(1) == 1) {
+      map.compact();
+    }
+  }
+  for (auto _ : state) {
+    Key sum = 0;
+    for (const auto &entry : map) {
+      sum += entry.second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Lookups of present keys in random order.
+template <typename MapType> static void BM_LookupHit(benchmark::State &state) {
+  const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 3);
+  const auto map = build<MapType>(keys);
+  auto probes = keys;
+  std::shuffle(probes.begin(), probes.end(), std::mt19937(4));
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(find_value(map, probes[i]));
+    i = i + 1 == probes.size() ? 0 : i + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// FIFO eviction at a fixed size: each step inserts a new key and drops
+// the oldest one.
+template <typename MapType> static void BM_FifoChurn(benchmark::State &state) {
+  const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 5);
+  auto map = build<MapType>(keys);
+  const auto fresh = random_keys(1 << 20, 6);
+  std::size_t i = 0;
+  for (auto _ : state) {
+    map.insert(fresh[i], fresh[i]);
+    map.pop_front();
+    i = i + 1 == fresh.size() ? 0 : i + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_Iterate, FlatList)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_Iterate, StdLinkedMap)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_IterateAfterReorder, FlatList)
+    ->Args({1 << 20, 0})
+    ->Args({1 << 20, 1});
+BENCHMARK_TEMPLATE(BM_IterateAfterReorder, StdLinkedMap)->Args({1 << 20, 0});
+BENCHMARK_TEMPLATE(BM_LookupHit, FlatList)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_LookupHit, StdLinkedMap)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_FifoChurn, FlatList)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_FifoChurn, StdLinkedMap)->Arg(1 << 10)->Arg(1 << 20);
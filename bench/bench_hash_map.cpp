@@ -0,0 +1,107 @@
+#include "../include/HashMap.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+// Largest key count to benchmark. 1e8 keys need several GB for
+// std::unordered_map, so pass -DHASH_MAP_BENCH_MAX_KEYS=100000000 to opt in.
+#ifndef HASH_MAP_BENCH_MAX_KEYS
+#define HASH_MAP_BENCH_MAX_KEYS 10000000
+#endif
+
+namespace {
+using Key = std::uint64_t;
+using FlatMap = HashMap<Key, Key>;
+using StdMap = std::unordered_map<Key, Key>;
+
+auto random_keys(std::size_t count, unsigned seed) -> std::vector<Key> {
+  std::mt19937_64 rng(seed);
+  std::vector<Key> keys(count);
+  for (auto &key : keys) {
+    key = rng();
+  }
+  return keys;
+}
+
+template <typename MapType>
+auto build(const std::vector<Key> &keys) -> MapType {
+  MapType map;
+  for (Key key : keys) {
+    map.emplace(key, key);
+  }
+  return map;
+}
+
+auto key_counts(benchmark::internal::Benchmark *bench) -> void {
+  for (std::int64_t count = 1000; count <= HASH_MAP_BENCH_MAX_KEYS;
+       count *= 10) {
+    bench->Arg(count);
+  }
+}
+} // namespace
+
+// Inserting state.range(0) distinct keys into an empty map, growth included.
+template <typename MapType> static void BM_Insert(benchmark::State &state) {
+  const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 1);
+  for (auto _ : state) {
+    auto map = build<MapType>(keys);
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Lookups of present keys in random order.
+template <typename MapType> static void BM_LookupHit(benchmark::State &state) {
+  const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 2);
+  const auto map = build<MapType>(keys);
+  auto probes = keys;
+  std::shuffle(probes.begin(), probes.end(), std::mt19937(3));
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.find(probes[i])->second);
+    i = i + 1 == probes.size() ? 0 : i + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Lookups of keys that are not in the map.
+template <typename MapType> static void BM_LookupMiss(benchmark::State &state) {
+  const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 4);
+  const auto map = build<MapType>(keys);
+  const auto probes = random_keys(keys.size(), 5);
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.find(probes[i]) == map.end());
+    i = i + 1 == probes.size() ? 0 : i + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Erasing every key of a full map in random order.
+template <typename MapType> static void BM_Erase(benchmark::State &state) {
+  const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 6);
+  auto order = keys;
+  std::shuffle(order.begin(), order.end(), std::mt19937(7));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto map = build<MapType>(keys);
+    state.ResumeTiming();
+    for (Key key : order) {
+      map.erase(key);
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_Insert, FlatMap)->Apply(key_counts);
+BENCHMARK_TEMPLATE(BM_Insert, StdMap)->Apply(key_counts);
+BENCHMARK_TEMPLATE(BM_LookupHit, FlatMap)->Apply(key_counts);
+BENCHMARK_TEMPLATE(BM_LookupHit, StdMap)->Apply(key_counts);
+BENCHMARK_TEMPLATE(BM_LookupMiss, FlatMap)->Apply(key_counts);
+BENCHMARK_TEMPLATE(BM_LookupMiss, StdMap)->Apply(key_counts);
+BENCHMARK_TEMPLATE(BM_Erase, FlatMap)->Apply(key_counts);
+BENCHMARK_TEMPLATE(BM_Erase, StdMap)->Apply(key_counts);
@@ -0,0 +1,196 @@
+#include "../include/HashMatrix.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+using Id = std::uint32_t;
+using Value = float;
+
+// Live heap bytes of the containers that allocate through CountingAllocator.
+inline std::size_t live_bytes = 0;
+
+template <typename T> struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() noexcept = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &) noexcept {}
+
+  auto allocate(std::size_t count) -> T * {
+    live_bytes += count * sizeof(T);
+    return std::allocator<T>().allocate(count);
+  }
+  auto deallocate(T *ptr, std::size_t count) noexcept -> void {
+    live_bytes -= count * sizeof(T);
+    std::allocator<T>().deallocate(ptr, count);
+  }
+  template <typename U>
+  auto operator==(const CountingAllocator<U> &) const noexcept -> bool {
+    return true;
+  }
+  template <typename U>
+  auto operator!=(const CountingAllocator<U> &) const noexcept -> bool {
+    return false;
+  }
+};
+
+using FlatMatrix = HashMatrix<Id, Id, Value>;
+
+// The nested layout this replaces: one unordered_map per row.
+using InnerMap =
+    std::unordered_map<Id, Value, std::hash<Id>, std::equal_to<Id>,
+                       CountingAllocator<std::pair<const Id, Value>>>;
+using NestedMaps =
+    std::unordered_map<Id, InnerMap, std::hash<Id>, std::equal_to<Id>,
+                       CountingAllocator<std::pair<const Id, InnerMap>>>;
+
+auto insert(FlatMatrix &matrix, Id row, Id col, Value value) -> void {
+  matrix.insert(row, col, value);
+}
+auto insert(NestedMaps &maps, Id row, Id col, Value value) -> void {
+  maps[row].emplace(col, value);
+}
+
+auto lookup(const FlatMatrix &matrix, Id row, Id col) -> Value {
+  return *matrix.find(row, col);
+}
+auto lookup(const NestedMaps &maps, Id row, Id col) -> Value {
+  return maps.find(row)->second.find(col)->second;
+}
+
+auto row_sum(const FlatMatrix &matrix, Id row) -> Value {
+  Value sum = 0;
+  matrix.for_each_in_row(row, [&](Id, Value value) { sum += value; });
+  return sum;
+}
+auto row_sum(const NestedMaps &maps, Id row) -> Value {
+  Value sum = 0;
+  for (const auto &cell : maps.find(row)->second) {
+    sum += cell.second;
+  }
+  return sum;
+}
+
+auto erase_row(FlatMatrix &matrix, Id row) -> void { matrix.erase_row(row); }
+auto erase_row(NestedMaps &maps, Id row) -> void { maps.erase(row); }
+
+auto heap_bytes(const FlatMatrix &matrix) -> std::size_t {
+  return matrix.memory_usage().total_bytes();
+}
+auto heap_bytes(const NestedMaps &) -> std::size_t { return live_bytes; }
+
+// User x feature cells: row lengths follow a power law (a few users with
+// thousands of features, most with a handful) over 2^16 feature ids.
+auto user_features(Id users) -> std::vector<std::pair<Id, Id>> {
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  std::vector<std::pair<Id, Id>> cells;
+  for (Id user = 0; user < users; ++user) {
+    const auto length = static_cast<Id>(
+        std::min(4096.0, 1.0 / std::pow(1.0 - uniform(rng), 1.0 / 1.2)));
+    const Id start = rng();
+    for (Id i = 0; i < length; ++i) {
+      cells.emplace_back(user, (start + i * 40503U) & 0xFFFF);
+    }
+  }
+  return cells;
+}
+
+template <typename MatrixType>
+auto build(const std::vector<std::pair<Id, Id>> &cells) -> MatrixType {
+  MatrixType matrix;
+  for (const auto &[row, col] : cells) {
+    insert(matrix, row, col, static_cast<Value>(col));
+  }
+  return matrix;
+}
+} // namespace
+
+// Loading every cell, with heap bytes per cell of the finished container.
+template <typename MatrixType> static void BM_Build(benchmark::State &state) {
+  const auto cells = user_features(static_cast<Id>(state.range(0)));
+  std::size_t bytes = 0;
+  for (auto _ : state) {
+    auto matrix = build<MatrixType>(cells);
+    bytes = heap_bytes(matrix);
+    benchmark::DoNotOptimize(bytes);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(cells.size()));
+  state.counters["bytes_per_cell"] =
+      static_cast<double>(bytes) / static_cast<double>(cells.size());
+}
+
+// Lookups of present cells in random order.
+template <typename MatrixType>
+static void BM_CellLookup(benchmark::State &state) {
+  auto cells = user_features(static_cast<Id>(state.range(0)));
+  const auto matrix = build<MatrixType>(cells);
+  std::shuffle(cells.begin(), cells.end(), std::mt19937(2));
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lookup(matrix, cells[i].first, cells[i].second));
+    i = i + 1 == cells.size() ? 0 : i + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Summing whole rows picked at random; items are cells visited.
+template <typename MatrixType> static void BM_RowScan(benchmark::State &state) {
+  const auto users = static_cast<Id>(state.range(0));
+  const auto cells = user_features(users);
+  const auto matrix = build<MatrixType>(cells);
+  std::vector<Id> order(users);
+  for (Id user = 0; user < users; ++user) {
+    order[user] = user;
+  }
+  std::shuffle(order.begin(), order.end(), std::mt19937(3));
+  for (auto _ : state) {
+    Value sum = 0;
+    for (Id user : order) {
+      sum += row_sum(matrix, user);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(cells.size()));
+}
+
+// Deleting every row in random order.
+template <typename MatrixType>
+static void BM_EraseRows(benchmark::State &state) {
+  const auto users = static_cast<Id>(state.range(0));
+  const auto cells = user_features(users);
+  std::vector<Id> order(users);
+  for (Id user = 0; user < users; ++user) {
+    order[user] = user;
+  }
+  std::shuffle(order.begin(), order.end(), std::mt19937(4));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto matrix = build<MatrixType>(cells);
+    state.ResumeTiming();
+    for (Id user : order) {
+      erase_row(matrix, user);
+    }
+    benchmark::DoNotOptimize(matrix);
+  }
+  state.SetItemsProcessed(state.iterations() * users);
+}
+
+BENCHMARK_TEMPLATE(BM_Build, FlatMatrix)->Arg(1 << 12)->Arg(1 << 17);
+BENCHMARK_TEMPLATE(BM_Build, NestedMaps)->Arg(1 << 12)->Arg(1 << 17);
+BENCHMARK_TEMPLATE(BM_CellLookup, FlatMatrix)->Arg(1 << 12)->Arg(1 << 17);
+BENCHMARK_TEMPLATE(BM_CellLookup, NestedMaps)->Arg(1 << 12)->Arg(1 << 17);
+BENCHMARK_TEMPLATE(BM_RowScan, FlatMatrix)->Arg(1 << 12)->Arg(1 << 17);
+BENCHMARK_TEMPLATE(BM_RowScan, NestedMaps)->Arg(1 << 12)->Arg(1 << 17);
+BENCHMARK_TEMPLATE(BM_EraseRows, FlatMatrix)->Arg(1 << 12)->Arg(1 << 17);
+BENCHMARK_TEMPLATE(BM_EraseRows, NestedMaps)->Arg(1 << 12)->Arg(1 << 17);
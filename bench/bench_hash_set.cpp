@@ -0,0 +1,142 @@
+#include "../include/HashMap.hpp"
+#include "../include/HashSet.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+using Key = std::uint64_t;
+using CuckooSet = HashSet<Key>;
+using StdSet = std::unordered_set<Key>;
+
+// The Swiss-table map with an unused byte value, as a probing baseline.
+class FlatSet {
+  HashMap<Key, char> m_map;
+
+public:
+  auto insert(Key key) -> void { m_map.insert(key, 0); }
+  [[nodiscard]] auto contains(Key key) const -> bool {
+    return m_map.contains(key);
+  }
+};
+
+template <typename SetType> auto contains(const SetType &set, Key key) -> bool {
+  return set.find(key) != set.end();
+}
+auto contains(const CuckooSet &set, Key key) -> bool {
+  return set.contains(key);
+}
+auto contains(const FlatSet &set, Key key) -> bool { return set.contains(key); }
+
+auto random_keys(std::size_t count, unsigned seed) -> std::vector<Key> {
+  std::mt19937_64 rng(seed);
+  std::vector<Key> keys(count);
+  for (auto &key : keys) {
+    key = rng();
+  }
+  return keys;
+}
+
+template <typename SetType>
+auto build(const std::vector<Key> &keys) -> SetType {
+  SetType set;
+  for (Key key : keys) {
+    set.insert(key);
+  }
+  return set;
+}
+
+// Half hits and half misses in random order.
+auto mixed_probes(const std::vector<Key> &keys) -> std::vector<Key> {
+  std::vector<Key> probes(keys.begin(), keys.end());
+  const auto misses = random_keys(keys.size(), 99);
+  probes.insert(probes.end(), misses.begin(), misses.end());
+  std::shuffle(probes.begin(), probes.end(), std::mt19937(7));
+  probes.resize(std::min<std::size_t>(probes.size(), 1 << 22));
+  return probes;
+}
+
+auto percentile(std::vector<std::uint32_t> &samples, double fraction)
+    -> double {
+  const auto at = static_cast<std::size_t>(
+      fraction * static_cast<double>(samples.size() - 1));
+  std::nth_element(samples.begin(), samples.begin() + at, samples.end());
+  return samples[at];
+}
+} // namespace
+
+// Latency distribution of single lookups. Each lookup is timed on its own
+// with steady_clock, whose own cost (roughly 20ns) is included in every
+// sample; compare the tails between containers rather than absolute values.
+template <typename SetType>
+static void BM_LookupLatency(benchmark::State &state) {
+  constexpr std::size_t samples_per_iteration = 4096;
+  const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 1);
+  const auto set = build<SetType>(keys);
+  const auto probes = mixed_probes(keys);
+  std::vector<std::uint32_t> samples;
+  std::size_t next = 0;
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < samples_per_iteration; ++i) {
+      const Key probe = probes[next];
+      next = next + 1 == probes.size() ? 0 : next + 1;
+      const auto start = std::chrono::steady_clock::now();
+      benchmark::DoNotOptimize(contains(set, probe));
+      const auto stop = std::chrono::steady_clock::now();
+      if (samples.size() < (1U << 24)) {
+        samples.push_back(static_cast<std::uint32_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+                .count()));
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * samples_per_iteration);
+  state.counters["p50_ns"] = percentile(samples, 0.50);
+  state.counters["p99_ns"] = percentile(samples, 0.99);
+  state.counters["p999_ns"] = percentile(samples, 0.999);
+  state.counters["max_ns"] = *std::max_element(samples.begin(), samples.end());
+}
+
+// Throughput of contains_bulk against one contains() call per key.
+static void BM_BulkContains(benchmark::State &state) {
+  const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 2);
+  const auto set = build<CuckooSet>(keys);
+  const auto probes = mixed_probes(keys);
+  std::vector<char> hits(probes.size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        set.contains_bulk(probes.begin(), probes.end(), hits.begin()));
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(probes.size()));
+}
+
+static void BM_ScalarContains(benchmark::State &state) {
+  const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 2);
+  const auto set = build<CuckooSet>(keys);
+  const auto probes = mixed_probes(keys);
+  std::vector<char> hits(probes.size());
+  for (auto _ : state) {
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < probes.size(); ++i) {
+      hits[i] = set.contains(probes[i]);
+      found += hits[i];
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(probes.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_LookupLatency, CuckooSet)
+    ->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 23);
+BENCHMARK_TEMPLATE(BM_LookupLatency, FlatSet)
+    ->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 23);
+BENCHMARK_TEMPLATE(BM_LookupLatency, StdSet)
+    ->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 23);
+BENCHMARK(BM_BulkContains)->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 23);
+BENCHMARK(BM_ScalarContains)->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 23);
@@ -0,0 +1,167 @@
+#include "../include/Heap.hpp"
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace {
+using BinaryHeap = Heap<int, std::greater<int>, 2>;
+using QuaternaryHeap = Heap<int, std::greater<int>, 4>;
+using OctonaryHeap = Heap<int, std::greater<int>, 8>;
+using StdHeap =
+    std::priority_queue<int, std::vector<int>, std::greater<int>>;
+
+// Operations per trace; 1e7 matches the scheduler workloads we size for.
+constexpr std::int64_t trace_length = 10'000'000;
+
+auto random_keys(std::size_t count, unsigned seed) -> std::vector<int> {
+  std::mt19937 rng(seed);
+  std::vector<int> keys(count);
+  for (auto &key : keys) {
+    key = static_cast<int>(rng() >> 1);
+  }
+  return keys;
+}
+} // namespace
+
+// Hold model: a queue of state.range(0) events where each step pops the
+// earliest and schedules a later one, trace_length operations in total.
+template <typename HeapType> static void BM_HoldTrace(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto initial = random_keys(size, 1);
+  const auto deltas = random_keys(1 << 16, 2);
+  for (auto _ : state) {
+    state.PauseTiming();
+    HeapType heap(initial.begin(), initial.end());
+    state.ResumeTiming();
+    for (std::int64_t i = 0; i < trace_length / 2; ++i) {
+      const int now = heap.top();
+      heap.pop();
+      heap.push(now + (deltas[static_cast<std::size_t>(i) & 0xffff] >> 12));
+    }
+    benchmark::DoNotOptimize(heap.top());
+  }
+  state.SetItemsProcessed(state.iterations() * trace_length);
+}
+
+// Fill to trace_length / 2 elements, then drain completely.
+template <typename HeapType>
+static void BM_FillDrainTrace(benchmark::State &state) {
+  const auto keys = random_keys(trace_length / 2, 3);
+  for (auto _ : state) {
+    HeapType heap;
+    for (int key : keys) {
+      heap.push(key);
+    }
+    long sum = 0;
+    while (!heap.empty()) {
+      sum += heap.top();
+      heap.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * trace_length);
+}
+
+// Bulk construction from an unordered range.
+template <typename HeapType> static void BM_Heapify(benchmark::State &state) {
+  const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 4);
+  for (auto _ : state) {
+    HeapType heap(keys.begin(), keys.end());
+    benchmark::DoNotOptimize(heap.top());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Dijkstra-style trace: pops interleaved with decrease_key on queued
+// entries, which std::priority_queue can only emulate with lazy deletion.
+template <std::size_t Arity>
+static void BM_DecreaseKeyTrace(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto keys = random_keys(size, 5);
+  std::mt19937 rng(6);
+  for (auto _ : state) {
+    state.PauseTiming();
+    Heap<int, std::greater<int>, Arity> heap(keys.begin(), keys.end());
+    state.ResumeTiming();
+    std::int64_t operations = 0;
+    while (operations < trace_length && !heap.empty()) {
+      const int floor = heap.top();
+      heap.pop();
+      for (int i = 0; i < 3 && !heap.empty(); ++i) {
+        const auto handle =
+            static_cast<typename decltype(heap)::handle_type>(rng() % size);
+        if (heap.contains(handle) && heap.value(handle) > floor + 1) {
+          heap.decrease_key(handle, floor + 1);
+        }
+      }
+      operations += 4;
+    }
+    benchmark::DoNotOptimize(heap.size());
+  }
+  state.SetItemsProcessed(state.iterations() * trace_length);
+}
+
+// Lazy-deletion equivalent: push a duplicate for each decrease and skip
+// stale entries on pop.
+static void BM_DecreaseKeyTraceStd(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto keys = random_keys(size, 5);
+  std::mt19937 rng(6);
+  using Entry = std::pair<int, std::uint32_t>;
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::vector<int> current(keys);
+    std::vector<bool> done(size, false);
+    std::vector<Entry> entries;
+    for (std::uint32_t i = 0; i < size; ++i) {
+      entries.emplace_back(keys[i], i);
+    }
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap(
+        std::greater<Entry>(), std::move(entries));
+    state.ResumeTiming();
+    std::int64_t operations = 0;
+    while (operations < trace_length && !heap.empty()) {
+      const auto [floor, id] = heap.top();
+      heap.pop();
+      if (done[id] || floor != current[id]) {
+        continue;
+      }
+      done[id] = true;
+      for (int i = 0; i < 3; ++i) {
+        const auto other = static_cast<std::uint32_t>(rng() % size);
+        if (!done[other] && current[other] > floor + 1) {
+          current[other] = floor + 1;
+          heap.emplace(floor + 1, other);
+        }
+      }
+      operations += 4;
+    }
+    benchmark::DoNotOptimize(heap.size());
+  }
+  state.SetItemsProcessed(state.iterations() * trace_length);
+}
+
+BENCHMARK_TEMPLATE(BM_HoldTrace, BinaryHeap)
+    ->Arg(1 << 10)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_HoldTrace, QuaternaryHeap)
+    ->Arg(1 << 10)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_HoldTrace, OctonaryHeap)
+    ->Arg(1 << 10)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_HoldTrace, StdHeap)
+    ->Arg(1 << 10)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_FillDrainTrace, BinaryHeap)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_FillDrainTrace, QuaternaryHeap)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_FillDrainTrace, OctonaryHeap)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_FillDrainTrace, StdHeap)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Heapify, BinaryHeap)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Heapify, QuaternaryHeap)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Heapify, StdHeap)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_DecreaseKeyTrace, 2)
+    ->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_DecreaseKeyTrace, 4)
+    ->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DecreaseKeyTraceStd)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,70 @@
+#include "../include/DoublyList.hpp"
+#include "../include/IndexedList.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+namespace {
+template <typename List> auto fill(List &list, std::int64_t count) -> void {
+  for (std::int64_t i = 0; i < count; ++i) {
+    list.add_back(static_cast<int>(i));
+  }
+}
+} // namespace
+
+template <typename List> static void BM_Insert(benchmark::State &state) {
+  for (auto _ : state) {
+    List list;
+    fill(list, state.range(0));
+    benchmark::DoNotOptimize(list.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Insert, DoublyList<int>)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(BM_Insert, IndexedDoublyList<int>)
+    ->Arg(1'000)
+    ->Arg(1'000'000);
+
+// Erases every other element through iterators, then refills the holes
+template <typename List> static void BM_EraseInsert(benchmark::State &state) {
+  List list;
+  fill(list, state.range(0));
+  for (auto _ : state) {
+    for (auto it = list.begin(); it != list.end();) {
+      it = list.erase(it);
+      if (it != list.end()) {
+        ++it;
+      }
+    }
+    for (auto it = list.begin(); it != list.end(); ++it) {
+      list.insert(it, 0);
+    }
+    benchmark::DoNotOptimize(list.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_EraseInsert, DoublyList<int>)
+    ->Arg(1'000)
+    ->Arg(1'000'000);
+BENCHMARK_TEMPLATE(BM_EraseInsert, IndexedDoublyList<int>)
+    ->Arg(1'000)
+    ->Arg(1'000'000);
+
+template <typename List> static void BM_Traverse(benchmark::State &state) {
+  List list;
+  fill(list, state.range(0));
+  for (auto _ : state) {
+    long long sum = 0;
+    for (const auto &value : list) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Traverse, DoublyList<int>)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(BM_Traverse, IndexedDoublyList<int>)
+    ->Arg(1'000)
+    ->Arg(1'000'000);
+BENCHMARK_TEMPLATE(BM_Traverse, IndexedList<int>)
+    ->Arg(1'000)
+    ->Arg(1'000'000);
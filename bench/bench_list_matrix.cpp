@@ -0,0 +1,133 @@
+#include "../include/ListMatrix.hpp"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+using Builder = ListMatrixBuilder<double>;
+using AdjacencyList =
+    std::vector<std::vector<std::pair<std::uint32_t, double>>>;
+
+// Pareto-distributed value >= minimum; shape 1.5 gives a mean of 3 *
+// minimum and a heavy tail of hubs.
+auto pareto(std::mt19937_64 &rng, double minimum) -> double {
+  const double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+  return minimum / std::pow(1.0 - u, 1.0 / 1.5);
+}
+
+// Square power-law matrix with n a power of two: row lengths and column
+// popularity both follow pareto(), and the odd multiplier scatters popular
+// columns over the index space like arbitrary vertex ids. Column ranks
+// start at 256 so that repeated cells within a row stay rare.
+auto power_law(std::size_t n) -> Builder {
+  std::mt19937_64 rng(42);
+  Builder builder(n, n);
+  builder.reserve(n * 12);
+  for (std::size_t row = 0; row < n; ++row) {
+    const auto degree =
+        std::min<std::size_t>(n, static_cast<std::size_t>(pareto(rng, 4.0)));
+    for (std::size_t i = 0; i < degree; ++i) {
+      const auto rank = std::min<std::size_t>(
+          n - 1, static_cast<std::size_t>(pareto(rng, 256.0)) - 256);
+      builder.insert(row, rank * 2654435761U & (n - 1), 1.0);
+    }
+  }
+  return builder;
+}
+
+auto as_adjacency_list(const Builder &builder) -> AdjacencyList {
+  AdjacencyList rows(builder.rows());
+  builder.for_each([&](std::size_t row, std::size_t col, double value) {
+    rows[row].emplace_back(static_cast<std::uint32_t>(col), value);
+  });
+  return rows;
+}
+
+auto set_nonzeros(benchmark::State &state, std::size_t nonzeros) -> void {
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                    nonzeros));
+}
+} // namespace
+
+// range(1) is the thread count, 0 meaning one per hardware thread.
+static void BM_SpmvCsr(benchmark::State &state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto threads = state.range(1) == 0
+                           ? std::thread::hardware_concurrency()
+                           : static_cast<std::size_t>(state.range(1));
+  const auto matrix = power_law(n).build();
+  const Vector<double> x(n, 1.0);
+  Vector<double> y(n);
+  for (auto _ : state) {
+    matrix.multiply(x.data(), y.data(), threads);
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+  set_nonzeros(state, matrix.nonzeros());
+}
+
+static void BM_SpmvCoo(benchmark::State &state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto builder = power_law(n);
+  const Vector<double> x(n, 1.0);
+  Vector<double> y(n);
+  for (auto _ : state) {
+    std::fill(y.data(), y.data() + n, 0.0);
+    builder.for_each([&](std::size_t row, std::size_t col, double value) {
+      y.data()[row] += value * x.data()[col];
+    });
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+  set_nonzeros(state, builder.build().nonzeros());
+}
+
+static void BM_SpmvAdjacencyList(benchmark::State &state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto builder = power_law(n);
+  const auto rows = as_adjacency_list(builder);
+  const Vector<double> x(n, 1.0);
+  Vector<double> y(n);
+  for (auto _ : state) {
+    for (std::size_t row = 0; row < n; ++row) {
+      double sum = 0.0;
+      for (const auto &[col, value] : rows[row]) {
+        sum += value * x.data()[col];
+      }
+      y.data()[row] = sum;
+    }
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+  set_nonzeros(state, builder.build().nonzeros());
+}
+
+static void BM_BuildCsr(benchmark::State &state) {
+  const auto builder = power_law(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(builder.build());
+  }
+  set_nonzeros(state, builder.size());
+}
+
+static void BM_Transpose(benchmark::State &state) {
+  const auto matrix =
+      power_law(static_cast<std::size_t>(state.range(0))).build();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(matrix.transpose());
+  }
+  set_nonzeros(state, matrix.nonzeros());
+}
+
+BENCHMARK(BM_SpmvCsr)
+    ->ArgsProduct({{1 << 16, 1 << 20}, {1}})
+    ->Args({1 << 20, 0});
+BENCHMARK(BM_SpmvCoo)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_SpmvAdjacencyList)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_BuildCsr)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_Transpose)->Arg(1 << 16)->Arg(1 << 20);
@@ -0,0 +1,97 @@
+#include "../include/LruCache.hpp"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+constexpr std::size_t key_universe = 100'000;
+constexpr std::size_t trace_length = 1 << 20;
+
+// Keys drawn from a Zipf distribution with the given skew over
+// [0, key_universe), so key k has probability proportional to 1 / (k + 1)^s.
+auto zipfian_trace(double skew, std::uint32_t seed) -> std::vector<int> {
+  std::vector<double> cdf(key_universe);
+  double total = 0.0;
+  for (std::size_t k = 0; k < key_universe; ++k) {
+    total += 1.0 / std::pow(static_cast<double>(k + 1), skew);
+    cdf[k] = total;
+  }
+
+  std::mt19937 engine{seed};
+  std::uniform_real_distribution<double> uniform(0.0, total);
+  std::vector<int> trace(trace_length);
+  for (auto &key : trace) {
+    key = static_cast<int>(
+        std::lower_bound(cdf.begin(), cdf.end(), uniform(engine)) -
+        cdf.begin());
+  }
+  return trace;
+}
+
+auto skew_of(const benchmark::State &state) -> double {
+  return static_cast<double>(state.range(1)) / 100.0;
+}
+} // namespace
+
+// Read-through workload: get, and put on a miss
+static void BM_LruCache_Zipfian(benchmark::State &state) {
+  const auto trace = zipfian_trace(skew_of(state), 42);
+  LruCache<int, int> cache(static_cast<std::size_t>(state.range(0)));
+  std::int64_t hits = 0;
+  std::size_t cursor = 0;
+  for (auto _ : state) {
+    const int key = trace[cursor++ & (trace_length - 1)];
+    if (const int *value = cache.get(key)) {
+      benchmark::DoNotOptimize(*value);
+      ++hits;
+    } else {
+      cache.put(key, key);
+    }
+  }
+  state.counters["hit_ratio"] = benchmark::Counter(
+      static_cast<double>(hits) / static_cast<double>(state.iterations()));
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LruCache_Zipfian)
+    ->ArgNames({"capacity", "skew_x100"})
+    ->ArgsProduct({{1'000, 10'000}, {80, 99, 120}});
+
+static void BM_ShardedLruCache_Zipfian(benchmark::State &state) {
+  static ShardedLruCache<int, int> *cache = nullptr;
+  if (state.thread_index() == 0) {
+    cache = new ShardedLruCache<int, int>(
+        static_cast<std::size_t>(state.range(0)), 16);
+  }
+  const auto trace = zipfian_trace(
+      skew_of(state), 42 + static_cast<std::uint32_t>(state.thread_index()));
+
+  std::int64_t hits = 0;
+  std::size_t cursor = 0;
+  for (auto _ : state) {
+    const int key = trace[cursor++ & (trace_length - 1)];
+    if (auto value = cache->get(key)) {
+      benchmark::DoNotOptimize(*value);
+      ++hits;
+    } else {
+      cache->put(key, key);
+    }
+  }
+  state.counters["hit_ratio"] = benchmark::Counter(
+      static_cast<double>(hits) / static_cast<double>(state.iterations()),
+      benchmark::Counter::kAvgThreads);
+  state.SetItemsProcessed(state.iterations());
+
+  if (state.thread_index() == 0) {
+    delete cache;
+    cache = nullptr;
+  }
+}
+BENCHMARK(BM_ShardedLruCache_Zipfian)
+    ->ArgNames({"capacity", "skew_x100"})
+    ->ArgsProduct({{10'000}, {99}})
+    ->Threads(1)
+    ->Threads(4)
+    ->UseRealTime();
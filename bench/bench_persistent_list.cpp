@@ -0,0 +1,69 @@
+#include "../include/PersistentList.hpp"
+#include "../include/SinglyList.hpp"
+#include "AllocationCounter.hpp"
+#include <benchmark/benchmark.h>
+
+// An event history of state.range(0) entries receives one new event per
+// iteration and a reader snapshot every state.range(1) updates. The
+// persistent list shares its nodes; SinglyList must deep copy.
+static void BM_SnapshotPersistent(benchmark::State &state) {
+  PersistentList<int> history;
+  for (int i = 0; i < state.range(0); ++i) {
+    history.add_front(i);
+  }
+  const auto before = bench::allocation_count;
+  int event = 0;
+  for (auto _ : state) {
+    history.add_front(event);
+    history.remove_front();
+    if (++event % state.range(1) == 0) {
+      auto snapshot = history.snapshot();
+      benchmark::DoNotOptimize(snapshot.top());
+    }
+  }
+  state.counters["allocs_per_update"] = benchmark::Counter(
+      static_cast<double>(bench::allocation_count - before) /
+      static_cast<double>(state.iterations()));
+}
+
+static void BM_SnapshotDeepCopy(benchmark::State &state) {
+  SinglyList<int> history;
+  for (int i = 0; i < state.range(0); ++i) {
+    history.add_front(i);
+  }
+  const auto before = bench::allocation_count;
+  int event = 0;
+  for (auto _ : state) {
+    history.add_front(event);
+    history.remove_front();
+    if (++event % state.range(1) == 0) {
+      SinglyList<int> snapshot(history);
+      benchmark::DoNotOptimize(snapshot.top());
+    }
+  }
+  state.counters["allocs_per_update"] = benchmark::Counter(
+      static_cast<double>(bench::allocation_count - before) /
+      static_cast<double>(state.iterations()));
+}
+
+BENCHMARK(BM_SnapshotPersistent)->ArgsProduct({{64, 4096}, {1, 16, 256}});
+BENCHMARK(BM_SnapshotDeepCopy)->ArgsProduct({{64, 4096}, {1, 16, 256}});
+
+// Cost of walking a version, which is the reader's side of the trade.
+template <typename List> static void BM_Traverse(benchmark::State &state) {
+  List list;
+  for (int i = 0; i < state.range(0); ++i) {
+    list.add_front(i);
+  }
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = list.cbegin(); it != list.cend(); ++it) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_Traverse, PersistentList<int>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_Traverse, SinglyList<int>)->Arg(4096);
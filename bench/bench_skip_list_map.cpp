@@ -0,0 +1,100 @@
+#include "../include/SkipListMap.hpp"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <map>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+using SkipMap = SkipListMap<int, int>;
+using StdMap = std::map<int, int>;
+
+auto shuffled_keys(std::size_t count) -> std::vector<int> {
+  std::vector<int> keys(count);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+  return keys;
+}
+
+template <typename Map> void fill(Map &map, const std::vector<int> &keys) {
+  for (int key : keys) {
+    map.emplace(key, key);
+  }
+}
+} // namespace
+
+template <typename Map> static void BM_InsertRandom(benchmark::State &state) {
+  const auto keys = shuffled_keys(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    Map map;
+    fill(map, keys);
+    benchmark::DoNotOptimize(map);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Map> static void BM_FindHit(benchmark::State &state) {
+  const auto keys = shuffled_keys(static_cast<std::size_t>(state.range(0)));
+  Map map;
+  fill(map, keys);
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.find(keys[i]));
+    i = i + 1 == keys.size() ? 0 : i + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Sums the values of 64 consecutive keys starting at a random key.
+template <typename Map> static void BM_RangeScan(benchmark::State &state) {
+  const auto keys = shuffled_keys(static_cast<std::size_t>(state.range(0)));
+  Map map;
+  fill(map, keys);
+  std::size_t i = 0;
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = map.lower_bound(keys[i]), last = map.lower_bound(keys[i] + 64);
+         it != last; ++it) {
+      sum += it->second;
+    }
+    benchmark::DoNotOptimize(sum);
+    i = i + 1 == keys.size() ? 0 : i + 1;
+  }
+  state.SetItemsProcessed(state.iterations() * 64);
+}
+
+BENCHMARK_TEMPLATE(BM_InsertRandom, SkipMap)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_InsertRandom, StdMap)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_FindHit, SkipMap)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_FindHit, StdMap)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_RangeScan, SkipMap)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_RangeScan, StdMap)->Arg(1 << 16);
+
+// Read-mostly index: every thread looks up pre-loaded keys while thread 0
+// keeps inserting new ones.
+static void BM_ConcurrentReadMostly(benchmark::State &state) {
+  static ConcurrentSkipListMap<int, int> *map = nullptr;
+  constexpr int preload = 1 << 16;
+  if (state.thread_index() == 0) {
+    map = new ConcurrentSkipListMap<int, int>();
+    for (int key : shuffled_keys(preload)) {
+      map->insert(key, key);
+    }
+  }
+  std::mt19937 rng(static_cast<unsigned>(state.thread_index()));
+  int next = preload + state.thread_index();
+  for (auto _ : state) {
+    if (state.thread_index() == 0 && (rng() & 15) == 0) {
+      map->insert(next, next);
+      next += 1;
+    } else {
+      benchmark::DoNotOptimize(map->find(static_cast<int>(rng() % preload)));
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    delete map;
+  }
+}
+BENCHMARK(BM_ConcurrentReadMostly)->ThreadRange(1, 8)->UseRealTime();
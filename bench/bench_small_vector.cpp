@@ -0,0 +1,67 @@
+#include "../include/ArrayStack.hpp"
+#include "../include/SmallVector.hpp"
+#include "AllocationCounter.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+namespace {
+// ArrayStack has to be sized for the deepest stack ever seen.
+using FixedStack = ArrayStack<int, 1024>;
+using SmallStack = GrowableStack<int, 16>;
+
+// std::vector behind the same push/pop/top interface.
+class VectorStack {
+  std::vector<int> m_data;
+
+public:
+  auto push(int value) -> void { m_data.push_back(value); }
+  auto pop() -> void { m_data.pop_back(); }
+  [[nodiscard]] auto top() const -> int { return m_data.back(); }
+};
+} // namespace
+
+// Creates a stack, pushes state.range(0) values and pops them again, as a
+// short-lived traversal stack would. Depths up to 16 stay inline in
+// GrowableStack; ArrayStack always allocates its full 1024-slot buffer.
+template <typename Stack> static void BM_StackLifetime(benchmark::State &state) {
+  const auto depth = static_cast<int>(state.range(0));
+  const auto before = bench::allocation_count;
+  for (auto _ : state) {
+    Stack stack;
+    for (int i = 0; i < depth; ++i) {
+      stack.push(i);
+    }
+    int sum = 0;
+    for (int i = 0; i < depth; ++i) {
+      sum += stack.top();
+      stack.pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.counters["allocs_per_stack"] = benchmark::Counter(
+      static_cast<double>(bench::allocation_count - before) /
+      static_cast<double>(state.iterations()));
+}
+
+BENCHMARK_TEMPLATE(BM_StackLifetime, SmallStack)->Arg(4)->Arg(16)->Arg(200);
+BENCHMARK_TEMPLATE(BM_StackLifetime, FixedStack)->Arg(4)->Arg(16)->Arg(200);
+BENCHMARK_TEMPLATE(BM_StackLifetime, VectorStack)->Arg(4)->Arg(16)->Arg(200);
+
+// Moving a vector that still fits inline versus a heap vector.
+template <typename VectorType>
+static void BM_MoveConstruct(benchmark::State &state) {
+  VectorType source;
+  for (int i = 0; i < state.range(0); ++i) {
+    source.push_back(i);
+  }
+  for (auto _ : state) {
+    VectorType moved(std::move(source));
+    benchmark::DoNotOptimize(moved.data());
+    source = std::move(moved);
+  }
+}
+
+using InlineInts = SmallVector<int, 16>;
+using StdInts = std::vector<int>;
+BENCHMARK_TEMPLATE(BM_MoveConstruct, InlineInts)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(BM_MoveConstruct, StdInts)->Arg(8)->Arg(64);
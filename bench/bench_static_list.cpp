@@ -0,0 +1,33 @@
+#include "../include/DoublyList.hpp"
+#include "../include/StaticList.hpp"
+#include "AllocationCounter.hpp"
+#include <benchmark/benchmark.h>
+
+namespace {
+constexpr std::size_t queue_depth = 64;
+
+using StaticQueue = StaticList<int, queue_depth>;
+using HeapQueue = DoublyList<int>;
+} // namespace
+
+// Steady-state producer/consumer cycle on a half-full list: every iteration
+// adds one element at the back and removes one from the front.
+template <typename List> static void BM_PushPopCycle(benchmark::State &state) {
+  List list;
+  for (std::size_t i = 0; i < queue_depth / 2; ++i) {
+    list.add_back(static_cast<int>(i));
+  }
+  const auto before = bench::allocation_count;
+  int value = 0;
+  for (auto _ : state) {
+    list.add_back(value++);
+    benchmark::DoNotOptimize(list.top());
+    list.erase(list.begin());
+  }
+  state.counters["allocs_per_op"] = benchmark::Counter(
+      static_cast<double>(bench::allocation_count - before) /
+      static_cast<double>(state.iterations()));
+}
+
+BENCHMARK_TEMPLATE(BM_PushPopCycle, StaticQueue);
+BENCHMARK_TEMPLATE(BM_PushPopCycle, HeapQueue);
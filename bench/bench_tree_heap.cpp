@@ -0,0 +1,128 @@
+#include "../include/Heap.hpp"
+#include "../include/TreeHeap.hpp"
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace {
+using PairingHeap = TreeHeap<int, std::greater<int>>;
+using BinaryHeap = Heap<int, std::greater<int>, 2>;
+using QuaternaryHeap = Heap<int, std::greater<int>, 4>;
+
+auto random_keys(std::size_t count, unsigned seed) -> std::vector<int> {
+  std::mt19937 rng(seed);
+  std::vector<int> keys(count);
+  for (auto &key : keys) {
+    key = static_cast<int>(rng() >> 1);
+  }
+  return keys;
+}
+
+// The array heap has no meld; the cheapest route through its interface is
+// to move the other heap over element by element.
+auto meld(PairingHeap &target, PairingHeap &source) -> void {
+  target.meld(source);
+}
+
+template <typename HeapType>
+auto meld(HeapType &target, HeapType &source) -> void {
+  target.reserve(target.size() + source.size());
+  while (!source.empty()) {
+    target.push(source.top());
+    source.pop();
+  }
+}
+} // namespace
+
+// Event merging: 64 queues of state.range(0) events each are melded
+// pairwise into one, firing the earliest event after every meld, and the
+// merged queue fires 64 more.
+template <typename HeapType> static void BM_MeldTrace(benchmark::State &state) {
+  constexpr std::size_t queue_count = 64;
+  const auto queue_size = static_cast<std::size_t>(state.range(0));
+  const auto keys = random_keys(queue_count * queue_size, 1);
+  for (auto _ : state) {
+    std::vector<HeapType> queues(queue_count);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      queues[i % queue_count].push(keys[i]);
+    }
+    for (std::size_t width = 1; width < queue_count; width *= 2) {
+      for (std::size_t i = 0; i + width < queue_count; i += 2 * width) {
+        meld(queues[i], queues[i + width]);
+        queues[i].pop();
+      }
+    }
+    long sum = 0;
+    for (std::size_t i = 0; i < queue_count; ++i) {
+      sum += queues[0].top();
+      queues[0].pop();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// Hold model on one queue: pop the earliest event and schedule a later
+// one. This is where the pairing heap pays for its pointer-based layout.
+template <typename HeapType> static void BM_HoldTrace(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto initial = random_keys(size, 2);
+  const auto deltas = random_keys(1 << 16, 3);
+  HeapType heap;
+  for (int key : initial) {
+    heap.push(key);
+  }
+  // The first pop of a pairing heap links all n roots; keep that one-off
+  // cost out of the steady state.
+  heap.push(heap.top());
+  heap.pop();
+  std::size_t step = 0;
+  for (auto _ : state) {
+    const int now = heap.top();
+    heap.pop();
+    heap.push(now + (deltas[step++ & 0xffff] >> 12));
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+
+// Timer rescheduling: every step pulls a pending timer earlier through its
+// handle, then fires the earliest one and arms a new timer.
+template <typename HeapType>
+static void BM_DecreaseKeyTrace(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto keys = random_keys(size, 4);
+  std::mt19937 rng(5);
+  HeapType heap;
+  std::vector<typename HeapType::handle_type> handles;
+  for (int key : keys) {
+    handles.push_back(heap.push(key));
+  }
+  for (auto _ : state) {
+    const auto slot = rng() % size;
+    const int now = heap.top();
+    if (heap.value(handles[slot]) > now) {
+      heap.decrease_key(handles[slot],
+                        now + (heap.value(handles[slot]) - now) / 2);
+    }
+    const auto fired = heap.top_handle();
+    heap.pop();
+    const auto armed = heap.push(now + static_cast<int>(rng() >> 12));
+    for (auto &handle : handles) {
+      if (handle == fired) {
+        handle = armed;
+        break;
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 3);
+}
+
+BENCHMARK_TEMPLATE(BM_MeldTrace, PairingHeap)->Range(1 << 6, 1 << 14);
+BENCHMARK_TEMPLATE(BM_MeldTrace, BinaryHeap)->Range(1 << 6, 1 << 14);
+BENCHMARK_TEMPLATE(BM_MeldTrace, QuaternaryHeap)->Range(1 << 6, 1 << 14);
+BENCHMARK_TEMPLATE(BM_HoldTrace, PairingHeap)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_HoldTrace, BinaryHeap)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_HoldTrace, QuaternaryHeap)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_DecreaseKeyTrace, PairingHeap)->Arg(1 << 8);
+BENCHMARK_TEMPLATE(BM_DecreaseKeyTrace, QuaternaryHeap)->Arg(1 << 8);
@@ -0,0 +1,130 @@
+#include "../include/TreeMap.hpp"
+#include "../include/TreeSet.hpp"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <map>
+#include <numeric>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace {
+using BTreeMap = TreeMap<int, int>;
+using StdMap = std::map<int, int>;
+using BTreeSet = TreeSet<int>;
+using StdSet = std::set<int>;
+
+auto shuffled_keys(std::size_t count) -> std::vector<int> {
+  std::vector<int> keys(count);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+  return keys;
+}
+
+auto fill(BTreeMap &map, const std::vector<int> &keys) -> void {
+  for (int key : keys) {
+    map.insert(key, key);
+  }
+}
+auto fill(StdMap &map, const std::vector<int> &keys) -> void {
+  for (int key : keys) {
+    map.emplace(key, key);
+  }
+}
+template <typename Set> auto fill(Set &set, const std::vector<int> &keys) {
+  for (int key : keys) {
+    set.insert(key);
+  }
+}
+
+// Loads count ascending entries the fastest way each container offers.
+auto load_sorted(BTreeMap &map, const std::vector<std::pair<int, int>> &sorted)
+    -> void {
+  map.assign_sorted(sorted.begin(), sorted.end());
+}
+auto load_sorted(StdMap &map, const std::vector<std::pair<int, int>> &sorted)
+    -> void {
+  for (const auto &entry : sorted) {
+    map.emplace_hint(map.end(), entry);
+  }
+}
+
+auto sum_range(const BTreeMap &map, int lo, int hi) -> long {
+  long sum = 0;
+  map.scan(lo, hi, [&](int, int value) { sum += value; });
+  return sum;
+}
+auto sum_range(const StdMap &map, int lo, int hi) -> long {
+  long sum = 0;
+  for (auto it = map.lower_bound(lo); it != map.end() && it->first < hi;
+       ++it) {
+    sum += it->second;
+  }
+  return sum;
+}
+} // namespace
+
+template <typename Map> static void BM_InsertRandom(benchmark::State &state) {
+  const auto keys = shuffled_keys(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    Map map;
+    fill(map, keys);
+    benchmark::DoNotOptimize(map);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Map> static void BM_FindHit(benchmark::State &state) {
+  const auto keys = shuffled_keys(static_cast<std::size_t>(state.range(0)));
+  Map map;
+  fill(map, keys);
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.find(keys[i]));
+    i = i + 1 == keys.size() ? 0 : i + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Sums the values of range(1) consecutive keys starting at a random key.
+template <typename Map> static void BM_RangeScan(benchmark::State &state) {
+  const auto keys = shuffled_keys(static_cast<std::size_t>(state.range(0)));
+  const auto length = static_cast<int>(state.range(1));
+  Map map;
+  fill(map, keys);
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sum_range(map, keys[i], keys[i] + length));
+    i = i + 1 == keys.size() ? 0 : i + 1;
+  }
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+template <typename Map> static void BM_LoadSorted(benchmark::State &state) {
+  std::vector<std::pair<int, int>> sorted;
+  for (int key = 0; key < state.range(0); ++key) {
+    sorted.emplace_back(key, key);
+  }
+  for (auto _ : state) {
+    Map map;
+    load_sorted(map, sorted);
+    benchmark::DoNotOptimize(map);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_InsertRandom, BTreeMap)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_InsertRandom, StdMap)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_FindHit, BTreeMap)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_FindHit, StdMap)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_FindHit, BTreeSet)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_FindHit, StdSet)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_RangeScan, BTreeMap)
+    ->Args({1 << 20, 16})
+    ->Args({1 << 20, 1024});
+BENCHMARK_TEMPLATE(BM_RangeScan, StdMap)
+    ->Args({1 << 20, 16})
+    ->Args({1 << 20, 1024});
+BENCHMARK_TEMPLATE(BM_LoadSorted, BTreeMap)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_LoadSorted, StdMap)->Arg(1 << 20);
@@ -0,0 +1,85 @@
+#include "../include/Vector.hpp"
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+namespace {
+using IntVector = Vector<int>;
+using IntVectorGolden = Vector<int, GoldenGrowth>;
+using StdIntVector = std::vector<int>;
+using StringVector = Vector<std::string>;
+using StdStringVector = std::vector<std::string>;
+
+// A 64-byte record: large enough that realloc versus element-wise moves
+// shows up during growth.
+struct Record {
+  long fields[8];
+};
+using RecordVector = Vector<Record>;
+using StdRecordVector = std::vector<Record>;
+
+template <typename T> auto make_value(int i) -> T { return T{i}; }
+template <> auto make_value<std::string>(int i) -> std::string {
+  return std::string(24, static_cast<char>('a' + i % 26));
+}
+} // namespace
+
+// push_back from empty, paying every reallocation on the way.
+template <typename VectorType> static void BM_PushBack(benchmark::State &state) {
+  using T = typename VectorType::value_type;
+  const auto value = make_value<T>(1);
+  for (auto _ : state) {
+    VectorType vector;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      vector.push_back(value);
+    }
+    benchmark::DoNotOptimize(vector.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Inserts a block of state.range(0) elements into the middle of a vector of
+// the same size.
+template <typename VectorType>
+static void BM_RangeInsert(benchmark::State &state) {
+  using T = typename VectorType::value_type;
+  const std::vector<T> block(static_cast<std::size_t>(state.range(0)),
+                             make_value<T>(2));
+  for (auto _ : state) {
+    VectorType vector(block.begin(), block.end());
+    vector.insert(vector.begin() + state.range(0) / 2, block.begin(),
+                  block.end());
+    benchmark::DoNotOptimize(vector.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// One reallocation of a full vector to twice its capacity.
+template <typename VectorType>
+static void BM_Reallocate(benchmark::State &state) {
+  using T = typename VectorType::value_type;
+  for (auto _ : state) {
+    state.PauseTiming();
+    VectorType vector(static_cast<std::size_t>(state.range(0)),
+                      make_value<T>(3));
+    vector.shrink_to_fit();
+    state.ResumeTiming();
+    vector.reserve(vector.size() * 2);
+    benchmark::DoNotOptimize(vector.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_PushBack, IntVector)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PushBack, IntVectorGolden)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PushBack, StdIntVector)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PushBack, StringVector)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_PushBack, StdStringVector)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_PushBack, RecordVector)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_PushBack, StdRecordVector)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_RangeInsert, IntVector)->Range(1 << 8, 1 << 18);
+BENCHMARK_TEMPLATE(BM_RangeInsert, StdIntVector)->Range(1 << 8, 1 << 18);
+BENCHMARK_TEMPLATE(BM_RangeInsert, StringVector)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_RangeInsert, StdStringVector)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_Reallocate, RecordVector)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_Reallocate, StdRecordVector)->Range(1 << 10, 1 << 18);
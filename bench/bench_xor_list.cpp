@@ -0,0 +1,84 @@
+#include "../include/DoublyList.hpp"
+#include "../include/XorList.hpp"
+#include "AllocationCounter.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+namespace {
+// A small queued record; with 16 bytes of payload a DoublyList node needs
+// 32 bytes and an XorList node 24.
+struct Record {
+  std::uint64_t key{0};
+  std::uint64_t stamp{0};
+};
+
+using XorRecords = XorList<Record>;
+using DoublyRecords = DoublyList<Record>;
+using XorWords = XorList<std::uint64_t>;
+using DoublyWords = DoublyList<std::uint64_t>;
+
+template <typename List> auto pop_front(List &list) -> void {
+  list.remove_front();
+}
+
+template <typename T> auto pop_front(DoublyList<T> &list) -> void {
+  list.erase(list.begin());
+}
+} // namespace
+
+// Builds a queue of state.range(0) records and reports the bytes requested
+// from the allocator per element (before allocator rounding).
+template <typename List> static void BM_Footprint(benchmark::State &state) {
+  double bytes_per_item = 0;
+  for (auto _ : state) {
+    const auto before = bench::allocated_bytes;
+    List list;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      list.emplace_back();
+    }
+    bytes_per_item = static_cast<double>(bench::allocated_bytes - before) /
+                     static_cast<double>(state.range(0));
+    benchmark::DoNotOptimize(list);
+  }
+  state.counters["bytes_per_item"] = bytes_per_item;
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Steady-state FIFO: one element in at the back, one out at the front.
+template <typename List> static void BM_QueueCycle(benchmark::State &state) {
+  List list;
+  for (std::int64_t i = 0; i < state.range(0); ++i) {
+    list.emplace_back();
+  }
+  for (auto _ : state) {
+    list.emplace_back();
+    pop_front(list);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Full walk, which is where a smaller node saves memory bandwidth.
+template <typename List> static void BM_Traverse(benchmark::State &state) {
+  List list;
+  for (std::int64_t i = 0; i < state.range(0); ++i) {
+    list.emplace_back();
+  }
+  for (auto _ : state) {
+    std::size_t count = 0;
+    for (const auto &value : list) {
+      benchmark::DoNotOptimize(&value);
+      ++count;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_Footprint, XorRecords)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Footprint, DoublyRecords)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Footprint, XorWords)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Footprint, DoublyWords)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_QueueCycle, XorRecords)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_QueueCycle, DoublyRecords)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Traverse, XorRecords)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_Traverse, DoublyRecords)->Arg(1 << 20);
@@ -0,0 +1,857 @@
+#ifndef __ARRAY_MATRIX_HPP__
+#define __ARRAY_MATRIX_HPP__
+
+#include "Parallel.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if (defined(__x86_64__) || defined(__i386__)) &&                             \
+    (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define ARRAY_MATRIX_AVX2 1
+// Kernels built for AVX2 and FMA whatever the compiler flags; they only run
+// after has_avx2() confirmed the CPU supports both.
+#define ARRAY_MATRIX_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#endif
+
+namespace details {
+// Register tile of the GEMM micro-kernel: gemm_mr rows of C by gemm_nr<T>
+// columns, two AVX2 vectors of float or double.
+inline constexpr std::size_t gemm_mr = 6;
+template <typename T>
+inline constexpr std::size_t gemm_nr =
+    std::clamp<std::size_t>(64 / sizeof(T), 4, 16);
+
+// Cache blocking: a gemm_kc-deep panel of B, gemm_nc columns wide, stays in
+// the last-level cache while gemm_mc rows of A packed to the same depth
+// stay in L2.
+inline constexpr std::size_t gemm_kc = 256;
+inline constexpr std::size_t gemm_mc = 120;
+inline constexpr std::size_t gemm_nc = 2048;
+
+static_assert(gemm_mc % gemm_mr == 0, "A blocks must hold whole strips");
+
+// Portable kernels, written with independent lanes so the compiler can
+// vectorize them for whatever instruction set it targets.
+
+// C[0..gemm_mr) x [0..gemm_nr) += A strip * B strip over depth steps.
+template <typename T>
+auto gemm_kernel_generic(std::size_t depth, const T *a, const T *b, T *c,
+                         std::size_t ldc) noexcept -> void {
+  constexpr std::size_t mr = gemm_mr;
+  constexpr std::size_t nr = gemm_nr<T>;
+  T acc[mr][nr] = {};
+  for (std::size_t p = 0; p < depth; ++p, a += mr, b += nr) {
+    for (std::size_t i = 0; i < mr; ++i) {
+      const T scale = a[i];
+      for (std::size_t j = 0; j < nr; ++j) {
+        acc[i][j] += scale * b[j];
+      }
+    }
+  }
+  for (std::size_t i = 0; i < mr; ++i) {
+    for (std::size_t j = 0; j < nr; ++j) {
+      c[i * ldc + j] += acc[i][j];
+    }
+  }
+}
+
+// y[first..last) = rows [first, last) of A times x.
+template <typename T>
+auto gemv_rows_generic(std::size_t first, std::size_t last, std::size_t cols,
+                       const T *a, std::size_t lda, const T *x, T *y) noexcept
+    -> void {
+  constexpr std::size_t lanes = 8;
+  for (std::size_t r = first; r < last; ++r) {
+    const T *row = a + r * lda;
+    T acc[lanes] = {};
+    std::size_t j = 0;
+    for (; j + lanes <= cols; j += lanes) {
+      for (std::size_t l = 0; l < lanes; ++l) {
+        acc[l] += row[j + l] * x[j + l];
+      }
+    }
+    T sum{};
+    for (std::size_t l = 0; l < lanes; ++l) {
+      sum += acc[l];
+    }
+    for (; j < cols; ++j) {
+      sum += row[j] * x[j];
+    }
+    y[r] = sum;
+  }
+}
+
+#ifdef ARRAY_MATRIX_AVX2
+[[nodiscard]] inline auto has_avx2() noexcept -> bool {
+#if defined(__AVX2__) && defined(__FMA__)
+  return true;
+#else
+  static const bool supported =
+      __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  return supported;
+#endif
+}
+
+// The handful of AVX2 operations the kernels need, per element type.
+struct Avx2Float {
+  using value_type = float;
+  using reg = __m256;
+  static constexpr std::size_t lanes = 8;
+
+  ARRAY_MATRIX_TARGET_AVX2 static auto zero() noexcept -> reg {
+    return _mm256_setzero_ps();
+  }
+  ARRAY_MATRIX_TARGET_AVX2 static auto load(const float *p) noexcept -> reg {
+    return _mm256_loadu_ps(p);
+  }
+  ARRAY_MATRIX_TARGET_AVX2 static auto store(float *p, reg v) noexcept
+      -> void {
+    _mm256_storeu_ps(p, v);
+  }
+  ARRAY_MATRIX_TARGET_AVX2 static auto broadcast(const float *p) noexcept
+      -> reg {
+    return _mm256_broadcast_ss(p);
+  }
+  ARRAY_MATRIX_TARGET_AVX2 static auto add(reg a, reg b) noexcept -> reg {
+    return _mm256_add_ps(a, b);
+  }
+  ARRAY_MATRIX_TARGET_AVX2 static auto fmadd(reg a, reg b, reg c) noexcept
+      -> reg {
+    return _mm256_fmadd_ps(a, b, c);
+  }
+  ARRAY_MATRIX_TARGET_AVX2 static auto sum(reg v) noexcept -> float {
+    __m128 half = _mm_add_ps(_mm256_castps256_ps128(v),
+                             _mm256_extractf128_ps(v, 1));
+    half = _mm_hadd_ps(half, half);
+    half = _mm_hadd_ps(half, half);
+    return _mm_cvtss_f32(half);
+  }
+};
+
+struct Avx2Double {
+  using value_type = double;
+  using reg = __m256d;
+  static constexpr std::size_t lanes = 4;
+
+  ARRAY_MATRIX_TARGET_AVX2 static auto zero() noexcept -> reg {
+    return _mm256_setzero_pd();
+  }
+  ARRAY_MATRIX_TARGET_AVX2 static auto load(const double *p) noexcept -> reg {
+    return _mm256_loadu_pd(p);
+  }
+  ARRAY_MATRIX_TARGET_AVX2 static auto store(double *p, reg v) noexcept
+      -> void {
+    _mm256_storeu_pd(p, v);
+  }
+  ARRAY_MATRIX_TARGET_AVX2 static auto broadcast(const double *p) noexcept
+      -> reg {
+    return _mm256_broadcast_sd(p);
+  }
+  ARRAY_MATRIX_TARGET_AVX2 static auto add(reg a, reg b) noexcept -> reg {
+    return _mm256_add_pd(a, b);
+  }
+  ARRAY_MATRIX_TARGET_AVX2 static auto fmadd(reg a, reg b, reg c) noexcept
+      -> reg {
+    return _mm256_fmadd_pd(a, b, c);
+  }
+  ARRAY_MATRIX_TARGET_AVX2 static auto sum(reg v) noexcept -> double {
+    const __m128d half = _mm_add_pd(_mm256_castpd256_pd128(v),
+                                    _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+  }
+};
+
+template <typename T> struct Avx2Of {
+  using type = void;
+};
+template <> struct Avx2Of<float> {
+  using type = Avx2Float;
+};
+template <> struct Avx2Of<double> {
+  using type = Avx2Double;
+};
+
+// gemm_kernel_generic with the whole C tile held in twelve registers.
+template <typename Simd>
+ARRAY_MATRIX_TARGET_AVX2 auto
+gemm_kernel_avx2(std::size_t depth, const typename Simd::value_type *a,
+                 const typename Simd::value_type *b,
+                 typename Simd::value_type *c, std::size_t ldc) noexcept
+    -> void {
+  using T = typename Simd::value_type;
+  using reg = typename Simd::reg;
+  constexpr std::size_t mr = gemm_mr;
+  constexpr std::size_t nr = gemm_nr<T>;
+  constexpr std::size_t width = nr / Simd::lanes;
+  reg acc[mr][width];
+  for (auto &row : acc) {
+    for (auto &lane : row) {
+      lane = Simd::zero();
+    }
+  }
+  for (std::size_t p = 0; p < depth; ++p, a += mr, b += nr) {
+    reg columns[width];
+    for (std::size_t w = 0; w < width; ++w) {
+      columns[w] = Simd::load(b + w * Simd::lanes);
+    }
+    for (std::size_t i = 0; i < mr; ++i) {
+      const reg scale = Simd::broadcast(a + i);
+      for (std::size_t w = 0; w < width; ++w) {
+        acc[i][w] = Simd::fmadd(scale, columns[w], acc[i][w]);
+      }
+    }
+  }
+  for (std::size_t i = 0; i < mr; ++i) {
+    for (std::size_t w = 0; w < width; ++w) {
+      T *out = c + i * ldc + w * Simd::lanes;
+      Simd::store(out, Simd::add(Simd::load(out), acc[i][w]));
+    }
+  }
+}
+
+// gemv_rows_generic over four rows at a time, sharing each load of x.
+template <typename Simd>
+ARRAY_MATRIX_TARGET_AVX2 auto
+gemv_rows_avx2(std::size_t first, std::size_t last, std::size_t cols,
+               const typename Simd::value_type *a, std::size_t lda,
+               const typename Simd::value_type *x,
+               typename Simd::value_type *y) noexcept -> void {
+  using T = typename Simd::value_type;
+  using reg = typename Simd::reg;
+  constexpr std::size_t block = 4;
+  std::size_t r = first;
+  for (; r + block <= last; r += block) {
+    reg acc[block];
+    for (auto &lane : acc) {
+      lane = Simd::zero();
+    }
+    std::size_t j = 0;
+    for (; j + Simd::lanes <= cols; j += Simd::lanes) {
+      const reg xs = Simd::load(x + j);
+      for (std::size_t b = 0; b < block; ++b) {
+        acc[b] = Simd::fmadd(Simd::load(a + (r + b) * lda + j), xs, acc[b]);
+      }
+    }
+    for (std::size_t b = 0; b < block; ++b) {
+      T sum = Simd::sum(acc[b]);
+      for (std::size_t tail = j; tail < cols; ++tail) {
+        sum += a[(r + b) * lda + tail] * x[tail];
+      }
+      y[r + b] = sum;
+    }
+  }
+  gemv_rows_generic(r, last, cols, a, lda, x, y);
+}
+#endif
+
+template <typename T>
+using gemm_kernel_t = void (*)(std::size_t, const T *, const T *, T *,
+                               std::size_t) noexcept;
+
+template <typename T>
+[[nodiscard]] auto select_gemm_kernel() noexcept -> gemm_kernel_t<T> {
+#ifdef ARRAY_MATRIX_AVX2
+  using Simd = typename Avx2Of<T>::type;
+  if constexpr (!std::is_void_v<Simd>) {
+    if (has_avx2()) {
+      return &gemm_kernel_avx2<Simd>;
+    }
+  }
+#endif
+  return &gemm_kernel_generic<T>;
+}
+
+// Copies rows x depth of A into gemm_mr-row strips stored column by column,
+// zero-padding the last strip.
+template <typename T>
+auto pack_a(std::size_t rows, std::size_t depth, const T *a, std::size_t lda,
+            T *packed) noexcept -> void {
+  for (std::size_t i0 = 0; i0 < rows; i0 += gemm_mr) {
+    const std::size_t height = std::min(gemm_mr, rows - i0);
+    for (std::size_t p = 0; p < depth; ++p) {
+      for (std::size_t i = 0; i < gemm_mr; ++i) {
+        *packed++ = i < height ? a[(i0 + i) * lda + p] : T{};
+      }
+    }
+  }
+}
+
+// Copies depth x cols of B into gemm_nr<T>-column strips stored row by row,
+// zero-padding the last strip.
+template <typename T>
+auto pack_b(std::size_t depth, std::size_t cols, const T *b, std::size_t ldb,
+            T *packed) noexcept -> void {
+  constexpr std::size_t nr = gemm_nr<T>;
+  for (std::size_t j0 = 0; j0 < cols; j0 += nr) {
+    const std::size_t width = std::min(nr, cols - j0);
+    for (std::size_t p = 0; p < depth; ++p) {
+      const T *source = b + p * ldb + j0;
+      for (std::size_t j = 0; j < nr; ++j) {
+        *packed++ = j < width ? source[j] : T{};
+      }
+    }
+  }
+}
+
+/**
+ * @brief C += A B for row-major A (m x k), B (k x n) and C (m x n), on one
+ * thread.
+ */
+template <typename T>
+auto gemm_serial(std::size_t m, std::size_t n, std::size_t k, const T *a,
+                 std::size_t lda, const T *b, std::size_t ldb, T *c,
+                 std::size_t ldc) -> void {
+  constexpr std::size_t mr = gemm_mr;
+  constexpr std::size_t nr = gemm_nr<T>;
+  if (m == 0 || n == 0 || k == 0) {
+    return;
+  }
+  const gemm_kernel_t<T> kernel = select_gemm_kernel<T>();
+  const std::size_t panel_cols = std::min(gemm_nc, (n + nr - 1) / nr * nr);
+  const std::size_t block_rows = std::min(gemm_mc, (m + mr - 1) / mr * mr);
+  Vector<T> packed_a(block_rows * std::min(gemm_kc, k));
+  Vector<T> packed_b(panel_cols * std::min(gemm_kc, k));
+  for (std::size_t jc = 0; jc < n; jc += gemm_nc) {
+    const std::size_t cols = std::min(gemm_nc, n - jc);
+    for (std::size_t pc = 0; pc < k; pc += gemm_kc) {
+      const std::size_t depth = std::min(gemm_kc, k - pc);
+      pack_b(depth, cols, b + pc * ldb + jc, ldb, packed_b.data());
+      for (std::size_t ic = 0; ic < m; ic += gemm_mc) {
+        const std::size_t rows = std::min(gemm_mc, m - ic);
+        pack_a(rows, depth, a + ic * lda + pc, lda, packed_a.data());
+        for (std::size_t jr = 0; jr < cols; jr += nr) {
+          const std::size_t width = std::min(nr, cols - jr);
+          for (std::size_t ir = 0; ir < rows; ir += mr) {
+            const std::size_t height = std::min(mr, rows - ir);
+            const T *strip_a = packed_a.data() + ir * depth;
+            const T *strip_b = packed_b.data() + jr * depth;
+            T *tile_c = c + (ic + ir) * ldc + jc + jr;
+            if (height == mr && width == nr) {
+              kernel(depth, strip_a, strip_b, tile_c, ldc);
+              continue;
+            }
+            // Edge tiles go through a full-size scratch tile.
+            T tile[mr * nr] = {};
+            kernel(depth, strip_a, strip_b, tile, nr);
+            for (std::size_t i = 0; i < height; ++i) {
+              for (std::size_t j = 0; j < width; ++j) {
+                tile_c[i * ldc + j] += tile[i * nr + j];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief C += A B, its rows split across thread_count threads.
+ *
+ * Each thread packs its own copy of the B panels, so threading pays off
+ * once every thread gets a few hundred rows.
+ */
+template <typename T>
+auto gemm(std::size_t m, std::size_t n, std::size_t k, const T *a,
+          std::size_t lda, const T *b, std::size_t ldb, T *c, std::size_t ldc,
+          std::size_t thread_count) -> void {
+  parallel_ranges(m, gemm_mc, thread_count,
+                  [&](std::size_t first, std::size_t last) {
+                    gemm_serial(last - first, n, k, a + first * lda, lda, b,
+                                ldb, c + first * ldc, ldc);
+                  });
+}
+
+/**
+ * @brief y = A x for row-major A (rows x cols).
+ */
+template <typename T>
+auto gemv(std::size_t rows, std::size_t cols, const T *a, std::size_t lda,
+          const T *x, T *y, std::size_t thread_count) -> void {
+  parallel_ranges(rows, 256, thread_count,
+                  [&](std::size_t first, std::size_t last) {
+#ifdef ARRAY_MATRIX_AVX2
+                    using Simd = typename Avx2Of<T>::type;
+                    if constexpr (!std::is_void_v<Simd>) {
+                      if (has_avx2()) {
+                        gemv_rows_avx2<Simd>(first, last, cols, a, lda, x, y);
+                        return;
+                      }
+                    }
+#endif
+                    gemv_rows_generic(first, last, cols, a, lda, x, y);
+                  });
+}
+
+/**
+ * @brief out = transpose of row-major A (rows x cols), one square tile at
+ * a time so that both the reads and the writes stay within a few cache
+ * lines.
+ */
+template <typename T>
+auto transpose(std::size_t rows, std::size_t cols, const T *a,
+               std::size_t lda, T *out, std::size_t ldo) noexcept -> void {
+  constexpr std::size_t tile = 8;
+  for (std::size_t i0 = 0; i0 < rows; i0 += tile) {
+    const std::size_t i1 = std::min(rows, i0 + tile);
+    for (std::size_t j0 = 0; j0 < cols; j0 += tile) {
+      const std::size_t j1 = std::min(cols, j0 + tile);
+      for (std::size_t i = i0; i < i1; ++i) {
+        for (std::size_t j = j0; j < j1; ++j) {
+          out[j * ldo + i] = a[i * lda + j];
+        }
+      }
+    }
+  }
+}
+
+// Product of row-major A (m x k) and B (k x n) into the zeroed C, taking
+// the matrix-vector path when B is a single column.
+template <typename T>
+auto multiply(std::size_t m, std::size_t n, std::size_t k, const T *a,
+              const T *b, T *c, std::size_t thread_count) -> void {
+  if (n == 1) {
+    gemv(m, k, a, k, b, c, thread_count);
+  } else {
+    gemm(m, n, k, a, k, b, n, c, n, thread_count);
+  }
+}
+} // namespace details
+
+/**
+ * @brief Dense matrix of runtime size with contiguous row-major storage
+ *
+ * @tparam T The arithmetic element type
+ *
+ * Products run a cache-blocked GEMM: panels of both operands are packed
+ * into contiguous strips and a register-tiled micro-kernel accumulates a
+ * 6-row tile of the result at a time. For float and double the kernels use
+ * AVX2 and FMA when the CPU supports them, checked once at run time, and
+ * otherwise fall back to portable loops the compiler can vectorize.
+ * Products and matrix-vector products take an optional thread count that
+ * splits the rows of the result across threads; the default runs on the
+ * calling thread only.
+ *
+ * Complexity guarantees:
+ * - operator()(), at(), row(): O(1)
+ * - multiply() by a matrix: O(rows * cols * other.cols())
+ * - multiply() by a vector, transpose(), operator==(): O(rows * cols)
+ * - rows(), cols(), size(): O(1)
+ *
+ * @example
+ * Matrix<float> a{{1, 2}, {3, 4}};
+ * Matrix<float> b = a.transpose();
+ * Matrix<float> c = a.multiply(b, std::thread::hardware_concurrency());
+ * assert(c(1, 0) == 11);
+ */
+template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+class Matrix {
+public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using size_type = std::size_t;
+
+private:
+  size_type m_rows{0};
+  size_type m_cols{0};
+  Vector<T> m_data;
+
+public:
+  Matrix() = default;
+
+  /**
+   * @brief Zero-filled rows x cols matrix.
+   */
+  Matrix(size_type rows, size_type cols)
+      : m_rows(rows), m_cols(cols), m_data(rows * cols) {}
+
+  Matrix(size_type rows, size_type cols, const T &value)
+      : m_rows(rows), m_cols(cols), m_data(rows * cols, value) {}
+
+  Matrix(const Matrix &other) = default;
+
+  /**
+   * @brief Takes other's elements and leaves other a 0 x 0 matrix.
+   */
+  Matrix(Matrix &&other) noexcept
+      : m_rows(std::exchange(other.m_rows, 0)),
+        m_cols(std::exchange(other.m_cols, 0)),
+        m_data(std::move(other.m_data)) {}
+
+  /**
+   * @brief Matrix with the given rows, which must all be equally long.
+   */
+  Matrix(std::initializer_list<std::initializer_list<T>> rows)
+      : m_rows(rows.size()),
+        m_cols(rows.size() == 0 ? 0 : rows.begin()->size()) {
+    m_data.reserve(m_rows * m_cols);
+    for (const auto &row : rows) {
+      if (row.size() != m_cols) {
+        throw std::invalid_argument("Matrix rows differ in length");
+      }
+      for (const T &value : row) {
+        m_data.push_back(value);
+      }
+    }
+  }
+
+  auto operator=(const Matrix &other) -> Matrix & = default;
+
+  auto operator=(Matrix &&other) noexcept -> Matrix & {
+    Matrix temp(std::move(other));
+    swap(temp);
+    return *this;
+  }
+
+  ~Matrix() = default;
+
+  [[nodiscard]] static auto identity(size_type size) -> Matrix {
+    Matrix result(size, size);
+    for (size_type i = 0; i < size; ++i) {
+      result(i, i) = T{1};
+    }
+    return result;
+  }
+
+  // Element access
+  /**
+   * @brief Element at (row, col), without bounds checking.
+   */
+  [[nodiscard]] auto operator()(size_type row, size_type col) noexcept
+      -> reference {
+    return m_data.data()[row * m_cols + col];
+  }
+
+  [[nodiscard]] auto operator()(size_type row, size_type col) const noexcept
+      -> const_reference {
+    return m_data.data()[row * m_cols + col];
+  }
+
+  [[nodiscard]] auto at(size_type row, size_type col) -> reference {
+    check_index(row, col);
+    return (*this)(row, col);
+  }
+
+  [[nodiscard]] auto at(size_type row, size_type col) const
+      -> const_reference {
+    check_index(row, col);
+    return (*this)(row, col);
+  }
+
+  /**
+   * @brief First of the cols() contiguous elements of row.
+   */
+  [[nodiscard]] auto row(size_type row) noexcept -> pointer {
+    return m_data.data() + row * m_cols;
+  }
+
+  [[nodiscard]] auto row(size_type row) const noexcept -> const_pointer {
+    return m_data.data() + row * m_cols;
+  }
+
+  [[nodiscard]] auto data() noexcept -> pointer { return m_data.data(); }
+  [[nodiscard]] auto data() const noexcept -> const_pointer {
+    return m_data.data();
+  }
+
+  // Operations
+  auto fill(const T &value) noexcept -> void {
+    std::fill(m_data.data(), m_data.data() + m_data.size(), value);
+  }
+
+  [[nodiscard]] auto transpose() const -> Matrix {
+    Matrix result(m_cols, m_rows);
+    details::transpose(m_rows, m_cols, data(), m_cols, result.data(),
+                       m_rows);
+    return result;
+  }
+
+  /**
+   * @brief Product with other, whose rows() must equal cols().
+   *
+   * @param thread_count threads to split the result rows across
+   * @throws std::invalid_argument if the dimensions do not match
+   */
+  [[nodiscard]] auto multiply(const Matrix &other,
+                              size_type thread_count = 1) const -> Matrix {
+    if (m_cols != other.m_rows) {
+      throw std::invalid_argument("Matrix dimensions do not match");
+    }
+    Matrix result(m_rows, other.m_cols);
+    details::multiply(m_rows, other.m_cols, m_cols, data(), other.data(),
+                      result.data(), thread_count);
+    return result;
+  }
+
+  /**
+   * @brief Product with the column vector x of cols() elements.
+   *
+   * @throws std::invalid_argument if the dimensions do not match
+   */
+  [[nodiscard]] auto multiply(const Vector<T> &x,
+                              size_type thread_count = 1) const -> Vector<T> {
+    if (m_cols != x.size()) {
+      throw std::invalid_argument("Matrix dimensions do not match");
+    }
+    Vector<T> y(m_rows);
+    details::gemv(m_rows, m_cols, data(), m_cols, x.data(), y.data(),
+                  thread_count);
+    return y;
+  }
+
+  [[nodiscard]] auto operator*(const Matrix &other) const -> Matrix {
+    return multiply(other);
+  }
+
+  [[nodiscard]] auto operator*(const Vector<T> &x) const -> Vector<T> {
+    return multiply(x);
+  }
+
+  [[nodiscard]] auto operator==(const Matrix &other) const noexcept -> bool {
+    return m_rows == other.m_rows && m_cols == other.m_cols &&
+           std::equal(data(), data() + size(), other.data());
+  }
+
+  [[nodiscard]] auto operator!=(const Matrix &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+  auto swap(Matrix &other) noexcept -> void {
+    using std::swap;
+    swap(m_rows, other.m_rows);
+    swap(m_cols, other.m_cols);
+    swap(m_data, other.m_data);
+  }
+
+  // Capacity
+  [[nodiscard]] auto rows() const noexcept -> size_type { return m_rows; }
+  [[nodiscard]] auto cols() const noexcept -> size_type { return m_cols; }
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return m_data.size();
+  }
+  [[nodiscard]] auto is_empty() const noexcept -> bool {
+    return m_data.is_empty();
+  }
+
+private:
+  auto check_index(size_type row, size_type col) const -> void {
+    if (row >= m_rows || col >= m_cols) {
+      throw std::out_of_range("Matrix index out of bounds");
+    }
+  }
+};
+
+/**
+ * @brief Dense Rows x Cols matrix with dimensions fixed at compile time
+ *
+ * @tparam T The arithmetic element type
+ * @tparam Rows The number of rows, must be > 0
+ * @tparam Cols The number of columns, must be > 0
+ *
+ * Stores its elements row-major in one heap block like Array, and runs the
+ * same kernels as Matrix; mismatched products fail to compile instead of
+ * throwing. A product with an ArrayMatrix<T, Cols, 1> is a matrix-vector
+ * product.
+ *
+ * Complexity guarantees:
+ * - operator()(), at(), row(): O(1)
+ * - multiply(): O(Rows * Cols * K) for a Cols x K operand
+ * - transpose(), operator==(): O(Rows * Cols)
+ * - rows(), cols(), size(): O(1)
+ *
+ * @example
+ * ArrayMatrix<double, 2, 3> a{{1, 2, 3}, {4, 5, 6}};
+ * ArrayMatrix<double, 3, 1> x{{1}, {1}, {1}};
+ * ArrayMatrix<double, 2, 1> y = a * x;
+ * assert(y(1, 0) == 15);
+ */
+template <typename T, std::size_t Rows, std::size_t Cols,
+          typename = std::enable_if_t<(Rows > 0 && Cols > 0)>,
+          typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+class ArrayMatrix {
+public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using size_type = std::size_t;
+
+private:
+  Vector<T> m_data;
+
+public:
+  /**
+   * @brief Zero-filled matrix.
+   */
+  ArrayMatrix() : m_data(Rows * Cols) {}
+
+  explicit ArrayMatrix(const T &value) : m_data(Rows * Cols, value) {}
+
+  ArrayMatrix(const ArrayMatrix &other) = default;
+
+  /**
+   * @brief Takes other's block and leaves other a fresh zero matrix.
+   *
+   * The dimensions are part of the type, so a moved-from matrix still needs
+   * Rows * Cols elements; providing them allocates, so this can throw.
+   */
+  ArrayMatrix(ArrayMatrix &&other) : ArrayMatrix() { swap(other); }
+
+  auto operator=(const ArrayMatrix &other) -> ArrayMatrix & = default;
+
+  /**
+   * @brief Exchanges the elements with other.
+   */
+  auto operator=(ArrayMatrix &&other) noexcept -> ArrayMatrix & {
+    swap(other);
+    return *this;
+  }
+
+  ~ArrayMatrix() = default;
+
+  /**
+   * @brief Matrix starting with the given rows; missing rows and columns
+   * are zero.
+   *
+   * @throws std::length_error if the list has more than Rows rows or a row
+   * has more than Cols elements
+   */
+  ArrayMatrix(std::initializer_list<std::initializer_list<T>> rows)
+      : m_data(Rows * Cols) {
+    if (rows.size() > Rows) {
+      throw std::length_error("Initializer list size exceeds matrix rows");
+    }
+    size_type r = 0;
+    for (const auto &values : rows) {
+      if (values.size() > Cols) {
+        throw std::length_error("Initializer list size exceeds matrix cols");
+      }
+      std::copy(values.begin(), values.end(), row(r++));
+    }
+  }
+
+  [[nodiscard]] static auto identity() -> ArrayMatrix {
+    static_assert(Rows == Cols, "Identity matrix must be square");
+    ArrayMatrix result;
+    for (size_type i = 0; i < Rows; ++i) {
+      result(i, i) = T{1};
+    }
+    return result;
+  }
+
+  // Element access
+  /**
+   * @brief Element at (row, col), without bounds checking.
+   */
+  [[nodiscard]] auto operator()(size_type row, size_type col) noexcept
+      -> reference {
+    return m_data.data()[row * Cols + col];
+  }
+
+  [[nodiscard]] auto operator()(size_type row, size_type col) const noexcept
+      -> const_reference {
+    return m_data.data()[row * Cols + col];
+  }
+
+  [[nodiscard]] auto at(size_type row, size_type col) -> reference {
+    check_index(row, col);
+    return (*this)(row, col);
+  }
+
+  [[nodiscard]] auto at(size_type row, size_type col) const
+      -> const_reference {
+    check_index(row, col);
+    return (*this)(row, col);
+  }
+
+  [[nodiscard]] auto row(size_type row) noexcept -> pointer {
+    return m_data.data() + row * Cols;
+  }
+
+  [[nodiscard]] auto row(size_type row) const noexcept -> const_pointer {
+    return m_data.data() + row * Cols;
+  }
+
+  [[nodiscard]] auto data() noexcept -> pointer { return m_data.data(); }
+  [[nodiscard]] auto data() const noexcept -> const_pointer {
+    return m_data.data();
+  }
+
+  // Operations
+  auto fill(const T &value) noexcept -> void {
+    std::fill(m_data.data(), m_data.data() + m_data.size(), value);
+  }
+
+  [[nodiscard]] auto transpose() const -> ArrayMatrix<T, Cols, Rows> {
+    ArrayMatrix<T, Cols, Rows> result;
+    details::transpose(Rows, Cols, data(), Cols, result.data(), Rows);
+    return result;
+  }
+
+  /**
+   * @brief Product with other.
+   *
+   * @param thread_count threads to split the result rows across
+   */
+  template <std::size_t K>
+  [[nodiscard]] auto multiply(const ArrayMatrix<T, Cols, K> &other,
+                              size_type thread_count = 1) const
+      -> ArrayMatrix<T, Rows, K> {
+    ArrayMatrix<T, Rows, K> result;
+    details::multiply(Rows, K, Cols, data(), other.data(), result.data(),
+                      thread_count);
+    return result;
+  }
+
+  template <std::size_t K>
+  [[nodiscard]] auto operator*(const ArrayMatrix<T, Cols, K> &other) const
+      -> ArrayMatrix<T, Rows, K> {
+    return multiply(other);
+  }
+
+  [[nodiscard]] auto operator==(const ArrayMatrix &other) const noexcept
+      -> bool {
+    return std::equal(data(), data() + size(), other.data());
+  }
+
+  [[nodiscard]] auto operator!=(const ArrayMatrix &other) const noexcept
+      -> bool {
+    return !(*this == other);
+  }
+
+  auto swap(ArrayMatrix &other) noexcept -> void {
+    using std::swap;
+    swap(m_data, other.m_data);
+  }
+
+  // Capacity
+  [[nodiscard]] static constexpr auto rows() noexcept -> size_type {
+    return Rows;
+  }
+  [[nodiscard]] static constexpr auto cols() noexcept -> size_type {
+    return Cols;
+  }
+  [[nodiscard]] static constexpr auto size() noexcept -> size_type {
+    return Rows * Cols;
+  }
+
+private:
+  auto check_index(size_type row, size_type col) const -> void {
+    if (row >= Rows || col >= Cols) {
+      throw std::out_of_range("Matrix index out of bounds");
+    }
+  }
+};
+
+#endif // __ARRAY_MATRIX_HPP__
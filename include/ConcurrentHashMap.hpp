@@ -0,0 +1,717 @@
+#ifndef __CONCURRENT_HASH_MAP_HPP__
+#define __CONCURRENT_HASH_MAP_HPP__
+
+#include "HashMap.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace details {
+/**
+ * @brief Loads and stores of memory that seqlock readers copy while a
+ * writer may be changing it.
+ *
+ * A reader keeps such a copy only if the shard's sequence number did not
+ * change meanwhile. Word-sized relaxed atomic accesses keep the overlapping
+ * reads and writes free of data races on GCC and Clang; other compilers
+ * fall back to memcpy.
+ */
+template <typename T>
+using racy_word_t = std::conditional_t<
+    alignof(T) % 8 == 0 && sizeof(T) % 8 == 0, std::uint64_t,
+    std::conditional_t<alignof(T) % 4 == 0 && sizeof(T) % 4 == 0,
+                       std::uint32_t, unsigned char>>;
+
+template <typename T> auto racy_load(const T &src) noexcept -> T {
+  static_assert(std::is_trivially_copyable_v<T>);
+  using Word = racy_word_t<T>;
+  constexpr std::size_t words = sizeof(T) / sizeof(Word);
+  Word buffer[words];
+#if defined(__GNUC__) || defined(__clang__)
+  const auto *in = reinterpret_cast<const Word *>(std::addressof(src));
+  for (std::size_t i = 0; i < words; ++i) {
+    buffer[i] = __atomic_load_n(in + i, __ATOMIC_RELAXED);
+  }
+#else
+  std::memcpy(buffer, std::addressof(src), sizeof(T));
+#endif
+  T out;
+  std::memcpy(static_cast<void *>(std::addressof(out)), buffer, sizeof(T));
+  return out;
+}
+
+template <typename T> auto racy_store(T &dst, const T &value) noexcept -> void {
+  static_assert(std::is_trivially_copyable_v<T>);
+  using Word = racy_word_t<T>;
+  constexpr std::size_t words = sizeof(T) / sizeof(Word);
+  Word buffer[words];
+  std::memcpy(buffer, std::addressof(value), sizeof(T));
+#if defined(__GNUC__) || defined(__clang__)
+  auto *out = reinterpret_cast<Word *>(std::addressof(dst));
+  for (std::size_t i = 0; i < words; ++i) {
+    __atomic_store_n(out + i, buffer[i], __ATOMIC_RELAXED);
+  }
+#else
+  std::memcpy(static_cast<void *>(std::addressof(dst)), buffer, sizeof(T));
+#endif
+}
+
+template <typename Key, typename Value> struct ConcurrentSlot {
+  Key key;
+  Value value;
+};
+
+/**
+ * @brief Open-addressing table of one ConcurrentHashMap shard: a header,
+ * one control byte per slot (0 for empty, 0x80 | 7 hash bits for full) and
+ * the slots, in a single allocation.
+ */
+template <typename Slot> struct ConcurrentTable {
+  std::size_t capacity;
+  ConcurrentTable *retired;
+  std::uint8_t *ctrl;
+  Slot *slots;
+
+  static auto create(std::size_t capacity) -> ConcurrentTable * {
+    const std::size_t ctrl_offset = sizeof(ConcurrentTable);
+    const std::size_t slot_offset =
+        (ctrl_offset + capacity + alignof(Slot) - 1) / alignof(Slot) *
+        alignof(Slot);
+    constexpr std::size_t alignment = alignof(Slot) > alignof(ConcurrentTable)
+                                          ? alignof(Slot)
+                                          : alignof(ConcurrentTable);
+    auto *block = static_cast<unsigned char *>(::operator new(
+        slot_offset + capacity * sizeof(Slot), std::align_val_t{alignment}));
+    auto *table = ::new (static_cast<void *>(block)) ConcurrentTable{
+        capacity, nullptr, block + ctrl_offset,
+        reinterpret_cast<Slot *>(block + slot_offset)};
+    std::memset(table->ctrl, 0, capacity);
+    return table;
+  }
+
+  static auto destroy(ConcurrentTable *table) noexcept -> void {
+    constexpr std::size_t alignment = alignof(Slot) > alignof(ConcurrentTable)
+                                          ? alignof(Slot)
+                                          : alignof(ConcurrentTable);
+    ::operator delete(static_cast<void *>(table), std::align_val_t{alignment});
+  }
+};
+} // namespace details
+
+/**
+ * @brief Hash map split into independently locked shards, with lock-free
+ * optimistic reads
+ *
+ * @tparam Key Key type
+ * @tparam Value Mapped type
+ * @tparam Hash Hash function
+ * @tparam KeyEqual Key equality
+ *
+ * A key's hash picks one of a power-of-two number of shards. Each shard is
+ * a linear-probing table guarded by a mutex for writers and a sequence
+ * number (a seqlock). Writers make the sequence odd while they change the
+ * table. When Key and Value are trivially copyable, get() and contains()
+ * take no lock: they copy what they need and retry if the sequence moved,
+ * so readers never write shared memory and never wait for each other. A
+ * reader that keeps losing to writers takes the shard lock after a few
+ * attempts. Tables replaced by growth stay allocated until the map is
+ * destroyed, because a reader may still be reading them; they add up to
+ * less than the live tables. Other key and value types are read under the
+ * shard lock.
+ *
+ * Lookups return copies, and callbacks passed to compute_if_absent(),
+ * update() and the for_each visitors run while their shard is locked. The
+ * map is neither copyable nor movable.
+ *
+ * Complexity guarantees:
+ * - get(), contains(): O(1) average
+ * - insert(), insert_or_assign(), compute_if_absent(): O(1) amortized
+ * - erase(), update(): O(1) average
+ * - for_each(), parallel_for_each(): O(n + capacity)
+ * - size(): O(shards)
+ *
+ * @example
+ * ConcurrentHashMap<std::uint64_t, double> prices(64);
+ * prices.insert(7, 9.5);
+ * // from any number of threads:
+ * if (auto price = prices.get(7)) { use(*price); }
+ * prices.compute_if_absent(8, [](std::uint64_t) { return load_price(8); });
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class ConcurrentHashMap {
+public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  /**
+   * @brief Whether get() and contains() read without locking.
+   */
+  static constexpr bool optimistic_reads =
+      std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<Value> &&
+      std::is_default_constructible_v<Key> &&
+      std::is_default_constructible_v<Value>;
+
+private:
+  using Slot = details::ConcurrentSlot<Key, Value>;
+  using Table = details::ConcurrentTable<Slot>;
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+  static constexpr size_type min_capacity = 16;
+  static constexpr int optimistic_attempts = 8;
+
+  struct alignas(64) Shard {
+    std::atomic<std::uint64_t> sequence{0};
+    std::atomic<Table *> table{nullptr};
+    std::atomic<size_type> size{0};
+    std::mutex mutex;
+  };
+
+  // Makes the shard sequence odd for the lifetime of a write.
+  class WriteSection {
+    Shard &m_shard;
+
+  public:
+    explicit WriteSection(Shard &shard) noexcept : m_shard(shard) {
+      if constexpr (optimistic_reads) {
+        m_shard.sequence.store(
+            m_shard.sequence.load(std::memory_order_relaxed) + 1,
+            std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+      }
+    }
+    WriteSection(const WriteSection &) = delete;
+    auto operator=(const WriteSection &) -> WriteSection & = delete;
+    ~WriteSection() {
+      if constexpr (optimistic_reads) {
+        m_shard.sequence.store(
+            m_shard.sequence.load(std::memory_order_relaxed) + 1,
+            std::memory_order_release);
+      }
+    }
+  };
+
+  std::unique_ptr<Shard[]> m_shards;
+  size_type m_shard_count;
+  unsigned m_shard_bits{0};
+  Hash m_hash;
+  KeyEqual m_equal;
+
+public:
+  /**
+   * @param shard_count Number of shards, rounded up to a power of two;
+   * must be > 0
+   */
+  explicit ConcurrentHashMap(size_type shard_count = 64,
+                             const Hash &hash = Hash(),
+                             const KeyEqual &equal = KeyEqual())
+      : m_hash(hash), m_equal(equal) {
+    if (shard_count == 0 || shard_count > (size_type{1} << 16)) {
+      throw std::invalid_argument("Shard count must be in [1, 65536]");
+    }
+    while ((size_type{1} << m_shard_bits) < shard_count) {
+      ++m_shard_bits;
+    }
+    m_shard_count = size_type{1} << m_shard_bits;
+    m_shards = std::make_unique<Shard[]>(m_shard_count);
+  }
+
+  ConcurrentHashMap(const ConcurrentHashMap &) = delete;
+  auto operator=(const ConcurrentHashMap &) -> ConcurrentHashMap & = delete;
+
+  ~ConcurrentHashMap() {
+    for (size_type i = 0; i < m_shard_count; ++i) {
+      Table *table = m_shards[i].table.load(std::memory_order_relaxed);
+      if (table != nullptr) {
+        destroy_slots(table);
+      }
+      while (table != nullptr) {
+        Table *retired = table->retired;
+        Table::destroy(table);
+        table = retired;
+      }
+    }
+  }
+
+  // Lookup
+  /**
+   * @brief Returns a copy of the value for key, if present.
+   */
+  [[nodiscard]] auto get(const Key &key) const -> std::optional<Value> {
+    const size_type hash = hash_of(key);
+    Shard &shard = shard_for(hash);
+    if constexpr (optimistic_reads) {
+      for (int attempt = 0; attempt < optimistic_attempts; ++attempt) {
+        const std::uint64_t sequence =
+            shard.sequence.load(std::memory_order_acquire);
+        if ((sequence & 1) != 0) {
+          std::this_thread::yield();
+          continue;
+        }
+        std::optional<Value> result;
+        const Table *table = shard.table.load(std::memory_order_acquire);
+        if (const size_type at = find_index(table, key, hash); at != npos) {
+          result = details::racy_load(table->slots[at].value);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (shard.sequence.load(std::memory_order_relaxed) == sequence) {
+          return result;
+        }
+      }
+    }
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const Table *table = shard.table.load(std::memory_order_relaxed);
+    const size_type at = find_index(table, key, hash);
+    if (at == npos) {
+      return std::nullopt;
+    }
+    return table->slots[at].value;
+  }
+
+  [[nodiscard]] auto contains(const Key &key) const -> bool {
+    const size_type hash = hash_of(key);
+    Shard &shard = shard_for(hash);
+    if constexpr (optimistic_reads) {
+      for (int attempt = 0; attempt < optimistic_attempts; ++attempt) {
+        const std::uint64_t sequence =
+            shard.sequence.load(std::memory_order_acquire);
+        if ((sequence & 1) != 0) {
+          std::this_thread::yield();
+          continue;
+        }
+        const bool found =
+            find_index(shard.table.load(std::memory_order_acquire), key,
+                       hash) != npos;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (shard.sequence.load(std::memory_order_relaxed) == sequence) {
+          return found;
+        }
+      }
+    }
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return find_index(shard.table.load(std::memory_order_relaxed), key,
+                      hash) != npos;
+  }
+
+  // Modifiers
+  /**
+   * @brief Inserts (key, value) unless key is already present.
+   *
+   * @return true if the entry was inserted
+   */
+  auto insert(const Key &key, const Value &value) -> bool {
+    const size_type hash = hash_of(key);
+    Shard &shard = shard_for(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (find_index(shard.table.load(std::memory_order_relaxed), key, hash) !=
+        npos) {
+      return false;
+    }
+    WriteSection section(shard);
+    insert_absent(shard, key, value, hash);
+    return true;
+  }
+
+  /**
+   * @brief Inserts or overwrites the value for key.
+   *
+   * @return true if a new entry was inserted
+   */
+  auto insert_or_assign(const Key &key, const Value &value) -> bool {
+    const size_type hash = hash_of(key);
+    Shard &shard = shard_for(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    Table *table = shard.table.load(std::memory_order_relaxed);
+    const size_type at = find_index(table, key, hash);
+    WriteSection section(shard);
+    if (at != npos) {
+      store_value(table->slots[at], value);
+      return false;
+    }
+    insert_absent(shard, key, value, hash);
+    return true;
+  }
+
+  /**
+   * @brief Returns the value for key, inserting make(key) first if key is
+   * absent. make runs at most once per inserted key, under the shard lock.
+   */
+  template <typename Function>
+  auto compute_if_absent(const Key &key, Function make) -> Value {
+    if constexpr (optimistic_reads) {
+      if (auto value = get(key)) {
+        return *value;
+      }
+    }
+    const size_type hash = hash_of(key);
+    Shard &shard = shard_for(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const Table *table = shard.table.load(std::memory_order_relaxed);
+    if (const size_type at = find_index(table, key, hash); at != npos) {
+      return table->slots[at].value;
+    }
+    Value value = make(key);
+    WriteSection section(shard);
+    insert_absent(shard, key, value, hash);
+    return value;
+  }
+
+  /**
+   * @brief Calls fn(value) on a copy of the value for key and stores the
+   * result back, under the shard lock.
+   *
+   * @return true if key was present
+   */
+  template <typename Function>
+  auto update(const Key &key, Function fn) -> bool {
+    const size_type hash = hash_of(key);
+    Shard &shard = shard_for(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    Table *table = shard.table.load(std::memory_order_relaxed);
+    const size_type at = find_index(table, key, hash);
+    if (at == npos) {
+      return false;
+    }
+    Value value = table->slots[at].value;
+    fn(value);
+    WriteSection section(shard);
+    store_value(table->slots[at], value);
+    return true;
+  }
+
+  /**
+   * @brief Removes the entry for key.
+   *
+   * @return true if an entry was removed
+   */
+  auto erase(const Key &key) -> bool {
+    const size_type hash = hash_of(key);
+    Shard &shard = shard_for(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    Table *table = shard.table.load(std::memory_order_relaxed);
+    const size_type at = find_index(table, key, hash);
+    if (at == npos) {
+      return false;
+    }
+    WriteSection section(shard);
+    erase_slot(table, at);
+    shard.size.store(shard.size.load(std::memory_order_relaxed) - 1,
+                     std::memory_order_relaxed);
+    return true;
+  }
+
+  /**
+   * @brief Removes every entry; shards are cleared one at a time and keep
+   * their tables.
+   */
+  auto clear() -> void {
+    for (size_type i = 0; i < m_shard_count; ++i) {
+      Shard &shard = m_shards[i];
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      Table *table = shard.table.load(std::memory_order_relaxed);
+      if (table == nullptr) {
+        continue;
+      }
+      WriteSection section(shard);
+      destroy_slots(table);
+      for (size_type at = 0; at < table->capacity; ++at) {
+        store_ctrl(table->ctrl[at], 0);
+      }
+      shard.size.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  // Iteration
+  /**
+   * @brief Calls fn(key, value) for every entry, locking one shard at a
+   * time; entries changed concurrently in other shards may or may not be
+   * seen.
+   */
+  template <typename Function> auto for_each(Function fn) const -> void {
+    for (size_type i = 0; i < m_shard_count; ++i) {
+      visit_shard(m_shards[i], fn);
+    }
+  }
+
+  /**
+   * @brief Like for_each(), but shards are visited by thread_count threads
+   * at once. fn must be safe to call concurrently; the first exception it
+   * throws is rethrown once all threads have stopped. If a thread cannot be
+   * started, the running ones stop after their current shard and
+   * the error is rethrown.
+   */
+  template <typename Function>
+  auto parallel_for_each(Function fn,
+                         size_type thread_count =
+                             std::thread::hardware_concurrency()) const
+      -> void {
+    thread_count = std::clamp<size_type>(thread_count, 1, m_shard_count);
+    std::atomic<size_type> next_shard{0};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+    auto worker = [&]() {
+      try {
+        for (size_type i = next_shard.fetch_add(1); i < m_shard_count;
+             i = next_shard.fetch_add(1)) {
+          visit_shard(m_shards[i], fn);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(failure_mutex);
+        if (!failure) {
+          failure = std::current_exception();
+        }
+        next_shard.store(m_shard_count);
+      }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count - 1);
+    try {
+      for (size_type i = 1; i < thread_count; ++i) {
+        threads.emplace_back(worker);
+      }
+    } catch (...) {
+      // Stop the workers already running and join them, since a joinable
+      // std::thread would terminate on destruction.
+      next_shard.store(m_shard_count);
+      for (auto &thread : threads) {
+        thread.join();
+      }
+      throw;
+    }
+    worker();
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    if (failure) {
+      std::rethrow_exception(failure);
+    }
+  }
+
+  // Capacity
+  /**
+   * @brief Number of entries; only a snapshot under concurrent writes.
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    size_type total = 0;
+    for (size_type i = 0; i < m_shard_count; ++i) {
+      total += m_shards[i].size.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return size() == 0; }
+
+  [[nodiscard]] auto shard_count() const noexcept -> size_type {
+    return m_shard_count;
+  }
+
+private:
+  // Bits 0-6 become the control fragment, the next m_shard_bits pick the
+  // shard and the rest pick the home slot.
+  auto hash_of(const Key &key) const -> size_type {
+    return details::mix_hash(m_hash(key));
+  }
+
+  auto shard_for(size_type hash) const noexcept -> Shard & {
+    return m_shards[(hash >> 7) & (m_shard_count - 1)];
+  }
+
+  auto home(size_type hash, size_type capacity) const noexcept -> size_type {
+    return (hash >> (7 + m_shard_bits)) & (capacity - 1);
+  }
+
+  static auto fragment(size_type hash) noexcept -> std::uint8_t {
+    return static_cast<std::uint8_t>(0x80 | (hash & 0x7F));
+  }
+
+  static auto growth_limit(size_type capacity) noexcept -> size_type {
+    return capacity - capacity / 4;
+  }
+
+  static auto load_ctrl(const std::uint8_t &ctrl) noexcept -> std::uint8_t {
+    if constexpr (optimistic_reads) {
+      return details::racy_load(ctrl);
+    } else {
+      return ctrl;
+    }
+  }
+
+  static auto store_ctrl(std::uint8_t &ctrl, std::uint8_t value) noexcept
+      -> void {
+    if constexpr (optimistic_reads) {
+      details::racy_store(ctrl, value);
+    } else {
+      ctrl = value;
+    }
+  }
+
+  static auto store_value(Slot &slot, const Value &value) -> void {
+    if constexpr (optimistic_reads) {
+      details::racy_store(slot.value, value);
+    } else {
+      slot.value = value;
+    }
+  }
+
+  // Probes are bounded by the capacity: an optimistic reader may see a
+  // table in the middle of a change, with no empty slot left to stop at.
+  auto find_index(const Table *table, const Key &key, size_type hash) const
+      -> size_type {
+    if (table == nullptr) {
+      return npos;
+    }
+    const size_type mask = table->capacity - 1;
+    const std::uint8_t tag = fragment(hash);
+    size_type at = home(hash, table->capacity);
+    for (size_type probe = 0; probe < table->capacity;
+         ++probe, at = (at + 1) & mask) {
+      const std::uint8_t ctrl = load_ctrl(table->ctrl[at]);
+      if (ctrl == 0) {
+        return npos;
+      }
+      if (ctrl != tag) {
+        continue;
+      }
+      if constexpr (optimistic_reads) {
+        if (m_equal(details::racy_load(table->slots[at].key), key)) {
+          return at;
+        }
+      } else if (m_equal(table->slots[at].key, key)) {
+        return at;
+      }
+    }
+    return npos;
+  }
+
+  auto free_slot(const Table *table, size_type hash) const noexcept
+      -> size_type {
+    const size_type mask = table->capacity - 1;
+    size_type at = home(hash, table->capacity);
+    while (table->ctrl[at] != 0) {
+      at = (at + 1) & mask;
+    }
+    return at;
+  }
+
+  // Inside a write section, with key known to be absent.
+  auto insert_absent(Shard &shard, const Key &key, const Value &value,
+                     size_type hash) -> void {
+    Table *table = shard.table.load(std::memory_order_relaxed);
+    const size_type size = shard.size.load(std::memory_order_relaxed);
+    if (table == nullptr || size + 1 > growth_limit(table->capacity)) {
+      table = grow(shard, table);
+    }
+    const size_type at = free_slot(table, hash);
+    if constexpr (optimistic_reads) {
+      details::racy_store(table->slots[at].key, key);
+      details::racy_store(table->slots[at].value, value);
+    } else {
+      ::new (static_cast<void *>(table->slots + at)) Slot{key, value};
+    }
+    store_ctrl(table->ctrl[at], fragment(hash));
+    shard.size.store(size + 1, std::memory_order_relaxed);
+  }
+
+  // The new table is filled before it is published, so readers that load
+  // it see complete slots.
+  auto grow(Shard &shard, Table *old) -> Table * {
+    Table *table = Table::create(old == nullptr ? min_capacity
+                                                : old->capacity * 2);
+    if (old != nullptr) {
+      for (size_type i = 0; i < old->capacity; ++i) {
+        if (old->ctrl[i] == 0) {
+          continue;
+        }
+        Slot &slot = old->slots[i];
+        const size_type at = free_slot(table, hash_of(slot.key));
+        if constexpr (optimistic_reads) {
+          std::memcpy(static_cast<void *>(table->slots + at), &slot,
+                      sizeof(Slot));
+        } else {
+          ::new (static_cast<void *>(table->slots + at))
+              Slot{std::move(slot.key), std::move(slot.value)};
+          std::destroy_at(&slot);
+        }
+        table->ctrl[at] = old->ctrl[i];
+      }
+    }
+    if constexpr (optimistic_reads) {
+      table->retired = old;
+    } else if (old != nullptr) {
+      Table::destroy(old);
+    }
+    shard.table.store(table, std::memory_order_release);
+    return table;
+  }
+
+  // Backward-shift deletion, so probes can stop at the first empty slot.
+  auto erase_slot(Table *table, size_type at) -> void {
+    const size_type mask = table->capacity - 1;
+    size_type hole = at;
+    if constexpr (!optimistic_reads) {
+      std::destroy_at(table->slots + hole);
+    }
+    for (size_type i = (hole + 1) & mask; table->ctrl[i] != 0;
+         i = (i + 1) & mask) {
+      const size_type slot_home =
+          home(hash_of(table->slots[i].key), table->capacity);
+      if (((i - slot_home) & mask) >= ((i - hole) & mask)) {
+        if constexpr (optimistic_reads) {
+          details::racy_store(table->slots[hole], table->slots[i]);
+        } else {
+          ::new (static_cast<void *>(table->slots + hole))
+              Slot{std::move(table->slots[i].key),
+                   std::move(table->slots[i].value)};
+          std::destroy_at(table->slots + i);
+        }
+        store_ctrl(table->ctrl[hole], table->ctrl[i]);
+        hole = i;
+      }
+    }
+    store_ctrl(table->ctrl[hole], 0);
+  }
+
+  static auto destroy_slots(Table *table) noexcept -> void {
+    if constexpr (!std::is_trivially_destructible_v<Slot>) {
+      for (size_type i = 0; i < table->capacity; ++i) {
+        if (table->ctrl[i] != 0) {
+          std::destroy_at(table->slots + i);
+        }
+      }
+    }
+  }
+
+  template <typename Function>
+  static auto visit_shard(Shard &shard, Function &fn) -> void {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const Table *table = shard.table.load(std::memory_order_relaxed);
+    if (table == nullptr) {
+      return;
+    }
+    for (size_type i = 0; i < table->capacity; ++i) {
+      if (table->ctrl[i] != 0) {
+        const Slot &slot = table->slots[i];
+        fn(slot.key, static_cast<const Value &>(slot.value));
+      }
+    }
+  }
+};
+
+#endif // __CONCURRENT_HASH_MAP_HPP__
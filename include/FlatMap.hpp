@@ -0,0 +1,218 @@
+#ifndef __FLAT_MAP_HPP__
+#define __FLAT_MAP_HPP__
+
+#include "FlatSet.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+/**
+ * @brief Ordered map of unique keys stored contiguously in one array
+ *
+ * @tparam Key The key type, ordered by Compare
+ * @tparam Value The mapped type
+ * @tparam Compare Strict weak ordering on keys
+ * @tparam Layout Sorted (the default) or Eytzinger array order
+ *
+ * The (key, value) pairs live in one Vector in Layout order, so the map
+ * needs no per-entry allocation and a whole batch is merged in with one
+ * sort and one pass. The entries are std::pair<Key, Value> rather than
+ * pair<const Key, Value> so that rebuilds can move them; the key of an
+ * entry must not be modified through an iterator.
+ *
+ * Complexity guarantees:
+ * - find(), contains(), at(): O(log n)
+ * - lower_bound(), upper_bound(): O(log n)
+ * - insert(), emplace(), operator[]() of a new key, erase(): O(n)
+ * - insert(first, last): O(m log m + n) for m new entries
+ * - size(), is_empty(): O(1)
+ * - begin(), end(): O(log n); ++, --: O(1) amortized
+ *
+ * @example
+ * std::vector<std::pair<int, double>> prices{{3, 1.5}, {1, 0.5}};
+ * FlatMap<int, double> table(prices.begin(), prices.end());
+ * table.insert(2, 1.0);
+ * assert(table.at(2) == 1.0 && table.begin()->first == 1);
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>,
+          FlatLayout Layout = FlatLayout::Sorted>
+class FlatMap {
+private:
+  using Tree = details::FlatTree<Key, std::pair<Key, Value>,
+                                 details::KeyOfPair, Compare, Layout>;
+
+public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<Key, Value>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using key_compare = Compare;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename Tree::iterator;
+  using const_iterator = typename Tree::const_iterator;
+
+  static constexpr FlatLayout layout = Layout;
+
+private:
+  Tree m_tree;
+
+public:
+  FlatMap() = default;
+
+  explicit FlatMap(const Compare &compare) : m_tree(compare) {}
+
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  FlatMap(InputIt first, InputIt last) {
+    m_tree.insert(first, last);
+  }
+
+  FlatMap(std::initializer_list<value_type> init) {
+    m_tree.insert(init.begin(), init.end());
+  }
+
+  // Lookup
+  [[nodiscard]] auto find(const Key &key) -> iterator {
+    return m_tree.mutable_iterator(m_tree.find(key));
+  }
+
+  [[nodiscard]] auto find(const Key &key) const -> const_iterator {
+    return m_tree.find(key);
+  }
+
+  [[nodiscard]] auto contains(const Key &key) const -> bool {
+    return m_tree.find(key) != m_tree.end();
+  }
+
+  [[nodiscard]] auto at(const Key &key) -> Value & {
+    const iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("Key not found in map");
+    }
+    return it->second;
+  }
+
+  [[nodiscard]] auto at(const Key &key) const -> const Value & {
+    const const_iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("Key not found in map");
+    }
+    return it->second;
+  }
+
+  auto operator[](const Key &key) -> Value & {
+    return emplace(key).first->second;
+  }
+
+  /**
+   * @brief First entry whose key is not less than key.
+   */
+  [[nodiscard]] auto lower_bound(const Key &key) const -> const_iterator {
+    return m_tree.lower_bound(key);
+  }
+
+  [[nodiscard]] auto lower_bound(const Key &key) -> iterator {
+    return m_tree.mutable_iterator(m_tree.lower_bound(key));
+  }
+
+  /**
+   * @brief First entry whose key is greater than key.
+   */
+  [[nodiscard]] auto upper_bound(const Key &key) const -> const_iterator {
+    return m_tree.upper_bound(key);
+  }
+
+  [[nodiscard]] auto upper_bound(const Key &key) -> iterator {
+    return m_tree.mutable_iterator(m_tree.upper_bound(key));
+  }
+
+  // Modifiers
+  /**
+   * @brief Inserts (key, value) unless key is already present.
+   *
+   * @return iterator to the entry for key and whether it was inserted
+   */
+  auto insert(const Key &key, const Value &value) -> std::pair<iterator, bool> {
+    return emplace(key, value);
+  }
+
+  auto insert(const Key &key, Value &&value) -> std::pair<iterator, bool> {
+    return emplace(key, std::move(value));
+  }
+
+  /**
+   * @brief Inserts the entries of [first, last) whose keys are not yet
+   * present; among equal keys in the range the first one wins.
+   *
+   * @return number of inserted entries
+   */
+  template <typename InputIt>
+  auto insert(InputIt first, InputIt last) -> size_type {
+    return m_tree.insert(first, last);
+  }
+
+  /**
+   * @brief Inserts or overwrites the value for key.
+   *
+   * @return true if a new entry was inserted
+   */
+  template <typename V>
+  auto insert_or_assign(const Key &key, V &&value) -> bool {
+    auto [it, inserted] = emplace(key, std::forward<V>(value));
+    if (!inserted) {
+      it->second = std::forward<V>(value);
+    }
+    return inserted;
+  }
+
+  /**
+   * @brief Constructs the value for key from args unless key is present.
+   */
+  template <typename... Args>
+  auto emplace(const Key &key, Args &&...args) -> std::pair<iterator, bool> {
+    return m_tree.emplace(key, std::piecewise_construct,
+                          std::forward_as_tuple(key),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  /**
+   * @brief Removes the entry for key.
+   *
+   * @return number of removed entries (0 or 1)
+   */
+  auto erase(const Key &key) -> size_type { return m_tree.erase(key); }
+
+  auto clear() noexcept -> void { m_tree.clear(); }
+
+  auto reserve(size_type capacity) -> void { m_tree.reserve(capacity); }
+
+  auto swap(FlatMap &other) noexcept -> void { m_tree.swap(other.m_tree); }
+
+  // Capacity
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return m_tree.size();
+  }
+  [[nodiscard]] auto is_empty() const noexcept -> bool {
+    return m_tree.is_empty();
+  }
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return m_tree.capacity();
+  }
+
+  // Iterators
+  auto begin() noexcept -> iterator { return m_tree.begin(); }
+  auto end() noexcept -> iterator { return m_tree.end(); }
+  auto begin() const noexcept -> const_iterator { return m_tree.begin(); }
+  auto end() const noexcept -> const_iterator { return m_tree.end(); }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+};
+
+#endif // __FLAT_MAP_HPP__
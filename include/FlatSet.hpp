@@ -0,0 +1,740 @@
+#ifndef __FLAT_SET_HPP__
+#define __FLAT_SET_HPP__
+
+#include "KeyOf.hpp"
+#include "Prefetch.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+/**
+ * @brief Element order of a flat container's array.
+ *
+ * Sorted keeps ascending order, so single inserts and erases move only the
+ * tail. Eytzinger stores the implicit binary search tree in breadth-first
+ * order: lookups descend with one branchless step per level and prefetch
+ * four levels ahead, but every modification rebuilds the array in O(n).
+ */
+enum class FlatLayout { Sorted, Eytzinger };
+
+namespace details {
+[[nodiscard]] inline auto trailing_ones(std::size_t bits) noexcept
+    -> unsigned {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned>(
+      __builtin_ctzll(~static_cast<unsigned long long>(bits)));
+#else
+  unsigned count = 0;
+  while ((bits & 1U) != 0) {
+    bits >>= 1;
+    ++count;
+  }
+  return count;
+#endif
+}
+
+// In-order navigation over the nodes 1..count of an Eytzinger array, whose
+// node k has children 2k and 2k + 1; 0 stands for no node.
+[[nodiscard]] inline auto eytzinger_first(std::size_t count) noexcept
+    -> std::size_t {
+  if (count == 0) {
+    return 0;
+  }
+  std::size_t node = 1;
+  while (node * 2 <= count) {
+    node *= 2;
+  }
+  return node;
+}
+
+[[nodiscard]] inline auto eytzinger_last(std::size_t count) noexcept
+    -> std::size_t {
+  if (count == 0) {
+    return 0;
+  }
+  std::size_t node = 1;
+  while (node * 2 + 1 <= count) {
+    node = node * 2 + 1;
+  }
+  return node;
+}
+
+[[nodiscard]] inline auto eytzinger_next(std::size_t node,
+                                         std::size_t count) noexcept
+    -> std::size_t {
+  if (node * 2 + 1 <= count) {
+    node = node * 2 + 1;
+    while (node * 2 <= count) {
+      node *= 2;
+    }
+    return node;
+  }
+  // Climb past every ancestor reached from its right child.
+  return node >> (trailing_ones(node) + 1);
+}
+
+[[nodiscard]] inline auto eytzinger_prev(std::size_t node,
+                                         std::size_t count) noexcept
+    -> std::size_t {
+  if (node == 0) {
+    return eytzinger_last(count);
+  }
+  if (node * 2 <= count) {
+    node *= 2;
+    while (node * 2 + 1 <= count) {
+      node = node * 2 + 1;
+    }
+    return node;
+  }
+  return node >> (trailing_ones(~node) + 1);
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Compare,
+          FlatLayout Layout>
+class FlatTree;
+} // namespace details
+
+/**
+ * @brief Bidirectional iterator over a flat sorted container
+ *
+ * @tparam Tree The container core this iterator is for
+ *
+ * Visits entries in ascending key order whatever the array layout.
+ */
+template <typename Tree> class Flat_Iterator {
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename Tree::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = value_type *;
+  using reference = value_type &;
+  using size_type = std::size_t;
+
+public:
+  constexpr explicit Flat_Iterator(pointer entries = nullptr,
+                                   size_type count = 0,
+                                   size_type index = 0) noexcept
+      : m_entries(entries), m_count(count), m_index(index) {}
+
+  auto operator++() noexcept -> Flat_Iterator & {
+    m_index = Tree::next_index(m_index, m_count);
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> Flat_Iterator {
+    Flat_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> Flat_Iterator & {
+    m_index = Tree::prev_index(m_index, m_count);
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> Flat_Iterator {
+    Flat_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference {
+    return m_entries[Tree::offset_of(m_index)];
+  }
+  auto operator->() const noexcept -> pointer {
+    return m_entries + Tree::offset_of(m_index);
+  }
+
+  auto operator==(const Flat_Iterator &other) const noexcept -> bool {
+    return m_entries == other.m_entries && m_index == other.m_index;
+  }
+
+  auto operator!=(const Flat_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  friend Tree;
+  template <typename> friend class cFlat_Iterator;
+
+  pointer m_entries;
+  size_type m_count;
+  size_type m_index;
+};
+
+/**
+ * @brief Const bidirectional iterator over a flat sorted container
+ *
+ * @tparam Tree The container core this const iterator is for
+ */
+template <typename Tree> class cFlat_Iterator {
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename Tree::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type *;
+  using reference = const value_type &;
+  using size_type = std::size_t;
+
+public:
+  constexpr explicit cFlat_Iterator(pointer entries = nullptr,
+                                    size_type count = 0,
+                                    size_type index = 0) noexcept
+      : m_entries(entries), m_count(count), m_index(index) {}
+
+  constexpr cFlat_Iterator(const Flat_Iterator<Tree> &other) noexcept
+      : m_entries(other.m_entries), m_count(other.m_count),
+        m_index(other.m_index) {}
+
+  auto operator++() noexcept -> cFlat_Iterator & {
+    m_index = Tree::next_index(m_index, m_count);
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> cFlat_Iterator {
+    cFlat_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> cFlat_Iterator & {
+    m_index = Tree::prev_index(m_index, m_count);
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> cFlat_Iterator {
+    cFlat_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference {
+    return m_entries[Tree::offset_of(m_index)];
+  }
+  auto operator->() const noexcept -> pointer {
+    return m_entries + Tree::offset_of(m_index);
+  }
+
+  auto operator==(const cFlat_Iterator &other) const noexcept -> bool {
+    return m_entries == other.m_entries && m_index == other.m_index;
+  }
+
+  auto operator!=(const cFlat_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  friend Tree;
+
+  pointer m_entries;
+  size_type m_count;
+  size_type m_index;
+};
+
+namespace details {
+/**
+ * @brief Unique entries kept in one contiguous Vector, shared by FlatSet
+ * and FlatMap
+ *
+ * @tparam Key The key type, ordered by Compare
+ * @tparam Entry The stored element, from which KeyOf extracts the key
+ * @tparam KeyOf Functor returning the key of an Entry
+ * @tparam Compare Strict weak ordering on keys
+ * @tparam Layout Order of the entries within the array
+ *
+ * An index names an entry: its array position under the Sorted layout and
+ * its 1-based tree node under the Eytzinger layout, where 0 is end().
+ * Rebuilds move entries out of the old array only after every buffer they
+ * need is allocated.
+ */
+template <typename Key, typename Entry, typename KeyOf, typename Compare,
+          FlatLayout Layout>
+class FlatTree {
+public:
+  using key_type = Key;
+  using value_type = Entry;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using iterator = Flat_Iterator<FlatTree>;
+  using const_iterator = cFlat_Iterator<FlatTree>;
+
+  static constexpr FlatLayout layout = Layout;
+  static constexpr size_type cache_line = 64;
+  // Sorted arrays larger than this prefetch during search.
+  static constexpr size_type prefetch_threshold = size_type{1} << 20;
+  // Nodes k * lookahead onwards sit log2(lookahead) levels below node k and
+  // share one cache line.
+  static constexpr size_type lookahead = [] {
+    size_type nodes = 2;
+    while (nodes * 2 * sizeof(Entry) <= cache_line) {
+      nodes *= 2;
+    }
+    return nodes;
+  }();
+
+private:
+  Vector<Entry> m_entries;
+  Compare m_compare;
+
+public:
+  FlatTree() = default;
+
+  explicit FlatTree(const Compare &compare) : m_compare(compare) {}
+
+  // Index arithmetic shared with the iterators
+  [[nodiscard]] static auto first_index(size_type count) noexcept
+      -> size_type {
+    if constexpr (Layout == FlatLayout::Sorted) {
+      return 0;
+    } else {
+      return eytzinger_first(count);
+    }
+  }
+
+  [[nodiscard]] static auto end_index(size_type count) noexcept
+      -> size_type {
+    if constexpr (Layout == FlatLayout::Sorted) {
+      return count;
+    } else {
+      return 0;
+    }
+  }
+
+  [[nodiscard]] static auto next_index(size_type index,
+                                       size_type count) noexcept
+      -> size_type {
+    if constexpr (Layout == FlatLayout::Sorted) {
+      return index + 1;
+    } else {
+      return eytzinger_next(index, count);
+    }
+  }
+
+  [[nodiscard]] static auto prev_index(size_type index,
+                                       size_type count) noexcept
+      -> size_type {
+    if constexpr (Layout == FlatLayout::Sorted) {
+      return index - 1;
+    } else {
+      return eytzinger_prev(index, count);
+    }
+  }
+
+  [[nodiscard]] static constexpr auto offset_of(size_type index) noexcept
+      -> size_type {
+    return Layout == FlatLayout::Sorted ? index : index - 1;
+  }
+
+  // Lookup
+  [[nodiscard]] auto find(const Key &key) const -> const_iterator {
+    const size_type index = lower_index(key);
+    if (index != end_index(size()) && !m_compare(key, key_at(index))) {
+      return make_iterator(index);
+    }
+    return end();
+  }
+
+  [[nodiscard]] auto lower_bound(const Key &key) const -> const_iterator {
+    return make_iterator(lower_index(key));
+  }
+
+  [[nodiscard]] auto upper_bound(const Key &key) const -> const_iterator {
+    return make_iterator(search(
+        [&](const Entry &entry) { return !m_compare(key, KeyOf{}(entry)); }));
+  }
+
+  // Modifiers
+  /**
+   * @brief Constructs an entry for key from args unless key is present.
+   */
+  template <typename... Args>
+  auto emplace(const Key &key, Args &&...args) -> std::pair<iterator, bool> {
+    const size_type index = lower_index(key);
+    if (index != end_index(size()) && !m_compare(key, key_at(index))) {
+      return {mutable_iterator(make_iterator(index)), false};
+    }
+    if constexpr (Layout == FlatLayout::Sorted) {
+      m_entries.emplace(m_entries.begin() + index,
+                        std::forward<Args>(args)...);
+      return {mutable_iterator(make_iterator(index)), true};
+    } else {
+      // The entry's rank is the number of smaller entries, counted along
+      // the in-order walk the rebuild makes anyway.
+      Entry entry(std::forward<Args>(args)...);
+      const size_type count = size();
+      size_type rank = 0;
+      for (size_type node = eytzinger_first(count); node != index;
+           node = eytzinger_next(node, count)) {
+        ++rank;
+      }
+      rebuild(count + 1, [&](Vector<Entry> &sorted) {
+        size_type position = 0;
+        for_each_in_order([&](Entry &old) {
+          if (position++ == rank) {
+            sorted.push_back(std::move(entry));
+          }
+          sorted.push_back(std::move_if_noexcept(old));
+        });
+        if (rank == count) {
+          sorted.push_back(std::move(entry));
+        }
+      });
+      size_type node = eytzinger_first(count + 1);
+      for (; rank > 0; --rank) {
+        node = eytzinger_next(node, count + 1);
+      }
+      return {mutable_iterator(make_iterator(node)), true};
+    }
+  }
+
+  /**
+   * @brief Inserts the entries of [first, last) whose keys are not yet
+   * present by sorting them and merging them in one pass.
+   *
+   * Among equal keys in the range the first one wins.
+   *
+   * @return number of inserted entries
+   */
+  template <typename InputIt>
+  auto insert(InputIt first, InputIt last) -> size_type {
+    Vector<Entry> batch(first, last);
+    auto entry_less = [&](const Entry &lhs, const Entry &rhs) {
+      return m_compare(KeyOf{}(lhs), KeyOf{}(rhs));
+    };
+    std::stable_sort(batch.begin(), batch.end(), entry_less);
+    batch.erase(std::unique(batch.begin(), batch.end(),
+                            [&](const Entry &lhs, const Entry &rhs) {
+                              return !entry_less(lhs, rhs);
+                            }),
+                batch.end());
+
+    size_type inserted = 0;
+    rebuild(size() + batch.size(), [&](Vector<Entry> &sorted) {
+      Entry *next = batch.data();
+      Entry *const stop = next + batch.size();
+      for_each_in_order([&](Entry &old) {
+        for (; next != stop && entry_less(*next, old); ++next) {
+          sorted.push_back(std::move(*next));
+          ++inserted;
+        }
+        if (next != stop && !entry_less(old, *next)) {
+          ++next;
+        }
+        sorted.push_back(std::move_if_noexcept(old));
+      });
+      for (; next != stop; ++next) {
+        sorted.push_back(std::move(*next));
+        ++inserted;
+      }
+    });
+    return inserted;
+  }
+
+  /**
+   * @brief Removes the entry for key.
+   *
+   * @return number of removed entries (0 or 1)
+   */
+  auto erase(const Key &key) -> size_type {
+    const size_type index = lower_index(key);
+    if (index == end_index(size()) || m_compare(key, key_at(index))) {
+      return 0;
+    }
+    if constexpr (Layout == FlatLayout::Sorted) {
+      m_entries.erase(m_entries.begin() + index);
+    } else {
+      const Entry *removed = m_entries.data() + offset_of(index);
+      rebuild(size() - 1, [&](Vector<Entry> &sorted) {
+        for_each_in_order([&](Entry &old) {
+          if (&old != removed) {
+            sorted.push_back(std::move_if_noexcept(old));
+          }
+        });
+      });
+    }
+    return 1;
+  }
+
+  auto clear() noexcept -> void { m_entries.clear(); }
+
+  auto reserve(size_type capacity) -> void { m_entries.reserve(capacity); }
+
+  auto swap(FlatTree &other) noexcept -> void {
+    using std::swap;
+    swap(m_entries, other.m_entries);
+    swap(m_compare, other.m_compare);
+  }
+
+  // Capacity
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return m_entries.size();
+  }
+  [[nodiscard]] auto is_empty() const noexcept -> bool {
+    return m_entries.is_empty();
+  }
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return m_entries.capacity();
+  }
+
+  // Iterators
+  auto begin() noexcept -> iterator {
+    return mutable_iterator(make_iterator(first_index(size())));
+  }
+  auto end() noexcept -> iterator {
+    return mutable_iterator(make_iterator(end_index(size())));
+  }
+  auto begin() const noexcept -> const_iterator {
+    return make_iterator(first_index(size()));
+  }
+  auto end() const noexcept -> const_iterator {
+    return make_iterator(end_index(size()));
+  }
+
+  // Removes the constness an iterator picked up from a const lookup.
+  [[nodiscard]] auto mutable_iterator(const_iterator it) noexcept
+      -> iterator {
+    return iterator(m_entries.data(), it.m_count, it.m_index);
+  }
+
+private:
+  [[nodiscard]] auto make_iterator(size_type index) const noexcept
+      -> const_iterator {
+    return const_iterator(m_entries.data(), size(), index);
+  }
+
+  [[nodiscard]] auto key_at(size_type index) const noexcept -> const Key & {
+    return KeyOf{}(m_entries.data()[offset_of(index)]);
+  }
+
+  [[nodiscard]] auto lower_index(const Key &key) const -> size_type {
+    return search(
+        [&](const Entry &entry) { return m_compare(KeyOf{}(entry), key); });
+  }
+
+  // Index of the first entry for which before(entry) is false. Both
+  // layouts descend without a data-dependent branch.
+  template <typename Before>
+  [[nodiscard]] auto search(Before before) const -> size_type {
+    const Entry *entries = m_entries.data();
+    const size_type count = size();
+    if constexpr (Layout == FlatLayout::Sorted) {
+      if (count == 0) {
+        return 0;
+      }
+      // Once the array outgrows the cache, both possible midpoints of the
+      // next step are fetched while this step's comparison is still
+      // waiting on memory; below that the prefetches only cost issue slots.
+      const bool cold = count * sizeof(Entry) > prefetch_threshold;
+      const Entry *base = entries;
+      size_type remaining = count;
+      while (remaining > 1) {
+        const size_type half = remaining / 2;
+        if (cold) {
+          details::prefetch(base + half / 2);
+          details::prefetch(base + half + half / 2);
+        }
+        base = before(base[half]) ? base + half : base;
+        remaining -= half;
+      }
+      return static_cast<size_type>(base - entries) +
+             static_cast<size_type>(before(*base));
+    } else {
+      size_type node = 1;
+      while (node <= count) {
+        // The address may lie past the array; prefetching never faults.
+        details::prefetch(reinterpret_cast<const void *>(
+            reinterpret_cast<std::uintptr_t>(entries) +
+            (node * lookahead - 1) * sizeof(Entry)));
+        node = 2 * node + static_cast<size_type>(before(entries[node - 1]));
+      }
+      // The answer is the last node left through its left child.
+      return node >> (trailing_ones(node) + 1);
+    }
+  }
+
+  template <typename Visitor> auto for_each_in_order(Visitor visit) -> void {
+    Entry *entries = m_entries.data();
+    const size_type count = size();
+    for (size_type index = first_index(count); index != end_index(count);
+         index = next_index(index, count)) {
+      visit(entries[offset_of(index)]);
+    }
+  }
+
+  // Replaces the entries with the ascending sequence fill appends to a
+  // vector reserved for capacity entries, laid out as Layout requires.
+  template <typename Fill>
+  auto rebuild(size_type capacity, Fill fill) -> void {
+    Vector<Entry> sorted;
+    sorted.reserve(capacity);
+    if constexpr (Layout == FlatLayout::Sorted) {
+      fill(sorted);
+      m_entries = std::move(sorted);
+    } else {
+      Vector<Entry> laid_out;
+      laid_out.reserve(capacity);
+      Vector<size_type> ranks(capacity);
+      fill(sorted);
+      const size_type count = sorted.size();
+      size_type rank = 0;
+      for (size_type node = eytzinger_first(count); node != 0;
+           node = eytzinger_next(node, count)) {
+        ranks.data()[node - 1] = rank++;
+      }
+      for (size_type node = 1; node <= count; ++node) {
+        laid_out.push_back(std::move(sorted.data()[ranks.data()[node - 1]]));
+      }
+      m_entries = std::move(laid_out);
+    }
+  }
+};
+} // namespace details
+
+/**
+ * @brief Ordered set of unique keys stored contiguously in one array
+ *
+ * @tparam Key The element type, ordered by Compare
+ * @tparam Compare Strict weak ordering on elements
+ * @tparam Layout Sorted (the default) or Eytzinger array order
+ *
+ * Meant for data that is built once, or in batches, and queried many
+ * times: elements need no per-element allocation, lookups are branchless
+ * and prefetch ahead, and insert(first, last) sorts the batch and merges
+ * it in a single pass. Iteration is always in ascending order.
+ *
+ * Complexity guarantees:
+ * - find(), contains(), lower_bound(), upper_bound(): O(log n)
+ * - insert(key), erase(key): O(n)
+ * - insert(first, last): O(m log m + n) for m new keys
+ * - size(), is_empty(): O(1)
+ * - begin(), end(): O(log n); ++, --: O(1) amortized
+ *
+ * @example
+ * std::vector<int> ids{42, 7, 19, 7};
+ * FlatSet<int, std::less<int>, FlatLayout::Eytzinger> index(ids.begin(),
+ *                                                          ids.end());
+ * assert(index.size() == 3 && index.contains(19));
+ * assert(*index.lower_bound(8) == 19);
+ */
+template <typename Key, typename Compare = std::less<Key>,
+          FlatLayout Layout = FlatLayout::Sorted>
+class FlatSet {
+private:
+  using Tree = details::FlatTree<Key, Key, details::KeyOfSelf, Compare, Layout>;
+
+public:
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using key_compare = Compare;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using const_iterator = typename Tree::const_iterator;
+  using iterator = const_iterator;
+
+  static constexpr FlatLayout layout = Layout;
+
+private:
+  Tree m_tree;
+
+public:
+  FlatSet() = default;
+
+  explicit FlatSet(const Compare &compare) : m_tree(compare) {}
+
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  FlatSet(InputIt first, InputIt last) {
+    m_tree.insert(first, last);
+  }
+
+  FlatSet(std::initializer_list<Key> init) {
+    m_tree.insert(init.begin(), init.end());
+  }
+
+  // Lookup
+  [[nodiscard]] auto find(const Key &key) const -> const_iterator {
+    return m_tree.find(key);
+  }
+
+  [[nodiscard]] auto contains(const Key &key) const -> bool {
+    return m_tree.find(key) != m_tree.end();
+  }
+
+  /**
+   * @brief First key not less than key.
+   */
+  [[nodiscard]] auto lower_bound(const Key &key) const -> const_iterator {
+    return m_tree.lower_bound(key);
+  }
+
+  /**
+   * @brief First key greater than key.
+   */
+  [[nodiscard]] auto upper_bound(const Key &key) const -> const_iterator {
+    return m_tree.upper_bound(key);
+  }
+
+  // Modifiers
+  /**
+   * @brief Inserts key unless it is already present.
+   *
+   * @return iterator to key in the set and whether it was inserted
+   */
+  auto insert(const Key &key) -> std::pair<iterator, bool> {
+    return m_tree.emplace(key, key);
+  }
+
+  auto insert(Key &&key) -> std::pair<iterator, bool> {
+    return m_tree.emplace(key, std::move(key));
+  }
+
+  /**
+   * @brief Inserts the keys of [first, last) that are not yet present.
+   *
+   * @return number of inserted keys
+   */
+  template <typename InputIt>
+  auto insert(InputIt first, InputIt last) -> size_type {
+    return m_tree.insert(first, last);
+  }
+
+  /**
+   * @brief Removes key.
+   *
+   * @return number of removed keys (0 or 1)
+   */
+  auto erase(const Key &key) -> size_type { return m_tree.erase(key); }
+
+  auto clear() noexcept -> void { m_tree.clear(); }
+
+  auto reserve(size_type capacity) -> void { m_tree.reserve(capacity); }
+
+  auto swap(FlatSet &other) noexcept -> void { m_tree.swap(other.m_tree); }
+
+  // Capacity
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return m_tree.size();
+  }
+  [[nodiscard]] auto is_empty() const noexcept -> bool {
+    return m_tree.is_empty();
+  }
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return m_tree.capacity();
+  }
+
+  // Iterators
+  auto begin() const noexcept -> const_iterator { return m_tree.begin(); }
+  auto end() const noexcept -> const_iterator { return m_tree.end(); }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+};
+
+#endif // __FLAT_SET_HPP__
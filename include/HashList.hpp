@@ -0,0 +1,800 @@
+#ifndef __HASH_LIST_HPP__
+#define __HASH_LIST_HPP__
+
+#include "HashMap.hpp"
+#include "Vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace details {
+/**
+ * @brief Node of a HashList: 32-bit links, the key's hash and raw storage
+ * for the entry. The link fields stay alive while the slot is free, and
+ * next then threads the slot freelist.
+ */
+template <typename Value> struct HashListSlot {
+  std::uint32_t prev;
+  std::uint32_t next;
+  std::uint32_t hash;
+  alignas(Value) unsigned char storage[sizeof(Value)];
+
+  [[nodiscard]] auto data() noexcept -> Value & {
+    return *std::launder(reinterpret_cast<Value *>(storage));
+  }
+  [[nodiscard]] auto data() const noexcept -> const Value & {
+    return *std::launder(reinterpret_cast<const Value *>(storage));
+  }
+};
+
+// Hash index entry: the node it points to and 32 bits of the key's hash,
+// which reject almost every mismatch without touching the node.
+struct HashListBucket {
+  std::uint32_t node;
+  std::uint32_t hash;
+};
+} // namespace details
+
+/**
+ * @brief Bidirectional iterator for HashList container
+ *
+ * @tparam ListType The list container type this iterator is for
+ *
+ * @note The iterator stores the list and a node index, so it stays valid
+ * when the node array grows, and --end() reaches the back entry.
+ */
+template <typename ListType> class HashList_Iterator {
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename ListType::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = value_type *;
+  using reference = value_type &;
+  using index_type = std::uint32_t;
+
+public:
+  constexpr explicit HashList_Iterator(
+      ListType *list = nullptr, index_type index = ListType::npos) noexcept
+      : m_list(list), m_index(index) {}
+
+  auto operator++() noexcept -> HashList_Iterator & {
+    m_index = m_list->m_slots[m_index].next;
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> HashList_Iterator {
+    HashList_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> HashList_Iterator & {
+    m_index = m_index == ListType::npos ? m_list->m_back
+                                        : m_list->m_slots[m_index].prev;
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> HashList_Iterator {
+    HashList_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference {
+    return m_list->m_slots[m_index].data();
+  }
+
+  auto operator->() const noexcept -> pointer {
+    return std::addressof(m_list->m_slots[m_index].data());
+  }
+
+  auto operator==(const HashList_Iterator &other) const noexcept -> bool {
+    return m_index == other.m_index;
+  }
+
+  auto operator!=(const HashList_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  friend ListType;
+
+  ListType *m_list;
+  index_type m_index;
+};
+
+/**
+ * @brief Const bidirectional iterator for HashList container
+ *
+ * @tparam ListType The list container type this const iterator is for
+ */
+template <typename ListType> class cHashList_Iterator {
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename ListType::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type *;
+  using reference = const value_type &;
+  using index_type = std::uint32_t;
+
+public:
+  constexpr explicit cHashList_Iterator(
+      const ListType *list = nullptr,
+      index_type index = ListType::npos) noexcept
+      : m_list(list), m_index(index) {}
+
+  auto operator++() noexcept -> cHashList_Iterator & {
+    m_index = m_list->m_slots[m_index].next;
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> cHashList_Iterator {
+    cHashList_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> cHashList_Iterator & {
+    m_index = m_index == ListType::npos ? m_list->m_back
+                                        : m_list->m_slots[m_index].prev;
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> cHashList_Iterator {
+    cHashList_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference {
+    return m_list->m_slots[m_index].data();
+  }
+
+  auto operator->() const noexcept -> pointer {
+    return std::addressof(m_list->m_slots[m_index].data());
+  }
+
+  auto operator==(const cHashList_Iterator &other) const noexcept -> bool {
+    return m_index == other.m_index;
+  }
+
+  auto operator!=(const cHashList_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  const ListType *m_list;
+  index_type m_index;
+};
+
+/**
+ * @brief Hash map that iterates in insertion order (a linked hash map)
+ *
+ * @tparam Key Key type
+ * @tparam Value Mapped type
+ * @tparam Hash Hash function
+ * @tparam KeyEqual Key equality
+ *
+ * Entries are IndexedDoublyList-style nodes: one contiguous array linked by
+ * 32-bit prev/next indices, with erased nodes reused through a freelist.
+ * A linear-probing index of 8-byte buckets maps each key to its node; erase
+ * shifts later buckets back instead of leaving tombstones. New keys are
+ * appended at the back, assigning to an existing key keeps its position,
+ * and move_to_back() relinks an entry without moving it, so pop_front()
+ * gives FIFO (or, with move_to_back() on access, LRU) eviction.
+ *
+ * Iterators hold a node index and stay valid until their entry is erased,
+ * even when the node array grows; references are invalidated by growth.
+ * compact() renumbers the nodes in list order so that iteration walks
+ * memory sequentially again after heavy erase or move_to_back traffic.
+ *
+ * Complexity guarantees:
+ * - find(), contains(), at(), operator[](): O(1) average
+ * - insert(), emplace(), insert_or_assign(): O(1) amortized
+ * - erase(), move_to_back(), pop_front(): O(1) average
+ * - front(), back(), size(), is_empty(): O(1)
+ * - compact(), clear(): O(n)
+ *
+ * @example
+ * HashList<std::string, int> recent;
+ * recent.insert("a", 1);
+ * recent.insert("b", 2);
+ * recent.move_to_back("a");
+ * recent.pop_front();           // removes "b"
+ * assert(recent.front().first == "a");
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class HashList {
+public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key, Value>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = HashList_Iterator<HashList>;
+  using const_iterator = cHashList_Iterator<HashList>;
+  using index_type = std::uint32_t;
+
+  static constexpr index_type npos = std::numeric_limits<index_type>::max();
+
+private:
+  friend iterator;
+  friend const_iterator;
+
+  using Slot = details::HashListSlot<value_type>;
+  using Bucket = details::HashListBucket;
+
+  Slot *m_slots{nullptr};
+  index_type m_capacity{0};
+  index_type m_used{0};
+  index_type m_size{0};
+  index_type m_free{npos};
+  index_type m_front{npos};
+  index_type m_back{npos};
+  Vector<Bucket> m_buckets;
+  Hash m_hash;
+  KeyEqual m_equal;
+
+public:
+  // Constructors
+  HashList() = default;
+
+  explicit HashList(size_type count, const Hash &hash = Hash(),
+                    const KeyEqual &equal = KeyEqual())
+      : m_hash(hash), m_equal(equal) {
+    reserve(count);
+  }
+
+  HashList(std::initializer_list<value_type> init_list) {
+    reserve(init_list.size());
+    for (const auto &entry : init_list) {
+      emplace(entry.first, entry.second);
+    }
+  }
+
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  HashList(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      emplace(first->first, first->second);
+    }
+  }
+
+  HashList(const HashList &other)
+      : m_hash(other.m_hash), m_equal(other.m_equal) {
+    reserve(other.m_size);
+    for (const auto &entry : other) {
+      emplace(entry.first, entry.second);
+    }
+  }
+
+  HashList(HashList &&other) noexcept
+      : m_hash(other.m_hash), m_equal(other.m_equal) {
+    swap(other);
+  }
+
+  auto operator=(const HashList &other) -> HashList & {
+    if (this != &other) {
+      HashList temp(other);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  auto operator=(HashList &&other) noexcept -> HashList & {
+    swap(other);
+    return *this;
+  }
+
+  ~HashList() {
+    destroy_entries();
+    details::free_elements(m_slots);
+  }
+
+  // Lookup
+  [[nodiscard]] auto find(const Key &key) -> iterator {
+    return iterator(this, find_node(key));
+  }
+
+  [[nodiscard]] auto find(const Key &key) const -> const_iterator {
+    return const_iterator(this, find_node(key));
+  }
+
+  [[nodiscard]] auto contains(const Key &key) const -> bool {
+    return find_node(key) != npos;
+  }
+
+  [[nodiscard]] auto at(const Key &key) -> Value & {
+    return m_slots[checked_node(key)].data().second;
+  }
+
+  [[nodiscard]] auto at(const Key &key) const -> const Value & {
+    return m_slots[checked_node(key)].data().second;
+  }
+
+  auto operator[](const Key &key) -> Value & {
+    return emplace(key).first->second;
+  }
+
+  [[nodiscard]] auto front() -> reference {
+    if (m_front == npos) {
+      throw std::out_of_range("Cannot access front of empty list");
+    }
+    return m_slots[m_front].data();
+  }
+
+  [[nodiscard]] auto front() const -> const_reference {
+    if (m_front == npos) {
+      throw std::out_of_range("Cannot access front of empty list");
+    }
+    return m_slots[m_front].data();
+  }
+
+  [[nodiscard]] auto back() -> reference {
+    if (m_back == npos) {
+      throw std::out_of_range("Cannot access back of empty list");
+    }
+    return m_slots[m_back].data();
+  }
+
+  [[nodiscard]] auto back() const -> const_reference {
+    if (m_back == npos) {
+      throw std::out_of_range("Cannot access back of empty list");
+    }
+    return m_slots[m_back].data();
+  }
+
+  // Modifiers
+  /**
+   * @brief Appends (key, value) unless key is already present.
+   *
+   * @return iterator to the entry for key and whether it was inserted
+   */
+  auto insert(const Key &key, const Value &value) -> std::pair<iterator, bool> {
+    return emplace(key, value);
+  }
+
+  auto insert(const Key &key, Value &&value) -> std::pair<iterator, bool> {
+    return emplace(key, std::move(value));
+  }
+
+  /**
+   * @brief Appends key with value, or overwrites the value in place.
+   *
+   * @return true if a new entry was inserted
+   */
+  template <typename V> auto insert_or_assign(const Key &key, V &&value) -> bool {
+    auto [it, inserted] = emplace(key, std::forward<V>(value));
+    if (!inserted) {
+      it->second = std::forward<V>(value);
+    }
+    return inserted;
+  }
+
+  /**
+   * @brief Constructs the value for key from args at the back unless key
+   * is present.
+   *
+   * @throws std::length_error if the list already holds 2^32 - 1 entries
+   */
+  template <typename... Args>
+  auto emplace(const Key &key, Args &&...args) -> std::pair<iterator, bool> {
+    const index_type hash = hash_of(key);
+    if (const index_type found = find_node(key, hash); found != npos) {
+      return {iterator(this, found), false};
+    }
+    if (m_size == npos - 1) {
+      throw std::length_error("Hash list exceeds 32-bit index range");
+    }
+    if (m_size + 1 > index_limit(m_buckets.size())) {
+      rebuild_index(m_buckets.size() == 0 ? min_buckets
+                                          : m_buckets.size() * 2);
+    }
+    const index_type node = acquire();
+    try {
+      ::new (static_cast<void *>(m_slots[node].storage))
+          value_type(std::piecewise_construct, std::forward_as_tuple(key),
+                     std::forward_as_tuple(std::forward<Args>(args)...));
+    } catch (...) {
+      release(node);
+      throw;
+    }
+    m_slots[node].hash = hash;
+    link_back(node);
+    insert_bucket(node, hash);
+    ++m_size;
+    return {iterator(this, node), true};
+  }
+
+  /**
+   * @brief Removes the entry for key.
+   *
+   * @return number of removed entries (0 or 1)
+   */
+  auto erase(const Key &key) -> size_type {
+    const index_type node = find_node(key);
+    if (node == npos) {
+      return 0;
+    }
+    erase_node(node);
+    return 1;
+  }
+
+  /**
+   * @brief Removes the entry at pos.
+   *
+   * @return iterator following the removed entry in insertion order
+   * @throws std::out_of_range if pos is end()
+   */
+  auto erase(iterator pos) -> iterator {
+    if (pos.m_index == npos) {
+      throw std::out_of_range("Cannot erase end iterator");
+    }
+    const index_type next = m_slots[pos.m_index].next;
+    erase_node(pos.m_index);
+    return iterator(this, next);
+  }
+
+  /**
+   * @brief Removes the oldest entry, the one at front().
+   *
+   * @throws std::out_of_range if the list is empty
+   */
+  auto pop_front() -> void {
+    if (m_front == npos) {
+      throw std::out_of_range("Cannot remove from empty list");
+    }
+    erase_node(m_front);
+  }
+
+  /**
+   * @brief Relinks the entry for key at the back without moving it.
+   *
+   * @return true if key was present
+   */
+  auto move_to_back(const Key &key) -> bool {
+    const index_type node = find_node(key);
+    if (node == npos) {
+      return false;
+    }
+    relink_back(node);
+    return true;
+  }
+
+  /**
+   * @brief Relinks the entry at pos at the back; pos stays valid.
+   *
+   * @throws std::out_of_range if pos is end()
+   */
+  auto move_to_back(iterator pos) -> void {
+    if (pos.m_index == npos) {
+      throw std::out_of_range("Cannot move end iterator");
+    }
+    relink_back(pos.m_index);
+  }
+
+  auto clear() noexcept -> void {
+    destroy_entries();
+    m_used = 0;
+    m_size = 0;
+    m_free = npos;
+    m_front = npos;
+    m_back = npos;
+    for (auto &bucket : m_buckets) {
+      bucket.node = npos;
+    }
+  }
+
+  /**
+   * @brief Makes room for count entries without growing the node array or
+   * the index.
+   *
+   * @throws std::length_error if count exceeds the 32-bit index range
+   */
+  auto reserve(size_type count) -> void {
+    if (count >= npos) {
+      throw std::length_error("Hash list exceeds 32-bit index range");
+    }
+    if (count > index_limit(m_buckets.size())) {
+      rebuild_index(buckets_for(count));
+    }
+    if (count > m_capacity) {
+      reallocate(static_cast<index_type>(count));
+    }
+  }
+
+  /**
+   * @brief Renumbers the nodes so that node i holds the i-th entry in list
+   * order and the freelist is empty.
+   *
+   * Afterwards iteration reads the node array front to back. All iterators
+   * are invalidated.
+   */
+  auto compact() -> void {
+    if (m_size == 0) {
+      clear();
+      return;
+    }
+    auto *slots = details::allocate_elements<Slot>(m_capacity);
+    index_type moved = 0;
+    try {
+      for (index_type node = m_front; node != npos;
+           node = m_slots[node].next, ++moved) {
+        Slot &slot = slots[moved];
+        slot.prev = moved == 0 ? npos : moved - 1;
+        slot.next = moved + 1 == m_size ? npos : moved + 1;
+        slot.hash = m_slots[node].hash;
+        relocate_entry(m_slots[node], slot);
+      }
+    } catch (...) {
+      destroy_entries(slots, moved);
+      details::free_elements(slots);
+      throw;
+    }
+    release_entries();
+    details::free_elements(m_slots);
+    m_slots = slots;
+    m_used = m_size;
+    m_free = npos;
+    m_front = 0;
+    m_back = m_size - 1;
+    rebuild_index(m_buckets.size());
+  }
+
+  auto swap(HashList &other) noexcept -> void {
+    using std::swap;
+    swap(m_slots, other.m_slots);
+    swap(m_capacity, other.m_capacity);
+    swap(m_used, other.m_used);
+    swap(m_size, other.m_size);
+    swap(m_free, other.m_free);
+    swap(m_front, other.m_front);
+    swap(m_back, other.m_back);
+    swap(m_buckets, other.m_buckets);
+    swap(m_hash, other.m_hash);
+    swap(m_equal, other.m_equal);
+  }
+
+  // Capacity
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_size == 0; }
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return m_capacity;
+  }
+  [[nodiscard]] auto bucket_count() const noexcept -> size_type {
+    return m_buckets.size();
+  }
+
+  // Iterators
+  auto begin() noexcept -> iterator { return iterator(this, m_front); }
+  auto end() noexcept -> iterator { return iterator(this, npos); }
+  auto begin() const noexcept -> const_iterator {
+    return const_iterator(this, m_front);
+  }
+  auto end() const noexcept -> const_iterator {
+    return const_iterator(this, npos);
+  }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+
+private:
+  static constexpr size_type min_buckets = 16;
+
+  // The index stays at most 3/4 full, which keeps linear probe runs short.
+  static auto index_limit(size_type buckets) noexcept -> size_type {
+    return buckets - buckets / 4;
+  }
+
+  static auto buckets_for(size_type count) noexcept -> size_type {
+    size_type buckets = min_buckets;
+    while (index_limit(buckets) < count) {
+      buckets *= 2;
+    }
+    return buckets;
+  }
+
+  auto hash_of(const Key &key) const -> index_type {
+    return static_cast<index_type>(details::mix_hash(m_hash(key)));
+  }
+
+  auto find_node(const Key &key) const -> index_type {
+    return find_node(key, hash_of(key));
+  }
+
+  auto find_node(const Key &key, index_type hash) const -> index_type {
+    if (m_buckets.size() == 0) {
+      return npos;
+    }
+    const size_type mask = m_buckets.size() - 1;
+    for (size_type i = hash & mask;; i = (i + 1) & mask) {
+      const Bucket &bucket = m_buckets[i];
+      if (bucket.node == npos) {
+        return npos;
+      }
+      if (bucket.hash == hash &&
+          m_equal(m_slots[bucket.node].data().first, key)) {
+        return bucket.node;
+      }
+    }
+  }
+
+  auto checked_node(const Key &key) const -> index_type {
+    const index_type node = find_node(key);
+    if (node == npos) {
+      throw std::out_of_range("Key not found in map");
+    }
+    return node;
+  }
+
+  auto insert_bucket(index_type node, index_type hash) noexcept -> void {
+    const size_type mask = m_buckets.size() - 1;
+    size_type i = hash & mask;
+    while (m_buckets[i].node != npos) {
+      i = (i + 1) & mask;
+    }
+    m_buckets[i] = Bucket{node, hash};
+  }
+
+  // Backward-shift deletion: later buckets of the probe run move into the
+  // hole whenever their home position does not lie after it, so lookups
+  // can keep stopping at the first empty bucket.
+  auto erase_bucket(index_type node) noexcept -> void {
+    const size_type mask = m_buckets.size() - 1;
+    size_type hole = m_slots[node].hash & mask;
+    while (m_buckets[hole].node != node) {
+      hole = (hole + 1) & mask;
+    }
+    for (size_type i = (hole + 1) & mask; m_buckets[i].node != npos;
+         i = (i + 1) & mask) {
+      const size_type home = m_buckets[i].hash & mask;
+      if (((i - home) & mask) >= ((i - hole) & mask)) {
+        m_buckets[hole] = m_buckets[i];
+        hole = i;
+      }
+    }
+    m_buckets[hole].node = npos;
+  }
+
+  auto rebuild_index(size_type buckets) -> void {
+    Vector<Bucket> fresh;
+    fresh.resize(buckets, Bucket{npos, 0});
+    m_buckets = std::move(fresh);
+    for (index_type node = m_front; node != npos; node = m_slots[node].next) {
+      insert_bucket(node, m_slots[node].hash);
+    }
+  }
+
+  auto acquire() -> index_type {
+    if (m_free != npos) {
+      const index_type node = m_free;
+      m_free = m_slots[node].next;
+      return node;
+    }
+    if (m_used == m_capacity) {
+      const size_type grown =
+          m_capacity == 0 ? 8 : static_cast<size_type>(m_capacity) * 2;
+      reallocate(static_cast<index_type>(
+          grown < npos ? grown : static_cast<size_type>(npos - 1)));
+    }
+    return m_used++;
+  }
+
+  auto release(index_type node) noexcept -> void {
+    m_slots[node].next = m_free;
+    m_free = node;
+  }
+
+  auto link_back(index_type node) noexcept -> void {
+    m_slots[node].prev = m_back;
+    m_slots[node].next = npos;
+    if (m_back == npos) {
+      m_front = node;
+    } else {
+      m_slots[m_back].next = node;
+    }
+    m_back = node;
+  }
+
+  auto unlink(index_type node) noexcept -> void {
+    const index_type prev = m_slots[node].prev;
+    const index_type next = m_slots[node].next;
+    (prev == npos ? m_front : m_slots[prev].next) = next;
+    (next == npos ? m_back : m_slots[next].prev) = prev;
+  }
+
+  auto relink_back(index_type node) noexcept -> void {
+    if (node != m_back) {
+      unlink(node);
+      link_back(node);
+    }
+  }
+
+  auto erase_node(index_type node) -> void {
+    erase_bucket(node);
+    unlink(node);
+    std::destroy_at(std::addressof(m_slots[node].data()));
+    release(node);
+    --m_size;
+  }
+
+  static auto relocate_entry(Slot &from, Slot &to) -> void {
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      std::memcpy(to.storage, from.storage, sizeof(value_type));
+    } else {
+      ::new (static_cast<void *>(to.storage))
+          value_type(std::move_if_noexcept(from.data()));
+    }
+  }
+
+  // Entries are copied or moved before any source is destroyed, so a
+  // throwing copy leaves the old array intact.
+  auto reallocate(index_type new_capacity) -> void {
+    auto *slots = details::allocate_elements<Slot>(new_capacity);
+    if (m_used > 0) {
+      std::memcpy(static_cast<void *>(slots),
+                  static_cast<const void *>(m_slots),
+                  static_cast<size_type>(m_used) * sizeof(Slot));
+    }
+    if constexpr (!is_trivially_relocatable_v<value_type>) {
+      index_type node = m_front;
+      try {
+        for (; node != npos; node = m_slots[node].next) {
+          relocate_entry(m_slots[node], slots[node]);
+        }
+      } catch (...) {
+        for (index_type done = m_front; done != node;
+             done = m_slots[done].next) {
+          std::destroy_at(std::addressof(slots[done].data()));
+        }
+        details::free_elements(slots);
+        throw;
+      }
+    }
+    release_entries();
+    details::free_elements(m_slots);
+    m_slots = slots;
+    m_capacity = new_capacity;
+  }
+
+  // Ends the lifetime of the entries whose values were relocated elsewhere.
+  auto release_entries() noexcept -> void {
+    if constexpr (!is_trivially_relocatable_v<value_type>) {
+      destroy_entries();
+    }
+  }
+
+  auto destroy_entries() noexcept -> void {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (index_type node = m_front; node != npos; node = m_slots[node].next) {
+        std::destroy_at(std::addressof(m_slots[node].data()));
+      }
+    }
+  }
+
+  static auto destroy_entries(Slot *slots, index_type count) noexcept
+      -> void {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (index_type i = 0; i < count; ++i) {
+        std::destroy_at(std::addressof(slots[i].data()));
+      }
+    }
+  }
+};
+
+#endif // __HASH_LIST_HPP__
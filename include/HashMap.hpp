@@ -0,0 +1,816 @@
+#ifndef __HASH_MAP_HPP__
+#define __HASH_MAP_HPP__
+
+#include "Vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HASH_MAP_SSE2 1
+#endif
+
+namespace details {
+// Control byte per slot: 0..127 holds the low 7 bits of a full slot's hash,
+// negative values mark empty, deleted and the end-of-table sentinel.
+using ctrl_t = signed char;
+
+inline constexpr ctrl_t ctrl_empty = -128;
+inline constexpr ctrl_t ctrl_deleted = -2;
+inline constexpr ctrl_t ctrl_sentinel = -1;
+inline constexpr std::size_t group_width = 16;
+
+[[nodiscard]] constexpr auto is_full(ctrl_t ctrl) noexcept -> bool {
+  return ctrl >= 0;
+}
+
+// Control bytes of a table without slots: probes find an empty byte at
+// once and iteration stops at the sentinel.
+alignas(group_width) inline constexpr ctrl_t empty_group[group_width] = {
+    ctrl_sentinel, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty,
+    ctrl_empty,    ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty,
+    ctrl_empty,    ctrl_empty, ctrl_empty, ctrl_empty};
+
+[[nodiscard]] inline auto trailing_zeros(std::uint32_t mask) noexcept
+    -> unsigned {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned>(__builtin_ctz(mask));
+#else
+  unsigned count = 0;
+  while ((mask & 1U) == 0) {
+    mask >>= 1;
+    ++count;
+  }
+  return count;
+#endif
+}
+
+// Leading zeros of a non-zero 16-bit group mask.
+[[nodiscard]] inline auto leading_zeros16(std::uint32_t mask) noexcept
+    -> unsigned {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned>(__builtin_clz(mask)) - 16;
+#else
+  unsigned count = 0;
+  for (std::uint32_t bit = 1U << 15; (mask & bit) == 0; bit >>= 1) {
+    ++count;
+  }
+  return count;
+#endif
+}
+
+/**
+ * @brief Sixteen control bytes matched at once; bit i of each mask stands
+ * for byte i. Uses one SSE2 compare per query, or a byte loop elsewhere.
+ */
+class ControlGroup {
+private:
+#ifdef HASH_MAP_SSE2
+  __m128i m_ctrl;
+#else
+  ctrl_t m_ctrl[group_width];
+#endif
+
+public:
+  explicit ControlGroup(const ctrl_t *ctrl) noexcept {
+#ifdef HASH_MAP_SSE2
+    m_ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+#else
+    std::memcpy(m_ctrl, ctrl, group_width);
+#endif
+  }
+
+  [[nodiscard]] auto match(ctrl_t h2) const noexcept -> std::uint32_t {
+#ifdef HASH_MAP_SSE2
+    return static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl)));
+#else
+    return match_if([h2](ctrl_t c) { return c == h2; });
+#endif
+  }
+
+  [[nodiscard]] auto match_empty() const noexcept -> std::uint32_t {
+    return match(ctrl_empty);
+  }
+
+  [[nodiscard]] auto match_empty_or_deleted() const noexcept
+      -> std::uint32_t {
+#ifdef HASH_MAP_SSE2
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(
+        _mm_cmpgt_epi8(_mm_set1_epi8(ctrl_sentinel), m_ctrl)));
+#else
+    return match_if([](ctrl_t c) { return c < ctrl_sentinel; });
+#endif
+  }
+
+#ifndef HASH_MAP_SSE2
+private:
+  template <typename Predicate>
+  auto match_if(Predicate predicate) const noexcept -> std::uint32_t {
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < group_width; ++i) {
+      mask |= static_cast<std::uint32_t>(predicate(m_ctrl[i])) << i;
+    }
+    return mask;
+  }
+#endif
+};
+
+// Spreads the bits of weak hashes such as the identity std::hash<int> so
+// both the probe start (high bits) and the control byte (low 7 bits) vary.
+[[nodiscard]] inline auto mix_hash(std::size_t hash) noexcept -> std::size_t {
+  auto h = static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ULL;
+  return static_cast<std::size_t>(h ^ (h >> 32));
+}
+
+// Lookups take foreign key types only when both functors opt in.
+template <typename Hash, typename KeyEqual, typename = void>
+struct is_transparent_lookup : std::false_type {};
+
+template <typename Hash, typename KeyEqual>
+struct is_transparent_lookup<Hash, KeyEqual,
+                             std::void_t<typename Hash::is_transparent,
+                                         typename KeyEqual::is_transparent>>
+    : std::true_type {};
+
+template <typename Hash, typename KeyEqual, typename K>
+using enable_if_transparent_t =
+    std::enable_if_t<is_transparent_lookup<Hash, KeyEqual>::value, K>;
+} // namespace details
+
+/**
+ * @brief Forward iterator for HashMap container
+ *
+ * @tparam MapType The map container type this iterator is for
+ */
+template <typename MapType> class HashMap_Iterator {
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename MapType::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = value_type *;
+  using reference = value_type &;
+
+public:
+  constexpr explicit HashMap_Iterator(const details::ctrl_t *ctrl = nullptr,
+                                      pointer slot = nullptr) noexcept
+      : m_ctrl(ctrl), m_slot(slot) {
+    skip_free();
+  }
+
+  auto operator++() noexcept -> HashMap_Iterator & {
+    ++m_ctrl;
+    ++m_slot;
+    skip_free();
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> HashMap_Iterator {
+    HashMap_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference { return *m_slot; }
+  auto operator->() const noexcept -> pointer { return m_slot; }
+
+  auto operator==(const HashMap_Iterator &other) const noexcept -> bool {
+    return m_ctrl == other.m_ctrl;
+  }
+
+  auto operator!=(const HashMap_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  friend MapType;
+
+  // Empty and deleted bytes sort below the sentinel, which ends the walk.
+  constexpr auto skip_free() noexcept -> void {
+    while (m_ctrl != nullptr && *m_ctrl < details::ctrl_sentinel) {
+      ++m_ctrl;
+      ++m_slot;
+    }
+  }
+
+  const details::ctrl_t *m_ctrl;
+  pointer m_slot;
+};
+
+/**
+ * @brief Const forward iterator for HashMap container
+ *
+ * @tparam MapType The map container type this const iterator is for
+ */
+template <typename MapType> class cHashMap_Iterator {
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename MapType::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type *;
+  using reference = const value_type &;
+
+public:
+  constexpr explicit cHashMap_Iterator(const details::ctrl_t *ctrl = nullptr,
+                                       pointer slot = nullptr) noexcept
+      : m_ctrl(ctrl), m_slot(slot) {
+    skip_free();
+  }
+
+  auto operator++() noexcept -> cHashMap_Iterator & {
+    ++m_ctrl;
+    ++m_slot;
+    skip_free();
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> cHashMap_Iterator {
+    cHashMap_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference { return *m_slot; }
+  auto operator->() const noexcept -> pointer { return m_slot; }
+
+  auto operator==(const cHashMap_Iterator &other) const noexcept -> bool {
+    return m_ctrl == other.m_ctrl;
+  }
+
+  auto operator!=(const cHashMap_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  friend MapType;
+
+  constexpr auto skip_free() noexcept -> void {
+    while (m_ctrl != nullptr && *m_ctrl < details::ctrl_sentinel) {
+      ++m_ctrl;
+      ++m_slot;
+    }
+  }
+
+  const details::ctrl_t *m_ctrl;
+  pointer m_slot;
+};
+
+/**
+ * @brief Open-addressing hash map with one control byte per slot
+ *
+ * @tparam Key Key type
+ * @tparam Value Mapped type
+ * @tparam Hash Hash function; with Hash::is_transparent and
+ * KeyEqual::is_transparent, lookups accept any key-comparable type
+ * @tparam KeyEqual Key equality
+ *
+ * Entries live in one flat slot array next to a control byte array. A
+ * lookup compares the 7-bit hash fragment against 16 control bytes with a
+ * single SSE2 instruction and only touches slots whose fragment matched.
+ * The table keeps at least 1/8 of its slots free. An erased slot becomes
+ * empty again unless a probe may have passed over it, so tombstones only
+ * appear in crowded regions and are dropped on the next rehash.
+ *
+ * Rehashing moves entries, invalidating iterators and references; types
+ * marked is_trivially_relocatable move by memcpy.
+ *
+ * Complexity guarantees:
+ * - find(), contains(), at(), operator[](): O(1) average
+ * - insert(), emplace(), insert_or_assign(): O(1) amortized
+ * - erase(): O(1) average
+ * - reserve(n): O(n + capacity())
+ * - size(), is_empty(), capacity(): O(1)
+ *
+ * @example
+ * HashMap<std::string, int> counts;
+ * counts["apple"] += 1;
+ * counts.insert("pear", 3);
+ * assert(counts.contains("pear") && counts.at("apple") == 1);
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class HashMap {
+public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key, Value>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = HashMap_Iterator<HashMap>;
+  using const_iterator = cHashMap_Iterator<HashMap>;
+
+private:
+  using ctrl_t = details::ctrl_t;
+  static constexpr size_type group_width = details::group_width;
+  static constexpr size_type npos = static_cast<size_type>(-1);
+  static constexpr size_type alignment =
+      alignof(value_type) > alignof(void *) ? alignof(value_type)
+                                            : alignof(void *);
+
+  ctrl_t *m_ctrl{const_cast<ctrl_t *>(details::empty_group)};
+  value_type *m_slots{nullptr};
+  size_type m_capacity{0};
+  size_type m_size{0};
+  size_type m_growth_left{0};
+  Hash m_hash;
+  KeyEqual m_equal;
+
+public:
+  // Constructors
+  HashMap() = default;
+
+  explicit HashMap(size_type count, const Hash &hash = Hash(),
+                   const KeyEqual &equal = KeyEqual())
+      : m_hash(hash), m_equal(equal) {
+    reserve(count);
+  }
+
+  HashMap(std::initializer_list<value_type> init_list) {
+    reserve(init_list.size());
+    for (const auto &entry : init_list) {
+      emplace(entry.first, entry.second);
+    }
+  }
+
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  HashMap(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      emplace(first->first, first->second);
+    }
+  }
+
+  HashMap(const HashMap &other) : m_hash(other.m_hash), m_equal(other.m_equal) {
+    reserve(other.m_size);
+    for (const auto &entry : other) {
+      const size_type hash = hash_of(entry.first);
+      const size_type index = prepare_insert(hash);
+      ::new (static_cast<void *>(m_slots + index)) value_type(entry);
+      commit_insert(index, hash);
+    }
+  }
+
+  HashMap(HashMap &&other) noexcept
+      : m_hash(other.m_hash), m_equal(other.m_equal) {
+    swap(other);
+  }
+
+  auto operator=(const HashMap &other) -> HashMap & {
+    if (this != &other) {
+      HashMap temp(other);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  auto operator=(HashMap &&other) noexcept -> HashMap & {
+    swap(other);
+    return *this;
+  }
+
+  ~HashMap() {
+    destroy_slots();
+    deallocate(m_ctrl, m_capacity);
+  }
+
+  // Lookup
+  [[nodiscard]] auto find(const Key &key) -> iterator {
+    return iterator_at(find_index(key));
+  }
+
+  [[nodiscard]] auto find(const Key &key) const -> const_iterator {
+    return iterator_at(find_index(key));
+  }
+
+  template <typename K,
+            typename = details::enable_if_transparent_t<Hash, KeyEqual, K>>
+  [[nodiscard]] auto find(const K &key) -> iterator {
+    return iterator_at(find_index(key));
+  }
+
+  template <typename K,
+            typename = details::enable_if_transparent_t<Hash, KeyEqual, K>>
+  [[nodiscard]] auto find(const K &key) const -> const_iterator {
+    return iterator_at(find_index(key));
+  }
+
+  [[nodiscard]] auto contains(const Key &key) const -> bool {
+    return find_index(key) != npos;
+  }
+
+  template <typename K,
+            typename = details::enable_if_transparent_t<Hash, KeyEqual, K>>
+  [[nodiscard]] auto contains(const K &key) const -> bool {
+    return find_index(key) != npos;
+  }
+
+  [[nodiscard]] auto at(const Key &key) -> Value & {
+    return m_slots[checked_index(key)].second;
+  }
+
+  [[nodiscard]] auto at(const Key &key) const -> const Value & {
+    return m_slots[checked_index(key)].second;
+  }
+
+  template <typename K,
+            typename = details::enable_if_transparent_t<Hash, KeyEqual, K>>
+  [[nodiscard]] auto at(const K &key) -> Value & {
+    return m_slots[checked_index(key)].second;
+  }
+
+  template <typename K,
+            typename = details::enable_if_transparent_t<Hash, KeyEqual, K>>
+  [[nodiscard]] auto at(const K &key) const -> const Value & {
+    return m_slots[checked_index(key)].second;
+  }
+
+  auto operator[](const Key &key) -> Value & {
+    return emplace(key).first->second;
+  }
+
+  // Modifiers
+  /**
+   * @brief Inserts (key, value) unless key is already present.
+   *
+   * @return iterator to the entry for key and whether it was inserted
+   */
+  auto insert(const Key &key, const Value &value) -> std::pair<iterator, bool> {
+    return emplace(key, value);
+  }
+
+  auto insert(const Key &key, Value &&value) -> std::pair<iterator, bool> {
+    return emplace(key, std::move(value));
+  }
+
+  /**
+   * @brief Inserts or overwrites the value for key.
+   *
+   * @return true if a new entry was inserted
+   */
+  template <typename V> auto insert_or_assign(const Key &key, V &&value) -> bool {
+    auto [it, inserted] = emplace(key, std::forward<V>(value));
+    if (!inserted) {
+      it->second = std::forward<V>(value);
+    }
+    return inserted;
+  }
+
+  /**
+   * @brief Constructs the value for key from args unless key is present.
+   */
+  template <typename... Args>
+  auto emplace(const Key &key, Args &&...args) -> std::pair<iterator, bool> {
+    const size_type hash = hash_of(key);
+    if (const size_type found = find_index(key, hash); found != npos) {
+      return {iterator_at(found), false};
+    }
+    const size_type index = prepare_insert(hash);
+    ::new (static_cast<void *>(m_slots + index))
+        value_type(std::piecewise_construct, std::forward_as_tuple(key),
+                   std::forward_as_tuple(std::forward<Args>(args)...));
+    commit_insert(index, hash);
+    return {iterator_at(index), true};
+  }
+
+  /**
+   * @brief Removes the entry for key.
+   *
+   * @return number of removed entries (0 or 1)
+   */
+  auto erase(const Key &key) -> size_type { return erase_index(find_index(key)); }
+
+  template <typename K,
+            typename = details::enable_if_transparent_t<Hash, KeyEqual, K>>
+  auto erase(const K &key) -> size_type {
+    return erase_index(find_index(key));
+  }
+
+  /**
+   * @brief Removes the entry at pos.
+   *
+   * @return iterator following the removed entry
+   * @throws std::out_of_range if pos is end()
+   */
+  auto erase(iterator pos) -> iterator {
+    if (pos == end()) {
+      throw std::out_of_range("Cannot erase end iterator");
+    }
+    erase_index(static_cast<size_type>(pos.m_slot - m_slots));
+    return ++pos;
+  }
+
+  auto clear() noexcept -> void {
+    destroy_slots();
+    if (m_capacity > 0) {
+      reset_ctrl();
+    }
+    m_size = 0;
+    m_growth_left = growth_limit(m_capacity);
+  }
+
+  /**
+   * @brief Makes room for count entries without further rehashing.
+   */
+  auto reserve(size_type count) -> void {
+    if (count > m_size + m_growth_left) {
+      resize(capacity_for(count));
+    }
+  }
+
+  auto swap(HashMap &other) noexcept -> void {
+    using std::swap;
+    swap(m_ctrl, other.m_ctrl);
+    swap(m_slots, other.m_slots);
+    swap(m_capacity, other.m_capacity);
+    swap(m_size, other.m_size);
+    swap(m_growth_left, other.m_growth_left);
+    swap(m_hash, other.m_hash);
+    swap(m_equal, other.m_equal);
+  }
+
+  // Capacity
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_size == 0; }
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return m_capacity;
+  }
+  [[nodiscard]] auto load_factor() const noexcept -> float {
+    return m_capacity == 0 ? 0.0F
+                           : static_cast<float>(m_size) /
+                                 static_cast<float>(m_capacity);
+  }
+
+  // Iterators
+  auto begin() noexcept -> iterator { return iterator(m_ctrl, m_slots); }
+  auto end() noexcept -> iterator {
+    return iterator(m_ctrl + m_capacity, m_slots + m_capacity);
+  }
+  auto begin() const noexcept -> const_iterator {
+    return const_iterator(m_ctrl, m_slots);
+  }
+  auto end() const noexcept -> const_iterator {
+    return const_iterator(m_ctrl + m_capacity, m_slots + m_capacity);
+  }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+
+private:
+  // Triangular probing over group-sized steps; with a power-of-two slot
+  // count this visits every group once before repeating.
+  struct ProbeSequence {
+    size_type offset;
+    size_type mask;
+    size_type step{0};
+
+    auto next() noexcept -> void {
+      step += group_width;
+      offset = (offset + step) & mask;
+    }
+  };
+
+  static auto h1(size_type hash) noexcept -> size_type { return hash >> 7; }
+  static auto h2(size_type hash) noexcept -> ctrl_t {
+    return static_cast<ctrl_t>(hash & 0x7F);
+  }
+
+  // Capacities are 2^k - 1 so the sentinel sits at index capacity and
+  // `index & capacity` wraps probe positions.
+  static auto growth_limit(size_type capacity) noexcept -> size_type {
+    return capacity - capacity / 8;
+  }
+
+  static auto capacity_for(size_type count) noexcept -> size_type {
+    size_type capacity = group_width - 1;
+    while (growth_limit(capacity) < count) {
+      capacity = capacity * 2 + 1;
+    }
+    return capacity;
+  }
+
+  template <typename K> auto hash_of(const K &key) const -> size_type {
+    return details::mix_hash(m_hash(key));
+  }
+
+  auto iterator_at(size_type index) noexcept -> iterator {
+    return index == npos ? end() : iterator(m_ctrl + index, m_slots + index);
+  }
+
+  auto iterator_at(size_type index) const noexcept -> const_iterator {
+    return index == npos ? end()
+                         : const_iterator(m_ctrl + index, m_slots + index);
+  }
+
+  template <typename K> auto find_index(const K &key) const -> size_type {
+    return find_index(key, hash_of(key));
+  }
+
+  template <typename K>
+  auto find_index(const K &key, size_type hash) const -> size_type {
+    ProbeSequence probe{h1(hash) & m_capacity, m_capacity};
+    const ctrl_t fragment = h2(hash);
+    while (true) {
+      const details::ControlGroup group(m_ctrl + probe.offset);
+      for (std::uint32_t match = group.match(fragment); match != 0;
+           match &= match - 1) {
+        const size_type index =
+            (probe.offset + details::trailing_zeros(match)) & m_capacity;
+        if (m_equal(m_slots[index].first, key)) {
+          return index;
+        }
+      }
+      if (group.match_empty() != 0) {
+        return npos;
+      }
+      probe.next();
+    }
+  }
+
+  template <typename K> auto checked_index(const K &key) const -> size_type {
+    const size_type index = find_index(key);
+    if (index == npos) {
+      throw std::out_of_range("Key not found in map");
+    }
+    return index;
+  }
+
+  auto find_first_free(size_type hash) const noexcept -> size_type {
+    ProbeSequence probe{h1(hash) & m_capacity, m_capacity};
+    while (true) {
+      const details::ControlGroup group(m_ctrl + probe.offset);
+      if (const std::uint32_t free = group.match_empty_or_deleted()) {
+        return (probe.offset + details::trailing_zeros(free)) & m_capacity;
+      }
+      probe.next();
+    }
+  }
+
+  // Slot for a new entry with the given hash; the caller constructs it and
+  // then calls commit_insert.
+  auto prepare_insert(size_type hash) -> size_type {
+    size_type index = find_first_free(hash);
+    if (m_growth_left == 0 && m_ctrl[index] != details::ctrl_deleted) {
+      grow();
+      index = find_first_free(hash);
+    }
+    return index;
+  }
+
+  auto commit_insert(size_type index, size_type hash) noexcept -> void {
+    if (m_ctrl[index] == details::ctrl_empty) {
+      --m_growth_left;
+    }
+    set_ctrl(index, h2(hash));
+    ++m_size;
+  }
+
+  // Writes a control byte and its clone past the sentinel, which lets a
+  // group load starting near the end read the first slots.
+  auto set_ctrl(size_type index, ctrl_t value) noexcept -> void {
+    m_ctrl[index] = value;
+    m_ctrl[((index - (group_width - 1)) & m_capacity) +
+           ((group_width - 1) & m_capacity)] = value;
+  }
+
+  auto erase_index(size_type index) -> size_type {
+    if (index == npos) {
+      return 0;
+    }
+    std::destroy_at(m_slots + index);
+    --m_size;
+    // If no group-width window around the slot was ever full, no probe
+    // sequence continued past it and the slot can become empty again.
+    const size_type before = (index - group_width) & m_capacity;
+    const std::uint32_t empty_after =
+        details::ControlGroup(m_ctrl + index).match_empty();
+    const std::uint32_t empty_before =
+        details::ControlGroup(m_ctrl + before).match_empty();
+    const bool never_full =
+        empty_before != 0 && empty_after != 0 &&
+        details::trailing_zeros(empty_after) +
+                details::leading_zeros16(empty_before) <
+            group_width;
+    if (never_full) {
+      set_ctrl(index, details::ctrl_empty);
+      ++m_growth_left;
+    } else {
+      set_ctrl(index, details::ctrl_deleted);
+    }
+    return 1;
+  }
+
+  // Rehashes in place when tombstones rather than entries fill the table.
+  auto grow() -> void {
+    if (m_capacity > group_width && m_size * 32 <= m_capacity * 25) {
+      resize(m_capacity);
+    } else {
+      resize(m_capacity == 0 ? group_width - 1 : m_capacity * 2 + 1);
+    }
+  }
+
+  static auto slots_offset(size_type capacity) noexcept -> size_type {
+    return (capacity + group_width + alignment - 1) / alignment * alignment;
+  }
+
+  static auto deallocate(ctrl_t *ctrl, size_type capacity) noexcept -> void {
+    if (capacity > 0) {
+      ::operator delete(static_cast<void *>(ctrl),
+                        std::align_val_t{alignment});
+    }
+  }
+
+  auto reset_ctrl() noexcept -> void {
+    std::memset(m_ctrl, static_cast<unsigned char>(details::ctrl_empty),
+                m_capacity + group_width);
+    m_ctrl[m_capacity] = details::ctrl_sentinel;
+  }
+
+  auto resize(size_type new_capacity) -> void {
+    if (new_capacity > (static_cast<size_type>(-1) - slots_offset(0)) /
+                           (sizeof(value_type) + 1)) {
+      throw std::length_error("HashMap capacity overflow");
+    }
+    auto *block = static_cast<unsigned char *>(::operator new(
+        slots_offset(new_capacity) + new_capacity * sizeof(value_type),
+        std::align_val_t{alignment}));
+
+    ctrl_t *old_ctrl = m_ctrl;
+    value_type *old_slots = m_slots;
+    const size_type old_capacity = m_capacity;
+
+    m_ctrl = reinterpret_cast<ctrl_t *>(block);
+    m_slots = reinterpret_cast<value_type *>(block + slots_offset(new_capacity));
+    m_capacity = new_capacity;
+    reset_ctrl();
+
+    // Entries are copied or moved before any source is destroyed, so a
+    // throwing copy leaves the old table intact.
+    size_type moved = 0;
+    try {
+      for (size_type i = 0; i < old_capacity; ++i) {
+        if (!details::is_full(old_ctrl[i])) {
+          continue;
+        }
+        const size_type hash = hash_of(old_slots[i].first);
+        const size_type index = find_first_free(hash);
+        if constexpr (is_trivially_relocatable_v<value_type>) {
+          std::memcpy(static_cast<void *>(m_slots + index),
+                      static_cast<const void *>(old_slots + i),
+                      sizeof(value_type));
+        } else {
+          ::new (static_cast<void *>(m_slots + index))
+              value_type(std::move_if_noexcept(old_slots[i]));
+        }
+        set_ctrl(index, h2(hash));
+        ++moved;
+      }
+    } catch (...) {
+      if constexpr (!is_trivially_relocatable_v<value_type>) {
+        destroy_slots();
+      }
+      ::operator delete(static_cast<void *>(block),
+                        std::align_val_t{alignment});
+      m_ctrl = old_ctrl;
+      m_slots = old_slots;
+      m_capacity = old_capacity;
+      throw;
+    }
+
+    if constexpr (!is_trivially_relocatable_v<value_type>) {
+      for (size_type i = 0; i < old_capacity; ++i) {
+        if (details::is_full(old_ctrl[i])) {
+          std::destroy_at(old_slots + i);
+        }
+      }
+    }
+    deallocate(old_ctrl, old_capacity);
+    m_growth_left = growth_limit(m_capacity) - moved;
+  }
+
+  auto destroy_slots() noexcept -> void {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (size_type i = 0; i < m_capacity; ++i) {
+        if (details::is_full(m_ctrl[i])) {
+          std::destroy_at(m_slots + i);
+        }
+      }
+    }
+  }
+};
+
+#endif // __HASH_MAP_HPP__
@@ -0,0 +1,571 @@
+#ifndef __HASH_MATRIX_HPP__
+#define __HASH_MATRIX_HPP__
+
+#include "HashMap.hpp"
+#include "Vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace details {
+template <typename Col, typename Value> struct MatrixCell {
+  Col col;
+  Value value;
+};
+
+// Where one row's hash table lives inside the shared cell array.
+struct MatrixRowSpan {
+  std::size_t offset;
+  std::uint32_t capacity;
+  std::uint32_t size;
+};
+} // namespace details
+
+/**
+ * @brief Heap bytes held by a HashMatrix, by purpose.
+ *
+ * Bytes owned by the keys and values themselves, such as string buffers,
+ * are not included.
+ */
+struct HashMatrixMemory {
+  std::size_t row_index_bytes; // row key -> row table lookup
+  std::size_t cell_bytes;      // slots holding a cell
+  std::size_t free_bytes;      // empty slots inside the row tables
+  std::size_t dead_bytes;      // slots of abandoned row tables
+  std::size_t reserved_bytes;  // cell array capacity past its end
+
+  [[nodiscard]] auto total_bytes() const noexcept -> std::size_t {
+    return row_index_bytes + cell_bytes + free_bytes + dead_bytes +
+           reserved_bytes;
+  }
+};
+
+/**
+ * @brief Sparse two-dimensional map from (row, column) to value with rows
+ * of any length
+ *
+ * @tparam Row Row key type
+ * @tparam Col Column key type
+ * @tparam Value Cell value type
+ * @tparam RowHash Hash function for rows
+ * @tparam ColHash Hash function for columns
+ *
+ * @requires Col and Value must be default constructible and move assignable
+ *
+ * Every row owns a small linear-probing hash table over its columns. All
+ * row tables are carved out of one shared cell array, next to a byte per
+ * slot holding a 7-bit hash fragment, and a HashMap finds a row's table
+ * from its key. A cell lookup is one row lookup plus a probe that usually
+ * reads a single slot, and a row is iterated by scanning its contiguous
+ * slots. Nothing is allocated per row.
+ *
+ * A full row table moves to the end of the cell array at twice its size,
+ * or grows in place when it already is the last table, and erased rows
+ * leave their slots behind; once such dead slots make up half the array
+ * it is compacted. Rows hold at most 3/4 of their slots
+ * (all of them in tables of up to 4 slots, which are scanned in full).
+ * Inserting or erasing invalidates references to values.
+ *
+ * Complexity guarantees:
+ * - find(), contains(), at(), operator()(): O(1) average
+ * - insert(), emplace(), insert_or_assign(): O(1) amortized
+ * - erase(): O(1) average
+ * - erase_row(), for_each_in_row(): O(row capacity)
+ * - for_each(), compact(): O(cells + rows)
+ * - size(), row_count(), row_size(): O(1) average
+ *
+ * @example
+ * HashMatrix<int, std::string, double> features;
+ * features(7, "age") = 31;
+ * features.insert(7, "score", 0.5);
+ * features.for_each_in_row(7, [](const std::string &, double &v) {
+ *   v *= 2;
+ * });
+ * features.erase_row(7);
+ */
+template <typename Row, typename Col, typename Value,
+          typename RowHash = std::hash<Row>, typename ColHash = std::hash<Col>>
+class HashMatrix {
+public:
+  using row_type = Row;
+  using column_type = Col;
+  using value_type = Value;
+  using size_type = std::size_t;
+
+private:
+  using Cell = details::MatrixCell<Col, Value>;
+  using Span = details::MatrixRowSpan;
+  using RowIndex = HashMap<Row, Span, RowHash>;
+
+  static constexpr size_type npos = static_cast<size_type>(-1);
+  static constexpr std::uint8_t ctrl_empty = 0;
+  static constexpr std::uint32_t max_row_capacity = std::uint32_t{1} << 31;
+
+  RowIndex m_rows;
+  Vector<Cell> m_cells;
+  Vector<std::uint8_t> m_ctrl;
+  size_type m_size{0};
+  size_type m_dead{0};
+  ColHash m_col_hash;
+
+public:
+  // Constructors
+  HashMatrix() = default;
+  HashMatrix(const HashMatrix &other) = default;
+
+  HashMatrix(HashMatrix &&other) noexcept { swap(other); }
+
+  auto operator=(const HashMatrix &other) -> HashMatrix & {
+    if (this != &other) {
+      HashMatrix temp(other);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  auto operator=(HashMatrix &&other) noexcept -> HashMatrix & {
+    swap(other);
+    return *this;
+  }
+
+  ~HashMatrix() = default;
+
+  // Lookup
+  /**
+   * @brief Returns a pointer to the value at (row, col), or nullptr.
+   */
+  [[nodiscard]] auto find(const Row &row, const Col &col) -> Value * {
+    const size_type at = find_cell(row, col);
+    return at == npos ? nullptr : &m_cells[at].value;
+  }
+
+  [[nodiscard]] auto find(const Row &row, const Col &col) const
+      -> const Value * {
+    const size_type at = find_cell(row, col);
+    return at == npos ? nullptr : &m_cells[at].value;
+  }
+
+  [[nodiscard]] auto contains(const Row &row, const Col &col) const -> bool {
+    return find_cell(row, col) != npos;
+  }
+
+  [[nodiscard]] auto at(const Row &row, const Col &col) -> Value & {
+    return m_cells[checked_cell(row, col)].value;
+  }
+
+  [[nodiscard]] auto at(const Row &row, const Col &col) const
+      -> const Value & {
+    return m_cells[checked_cell(row, col)].value;
+  }
+
+  /**
+   * @brief Returns the value at (row, col), inserting a value-initialized
+   * one first if the cell is empty.
+   */
+  auto operator()(const Row &row, const Col &col) -> Value & {
+    if (const size_type at = find_cell(row, col); at != npos) {
+      return m_cells[at].value;
+    }
+    return m_cells[insert_cell(row, col, Value())].value;
+  }
+
+  [[nodiscard]] auto contains_row(const Row &row) const -> bool {
+    return m_rows.contains(row);
+  }
+
+  [[nodiscard]] auto row_size(const Row &row) const -> size_type {
+    const auto it = m_rows.find(row);
+    return it == m_rows.end() ? 0 : it->second.size;
+  }
+
+  /**
+   * @brief Calls fn(col, value) for every cell of row.
+   */
+  template <typename Function>
+  auto for_each_in_row(const Row &row, Function fn) -> void {
+    if (const auto it = m_rows.find(row); it != m_rows.end()) {
+      visit_span(it->second, fn);
+    }
+  }
+
+  template <typename Function>
+  auto for_each_in_row(const Row &row, Function fn) const -> void {
+    if (const auto it = m_rows.find(row); it != m_rows.end()) {
+      visit_span(it->second, fn);
+    }
+  }
+
+  /**
+   * @brief Calls fn(row, col, value) for every cell, row by row.
+   */
+  template <typename Function> auto for_each(Function fn) -> void {
+    for (const auto &[row, span] : m_rows) {
+      auto visit = [&](const Col &col, Value &value) { fn(row, col, value); };
+      visit_span(span, visit);
+    }
+  }
+
+  template <typename Function> auto for_each(Function fn) const -> void {
+    for (const auto &[row, span] : m_rows) {
+      auto visit = [&](const Col &col, const Value &value) {
+        fn(row, col, value);
+      };
+      visit_span(span, visit);
+    }
+  }
+
+  // Modifiers
+  /**
+   * @brief Stores value at (row, col) unless the cell is occupied.
+   *
+   * @return true if the cell was inserted
+   */
+  auto insert(const Row &row, const Col &col, const Value &value) -> bool {
+    return emplace(row, col, value);
+  }
+
+  auto insert(const Row &row, const Col &col, Value &&value) -> bool {
+    return emplace(row, col, std::move(value));
+  }
+
+  /**
+   * @brief Stores value at (row, col), overwriting any previous value.
+   *
+   * @return true if the cell was inserted
+   */
+  template <typename V>
+  auto insert_or_assign(const Row &row, const Col &col, V &&value) -> bool {
+    if (const size_type at = find_cell(row, col); at != npos) {
+      m_cells[at].value = std::forward<V>(value);
+      return false;
+    }
+    insert_cell(row, col, Value(std::forward<V>(value)));
+    return true;
+  }
+
+  /**
+   * @brief Constructs the value at (row, col) from args unless the cell is
+   * occupied.
+   *
+   * @return true if the cell was inserted
+   */
+  template <typename... Args>
+  auto emplace(const Row &row, const Col &col, Args &&...args) -> bool {
+    if (find_cell(row, col) != npos) {
+      return false;
+    }
+    insert_cell(row, col, Value(std::forward<Args>(args)...));
+    return true;
+  }
+
+  /**
+   * @brief Removes the cell at (row, col); a row left empty is removed too.
+   *
+   * @return number of removed cells (0 or 1)
+   */
+  auto erase(const Row &row, const Col &col) -> size_type {
+    const auto it = m_rows.find(row);
+    if (it == m_rows.end()) {
+      return 0;
+    }
+    Span &span = it->second;
+    const size_type at = find_in_span(span, col, col_hash(col));
+    if (at == npos) {
+      return 0;
+    }
+    erase_slot(span, at);
+    --m_size;
+    if (--span.size == 0) {
+      m_dead += span.capacity;
+      m_rows.erase(it);
+    }
+    return 1;
+  }
+
+  /**
+   * @brief Removes row and all of its cells.
+   *
+   * @return number of removed cells
+   */
+  auto erase_row(const Row &row) -> size_type {
+    const auto it = m_rows.find(row);
+    if (it == m_rows.end()) {
+      return 0;
+    }
+    const Span &span = it->second;
+    const size_type removed = span.size;
+    for (size_type i = span.offset; i < span.offset + span.capacity; ++i) {
+      if (m_ctrl[i] != ctrl_empty) {
+        m_cells[i] = Cell();
+        m_ctrl[i] = ctrl_empty;
+      }
+    }
+    m_dead += span.capacity;
+    m_size -= removed;
+    m_rows.erase(it);
+    return removed;
+  }
+
+  /**
+   * @brief Sizes the table of row for count cells, creating the row if
+   * needed, so that filling it does not move it again.
+   */
+  auto reserve_row(const Row &row, size_type count) -> void {
+    if (count > row_limit(max_row_capacity)) {
+      throw std::length_error("HashMatrix row exceeds maximum size");
+    }
+    Span &span = m_rows.emplace(row).first->second;
+    std::uint32_t capacity = span.capacity == 0 ? 1 : span.capacity;
+    while (row_limit(capacity) < count) {
+      capacity *= 2;
+    }
+    if (capacity != span.capacity) {
+      relocate_row(span, capacity);
+    }
+  }
+
+  /**
+   * @brief Packs the row tables back to back, releasing the slots left by
+   * grown or erased rows.
+   */
+  auto compact() -> void {
+    Vector<Cell> cells;
+    Vector<std::uint8_t> ctrl;
+    cells.resize(m_cells.size() - m_dead);
+    ctrl.resize(m_ctrl.size() - m_dead, ctrl_empty);
+    size_type offset = 0;
+    for (auto &entry : m_rows) {
+      Span &span = entry.second;
+      for (size_type i = 0; i < span.capacity; ++i) {
+        if (m_ctrl[span.offset + i] != ctrl_empty) {
+          cells[offset + i] = std::move(m_cells[span.offset + i]);
+          ctrl[offset + i] = m_ctrl[span.offset + i];
+        }
+      }
+      span.offset = offset;
+      offset += span.capacity;
+    }
+    m_cells = std::move(cells);
+    m_ctrl = std::move(ctrl);
+    m_dead = 0;
+  }
+
+  auto clear() noexcept -> void {
+    m_rows.clear();
+    m_cells = Vector<Cell>();
+    m_ctrl = Vector<std::uint8_t>();
+    m_size = 0;
+    m_dead = 0;
+  }
+
+  auto swap(HashMatrix &other) noexcept -> void {
+    using std::swap;
+    m_rows.swap(other.m_rows);
+    swap(m_cells, other.m_cells);
+    swap(m_ctrl, other.m_ctrl);
+    swap(m_size, other.m_size);
+    swap(m_dead, other.m_dead);
+    swap(m_col_hash, other.m_col_hash);
+  }
+
+  // Capacity
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_size == 0; }
+  [[nodiscard]] auto row_count() const noexcept -> size_type {
+    return m_rows.size();
+  }
+
+  /**
+   * @brief Reports the heap bytes held by the row index and the cell array.
+   */
+  [[nodiscard]] auto memory_usage() const noexcept -> HashMatrixMemory {
+    constexpr size_type slot_bytes = sizeof(Cell) + sizeof(std::uint8_t);
+    const size_type row_slots = m_rows.capacity();
+    HashMatrixMemory usage{};
+    usage.row_index_bytes =
+        row_slots == 0
+            ? 0
+            : row_slots * (sizeof(typename RowIndex::value_type) + 1) +
+                  details::group_width;
+    usage.cell_bytes = m_size * slot_bytes;
+    usage.free_bytes = (m_cells.size() - m_dead - m_size) * slot_bytes;
+    usage.dead_bytes = m_dead * slot_bytes;
+    usage.reserved_bytes =
+        (m_cells.capacity() - m_cells.size()) * sizeof(Cell) +
+        (m_ctrl.capacity() - m_ctrl.size());
+    return usage;
+  }
+
+private:
+  static auto fragment(size_type hash) noexcept -> std::uint8_t {
+    return static_cast<std::uint8_t>(0x80 | (hash & 0x7F));
+  }
+
+  static auto home(size_type hash, std::uint32_t capacity) noexcept
+      -> size_type {
+    return (hash >> 7) & (capacity - 1);
+  }
+
+  // Tables of up to 4 slots may fill completely; probes are bounded by the
+  // capacity rather than by finding an empty slot.
+  static auto row_limit(std::uint32_t capacity) noexcept -> size_type {
+    return capacity <= 4 ? capacity : capacity - capacity / 4;
+  }
+
+  auto col_hash(const Col &col) const -> size_type {
+    return details::mix_hash(m_col_hash(col));
+  }
+
+  auto find_in_span(const Span &span, const Col &col, size_type hash) const
+      -> size_type {
+    const std::uint8_t tag = fragment(hash);
+    const size_type mask = span.capacity - 1;
+    size_type i = home(hash, span.capacity);
+    for (std::uint32_t probe = 0; probe < span.capacity;
+         ++probe, i = (i + 1) & mask) {
+      const size_type at = span.offset + i;
+      if (m_ctrl[at] == ctrl_empty) {
+        return npos;
+      }
+      if (m_ctrl[at] == tag && m_cells[at].col == col) {
+        return at;
+      }
+    }
+    return npos;
+  }
+
+  auto find_cell(const Row &row, const Col &col) const -> size_type {
+    const auto it = m_rows.find(row);
+    return it == m_rows.end() ? npos
+                              : find_in_span(it->second, col, col_hash(col));
+  }
+
+  auto checked_cell(const Row &row, const Col &col) const -> size_type {
+    const size_type at = find_cell(row, col);
+    if (at == npos) {
+      throw std::out_of_range("Cell not found in matrix");
+    }
+    return at;
+  }
+
+  // First empty slot of span on the probe path of hash; the table must
+  // have one.
+  auto free_slot(const Span &span, size_type hash) const noexcept
+      -> size_type {
+    const size_type mask = span.capacity - 1;
+    size_type i = home(hash, span.capacity);
+    while (m_ctrl[span.offset + i] != ctrl_empty) {
+      i = (i + 1) & mask;
+    }
+    return span.offset + i;
+  }
+
+  // Inserts a cell known to be absent and returns its slot.
+  auto insert_cell(const Row &row, const Col &col, Value &&value)
+      -> size_type {
+    const auto [it, new_row] = m_rows.emplace(row);
+    Span &span = it->second;
+    if (span.size + 1 > row_limit(span.capacity)) {
+      try {
+        relocate_row(span, span.capacity == 0 ? 1 : span.capacity * 2);
+      } catch (...) {
+        if (new_row) {
+          m_rows.erase(it);
+        }
+        throw;
+      }
+    }
+    const size_type hash = col_hash(col);
+    const size_type at = free_slot(span, hash);
+    m_cells[at].col = col;
+    m_cells[at].value = std::move(value);
+    m_ctrl[at] = fragment(hash);
+    ++span.size;
+    ++m_size;
+    return at;
+  }
+
+  // Moves the table of span to fresh slots at the end of the cell array.
+  auto relocate_row(Span &span, std::uint32_t capacity) -> void {
+    if (capacity > max_row_capacity) {
+      throw std::length_error("HashMatrix row exceeds maximum size");
+    }
+    if (m_dead > 0 && m_dead >= (m_cells.size() + capacity) / 2) {
+      compact();
+    }
+    const size_type offset = m_cells.size();
+    m_cells.resize(offset + capacity);
+    m_ctrl.resize(offset + capacity, ctrl_empty);
+    const Span old = span;
+    span.offset = offset;
+    span.capacity = capacity;
+    for (size_type i = old.offset; i < old.offset + old.capacity; ++i) {
+      if (m_ctrl[i] != ctrl_empty) {
+        const size_type at = free_slot(span, col_hash(m_cells[i].col));
+        m_cells[at] = std::move(m_cells[i]);
+        m_ctrl[at] = m_ctrl[i];
+        m_cells[i] = Cell();
+        m_ctrl[i] = ctrl_empty;
+      }
+    }
+    if (old.offset + old.capacity != offset) {
+      m_dead += old.capacity;
+      return;
+    }
+    // The row was the last table of the array, as while rows are loaded
+    // one after another: slide it down over its old slots instead of
+    // leaving them dead.
+    for (size_type i = 0; i < capacity; ++i) {
+      m_cells[old.offset + i] = std::move(m_cells[offset + i]);
+      m_ctrl[old.offset + i] = m_ctrl[offset + i];
+    }
+    m_cells.resize(old.offset + capacity);
+    m_ctrl.resize(old.offset + capacity);
+    span.offset = old.offset;
+  }
+
+  // Backward-shift deletion within the row table, wrapping at its end.
+  auto erase_slot(const Span &span, size_type at) -> void {
+    const size_type mask = span.capacity - 1;
+    size_type hole = at - span.offset;
+    size_type i = hole;
+    for (std::uint32_t step = 1; step < span.capacity; ++step) {
+      i = (i + 1) & mask;
+      if (m_ctrl[span.offset + i] == ctrl_empty) {
+        break;
+      }
+      const size_type home_slot =
+          home(col_hash(m_cells[span.offset + i].col), span.capacity);
+      if (((i - home_slot) & mask) >= ((i - hole) & mask)) {
+        m_cells[span.offset + hole] = std::move(m_cells[span.offset + i]);
+        m_ctrl[span.offset + hole] = m_ctrl[span.offset + i];
+        hole = i;
+      }
+    }
+    m_cells[span.offset + hole] = Cell();
+    m_ctrl[span.offset + hole] = ctrl_empty;
+  }
+
+  template <typename Function>
+  auto visit_span(const Span &span, Function &fn) -> void {
+    for (size_type i = span.offset; i < span.offset + span.capacity; ++i) {
+      if (m_ctrl[i] != ctrl_empty) {
+        fn(static_cast<const Col &>(m_cells[i].col), m_cells[i].value);
+      }
+    }
+  }
+
+  template <typename Function>
+  auto visit_span(const Span &span, Function &fn) const -> void {
+    for (size_type i = span.offset; i < span.offset + span.capacity; ++i) {
+      if (m_ctrl[i] != ctrl_empty) {
+        fn(m_cells[i].col, static_cast<const Value &>(m_cells[i].value));
+      }
+    }
+  }
+};
+
+#endif // __HASH_MATRIX_HPP__
@@ -0,0 +1,673 @@
+#ifndef __HASH_SET_HPP__
+#define __HASH_SET_HPP__
+
+#include "Prefetch.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace details {
+// Smallest power of two holding bytes, capped at one cache line, so that a
+// bucket of at most 64 bytes never straddles two lines.
+constexpr auto bucket_alignment(std::size_t bytes) noexcept -> std::size_t {
+  std::size_t alignment = 1;
+  while (alignment < bytes && alignment < 64) {
+    alignment *= 2;
+  }
+  return alignment;
+}
+
+template <typename Key, std::size_t Ways> struct CuckooSlots {
+  std::uint8_t tags[Ways];
+  alignas(Key) unsigned char storage[Ways][sizeof(Key)];
+};
+
+/**
+ * @brief Ways keys stored together, in one cache line when they fit in 64
+ * bytes; tag 0 marks a free slot, otherwise it holds an 8-bit fingerprint
+ * of the key's hash.
+ */
+template <typename Key, std::size_t Ways>
+struct alignas(bucket_alignment(sizeof(CuckooSlots<Key, Ways>))) CuckooBucket
+    : CuckooSlots<Key, Ways> {
+  [[nodiscard]] auto key(std::size_t slot) noexcept -> Key * {
+    return std::launder(reinterpret_cast<Key *>(this->storage[slot]));
+  }
+  [[nodiscard]] auto key(std::size_t slot) const noexcept -> const Key * {
+    return std::launder(reinterpret_cast<const Key *>(this->storage[slot]));
+  }
+};
+
+// 64-bit finalizer (from MurmurHash3); both the bucket index (low bits) and
+// the fingerprint (high bits) come from one mixed value.
+[[nodiscard]] inline auto cuckoo_mix(std::uint64_t h) noexcept
+    -> std::uint64_t {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+} // namespace details
+
+/**
+ * @brief Forward iterator for HashSet container; elements are immutable.
+ *
+ * @tparam SetType The set container type this iterator is for
+ */
+template <typename SetType> class cHashSet_Iterator {
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename SetType::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type *;
+  using reference = const value_type &;
+
+public:
+  constexpr explicit cHashSet_Iterator(const SetType *set = nullptr,
+                                       std::size_t position = 0) noexcept
+      : m_set(set), m_position(position) {
+    skip_free();
+  }
+
+  auto operator++() noexcept -> cHashSet_Iterator & {
+    ++m_position;
+    skip_free();
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> cHashSet_Iterator {
+    cHashSet_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference {
+    return *m_set->key_at(m_position);
+  }
+  auto operator->() const noexcept -> pointer {
+    return m_set->key_at(m_position);
+  }
+
+  auto operator==(const cHashSet_Iterator &other) const noexcept -> bool {
+    return m_position == other.m_position;
+  }
+
+  auto operator!=(const cHashSet_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  friend SetType;
+
+  constexpr auto skip_free() noexcept -> void {
+    if (m_set != nullptr) {
+      m_position = m_set->next_occupied(m_position);
+    }
+  }
+
+  const SetType *m_set;
+  std::size_t m_position;
+};
+
+/**
+ * @brief Bucketized cuckoo hash set with worst-case constant lookups
+ *
+ * @tparam Key Element type
+ * @tparam Hash Hash function
+ * @tparam KeyEqual Key equality
+ *
+ * Every key lives in one of two 4-way buckets, or in a small stash that
+ * absorbs the rare insert whose displacement chain cycles. For keys of up
+ * to 15 bytes a bucket is sized and aligned to stay within a single cache
+ * line; larger keys spread a bucket over several adjacent lines. A lookup
+ * therefore reads at most two buckets plus the stash; 8-bit fingerprints
+ * filter slots before keys are compared. The second bucket is derived from
+ * the first and the fingerprint (partial-key cuckoo hashing), so displacing
+ * a key never calls Hash again.
+ *
+ * Inserting may move other keys between their two buckets and rehashing
+ * moves all keys, invalidating iterators and references. A key whose hash
+ * value is shared by more keys than two buckets and the stash can hold is
+ * rejected with std::length_error.
+ *
+ * Complexity guarantees:
+ * - contains(), count(), erase(): O(1) worst case
+ * - contains_bulk(first, last, out): O(n), with prefetched buckets
+ * - insert(), emplace(): O(1) expected, amortized over rehashes
+ * - size(), is_empty(), capacity(): O(1)
+ *
+ * @example
+ * HashSet<std::uint64_t> blocked{42, 7};
+ * blocked.insert(99);
+ * assert(blocked.contains(7) && !blocked.contains(8));
+ */
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class HashSet {
+public:
+  static constexpr std::size_t BucketWays = 4;
+  static constexpr std::size_t StashCapacity = 8;
+
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using const_iterator = cHashSet_Iterator<HashSet>;
+  using iterator = const_iterator;
+
+private:
+  using Bucket = details::CuckooBucket<Key, BucketWays>;
+
+  static constexpr std::size_t MaxKicks = 500;
+  static constexpr std::size_t PrefetchBatch = 16;
+
+  friend const_iterator;
+
+  Bucket *m_buckets{nullptr};
+  size_type m_bucket_mask{0};
+  size_type m_size{0};
+  alignas(Key) unsigned char m_stash[StashCapacity][sizeof(Key)];
+  size_type m_stash_size{0};
+  std::uint64_t m_seed{0x9E3779B97F4A7C15ULL};
+  Hash m_hash;
+  KeyEqual m_equal;
+
+public:
+  // Constructors
+  HashSet() = default;
+
+  explicit HashSet(size_type count, const Hash &hash = Hash(),
+                   const KeyEqual &equal = KeyEqual())
+      : m_hash(hash), m_equal(equal) {
+    reserve(count);
+  }
+
+  HashSet(std::initializer_list<value_type> init_list) {
+    reserve(init_list.size());
+    for (const auto &key : init_list) {
+      insert(key);
+    }
+  }
+
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  HashSet(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+
+  HashSet(const HashSet &other) : m_hash(other.m_hash), m_equal(other.m_equal) {
+    reserve(other.m_size);
+    for (const auto &key : other) {
+      insert(key);
+    }
+  }
+
+  HashSet(HashSet &&other) noexcept
+      : m_hash(other.m_hash), m_equal(other.m_equal) {
+    swap(other);
+  }
+
+  auto operator=(const HashSet &other) -> HashSet & {
+    if (this != &other) {
+      HashSet temp(other);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  auto operator=(HashSet &&other) noexcept -> HashSet & {
+    swap(other);
+    return *this;
+  }
+
+  ~HashSet() {
+    clear();
+    deallocate(m_buckets);
+  }
+
+  // Lookup
+  [[nodiscard]] auto contains(const Key &key) const -> bool {
+    const std::uint64_t hash = hash_of(key);
+    return find_in_buckets(key, hash) || find_in_stash(key) != StashCapacity;
+  }
+
+  [[nodiscard]] auto count(const Key &key) const -> size_type {
+    return contains(key) ? 1 : 0;
+  }
+
+  [[nodiscard]] auto find(const Key &key) const -> const_iterator {
+    const std::uint64_t hash = hash_of(key);
+    if (m_buckets != nullptr) {
+      const std::uint8_t tag = tag_of(hash);
+      const size_type first = bucket_of(hash);
+      for (size_type index : {first, alternate(first, tag)}) {
+        if (const size_type slot = slot_of(m_buckets[index], key, tag);
+            slot != BucketWays) {
+          return const_iterator(this, index * BucketWays + slot);
+        }
+      }
+    }
+    if (const size_type slot = find_in_stash(key); slot != StashCapacity) {
+      return const_iterator(this, bucket_count() * BucketWays + slot);
+    }
+    return end();
+  }
+
+  /**
+   * @brief Tests every key of [first, last) and writes one bool per key to
+   * out. Hashes are computed a batch ahead and both candidate buckets are
+   * prefetched, so the cache misses of a batch overlap.
+   *
+   * @return number of keys found
+   */
+  template <typename ForwardIt, typename OutputIt>
+  auto contains_bulk(ForwardIt first, ForwardIt last, OutputIt out) const
+      -> size_type {
+    size_type found = 0;
+    std::uint64_t hashes[PrefetchBatch];
+    while (first != last) {
+      ForwardIt batch_begin = first;
+      size_type batch = 0;
+      for (; batch < PrefetchBatch && first != last; ++batch, ++first) {
+        hashes[batch] = hash_of(*first);
+        if (m_buckets != nullptr) {
+          const size_type index = bucket_of(hashes[batch]);
+          details::prefetch(m_buckets + index);
+          details::prefetch(
+              m_buckets + alternate(index, tag_of(hashes[batch])));
+        }
+      }
+      for (size_type i = 0; i < batch; ++i, ++batch_begin) {
+        const bool hit = find_in_buckets(*batch_begin, hashes[i]) ||
+                         find_in_stash(*batch_begin) != StashCapacity;
+        found += hit ? 1 : 0;
+        *out = hit;
+        ++out;
+      }
+    }
+    return found;
+  }
+
+  // Modifiers
+  /**
+   * @return true if key was inserted, false if it was already present
+   */
+  auto insert(const Key &key) -> bool { return emplace(key); }
+  auto insert(Key &&key) -> bool { return emplace(std::move(key)); }
+
+  template <typename... Args> auto emplace(Args &&...args) -> bool {
+    Key key(std::forward<Args>(args)...);
+    const std::uint64_t hash = hash_of(key);
+    if (find_in_buckets(key, hash) || find_in_stash(key) != StashCapacity) {
+      return false;
+    }
+    if (m_size + 1 > max_load()) {
+      rehash(bucket_count() == 0 ? 2 : bucket_count() * 2);
+    }
+    place(key, hash, true);
+    ++m_size;
+    return true;
+  }
+
+  /**
+   * @return number of removed keys (0 or 1)
+   */
+  auto erase(const Key &key) -> size_type {
+    const std::uint64_t hash = hash_of(key);
+    if (m_buckets != nullptr) {
+      const std::uint8_t tag = tag_of(hash);
+      const size_type first = bucket_of(hash);
+      for (size_type index : {first, alternate(first, tag)}) {
+        Bucket &bucket = m_buckets[index];
+        if (const size_type slot = slot_of(bucket, key, tag);
+            slot != BucketWays) {
+          std::destroy_at(bucket.key(slot));
+          bucket.tags[slot] = 0;
+          --m_size;
+          return 1;
+        }
+      }
+    }
+    if (const size_type slot = find_in_stash(key); slot != StashCapacity) {
+      remove_from_stash(slot);
+      --m_size;
+      return 1;
+    }
+    return 0;
+  }
+
+  auto clear() noexcept -> void {
+    if constexpr (!std::is_trivially_destructible_v<Key>) {
+      for (size_type i = 0; i < bucket_count(); ++i) {
+        for (size_type slot = 0; slot < BucketWays; ++slot) {
+          if (m_buckets[i].tags[slot] != 0) {
+            std::destroy_at(m_buckets[i].key(slot));
+          }
+        }
+      }
+    }
+    for (size_type i = 0; i < bucket_count(); ++i) {
+      for (auto &tag : m_buckets[i].tags) {
+        tag = 0;
+      }
+    }
+    while (m_stash_size > 0) {
+      remove_from_stash(m_stash_size - 1);
+    }
+    m_size = 0;
+  }
+
+  /**
+   * @brief Makes room for count keys without further rehashing.
+   */
+  auto reserve(size_type count) -> void {
+    size_type buckets = bucket_count() == 0 ? 2 : bucket_count();
+    while (load_limit(buckets) < count) {
+      buckets *= 2;
+    }
+    if (buckets != bucket_count()) {
+      rehash(buckets);
+    }
+  }
+
+  auto swap(HashSet &other) noexcept(std::is_nothrow_move_constructible_v<Key>)
+      -> void {
+    using std::swap;
+    swap(m_buckets, other.m_buckets);
+    swap(m_bucket_mask, other.m_bucket_mask);
+    swap(m_size, other.m_size);
+    swap(m_seed, other.m_seed);
+    swap(m_hash, other.m_hash);
+    swap(m_equal, other.m_equal);
+    // Stash entries live inline, so they are exchanged one by one.
+    HashSet *larger = m_stash_size >= other.m_stash_size ? this : &other;
+    HashSet *smaller = larger == this ? &other : this;
+    for (size_type i = 0; i < smaller->m_stash_size; ++i) {
+      swap(*larger->stash_key(i), *smaller->stash_key(i));
+    }
+    for (size_type i = smaller->m_stash_size; i < larger->m_stash_size; ++i) {
+      ::new (static_cast<void *>(smaller->m_stash[i]))
+          Key(std::move(*larger->stash_key(i)));
+      std::destroy_at(larger->stash_key(i));
+    }
+    swap(m_stash_size, other.m_stash_size);
+  }
+
+  // Capacity
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_size == 0; }
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return bucket_count() * BucketWays;
+  }
+  [[nodiscard]] auto bucket_count() const noexcept -> size_type {
+    return m_buckets == nullptr ? 0 : m_bucket_mask + 1;
+  }
+  [[nodiscard]] auto load_factor() const noexcept -> float {
+    return capacity() == 0 ? 0.0F
+                           : static_cast<float>(m_size) /
+                                 static_cast<float>(capacity());
+  }
+
+  // Iterators
+  auto begin() const noexcept -> const_iterator {
+    return const_iterator(this, 0);
+  }
+  auto end() const noexcept -> const_iterator {
+    return const_iterator(this, end_position());
+  }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+
+private:
+  // 4-way buckets fill to about 95% before inserts start failing; growing
+  // at 90% keeps displacement chains short.
+  static auto load_limit(size_type buckets) noexcept -> size_type {
+    return buckets * BucketWays * 9 / 10;
+  }
+
+  [[nodiscard]] auto max_load() const noexcept -> size_type {
+    return load_limit(bucket_count());
+  }
+
+  auto hash_of(const Key &key) const -> std::uint64_t {
+    return details::cuckoo_mix(static_cast<std::uint64_t>(m_hash(key)));
+  }
+
+  static auto tag_of(std::uint64_t hash) noexcept -> std::uint8_t {
+    const auto tag = static_cast<std::uint8_t>(hash >> 56);
+    return tag == 0 ? 1 : tag;
+  }
+
+  auto bucket_of(std::uint64_t hash) const noexcept -> size_type {
+    return static_cast<size_type>(hash) & m_bucket_mask;
+  }
+
+  // Involution: the alternate of the alternate is the original bucket.
+  auto alternate(size_type index, std::uint8_t tag) const noexcept
+      -> size_type {
+    return (index ^ static_cast<size_type>(tag * 0x5bd1e995ULL)) &
+           m_bucket_mask;
+  }
+
+  auto slot_of(const Bucket &bucket, const Key &key,
+               std::uint8_t tag) const -> size_type {
+    for (size_type slot = 0; slot < BucketWays; ++slot) {
+      if (bucket.tags[slot] == tag && m_equal(*bucket.key(slot), key)) {
+        return slot;
+      }
+    }
+    return BucketWays;
+  }
+
+  auto find_in_buckets(const Key &key, std::uint64_t hash) const -> bool {
+    if (m_buckets == nullptr) {
+      return false;
+    }
+    const std::uint8_t tag = tag_of(hash);
+    const size_type first = bucket_of(hash);
+    return slot_of(m_buckets[first], key, tag) != BucketWays ||
+           slot_of(m_buckets[alternate(first, tag)], key, tag) != BucketWays;
+  }
+
+  auto stash_key(size_type slot) noexcept -> Key * {
+    return std::launder(reinterpret_cast<Key *>(m_stash[slot]));
+  }
+  auto stash_key(size_type slot) const noexcept -> const Key * {
+    return std::launder(reinterpret_cast<const Key *>(m_stash[slot]));
+  }
+
+  auto find_in_stash(const Key &key) const -> size_type {
+    for (size_type slot = 0; slot < m_stash_size; ++slot) {
+      if (m_equal(*stash_key(slot), key)) {
+        return slot;
+      }
+    }
+    return StashCapacity;
+  }
+
+  auto remove_from_stash(size_type slot) noexcept(
+      std::is_nothrow_move_assignable_v<Key>) -> void {
+    const size_type last = m_stash_size - 1;
+    if (slot != last) {
+      *stash_key(slot) = std::move(*stash_key(last));
+    }
+    std::destroy_at(stash_key(last));
+    --m_stash_size;
+  }
+
+  static auto free_slot(const Bucket &bucket) noexcept -> size_type {
+    for (size_type slot = 0; slot < BucketWays; ++slot) {
+      if (bucket.tags[slot] == 0) {
+        return slot;
+      }
+    }
+    return BucketWays;
+  }
+
+  auto put(Bucket &bucket, size_type slot, Key &&key, std::uint8_t tag)
+      -> void {
+    ::new (static_cast<void *>(bucket.storage[slot])) Key(std::move(key));
+    bucket.tags[slot] = tag;
+  }
+
+  // Places a key known to be absent, growing the table whenever the
+  // displacement walk and the stash run out of room. Growth cannot help a
+  // key whose hash value already fills both its buckets and the stash, so
+  // such a key is rejected up front when reject_collisions is set.
+  auto place(Key &key, std::uint64_t hash, bool reject_collisions) -> void {
+    if (reject_collisions && is_saturated(hash)) {
+      throw std::length_error("Too many HashSet keys share a hash value");
+    }
+    while (!try_place(key, hash)) {
+      rehash(bucket_count() * 2);
+      hash = hash_of(key);
+    }
+  }
+
+  // True when both buckets of hash and the whole stash hold keys with this
+  // very hash value, so that no table size has room for one more.
+  auto is_saturated(std::uint64_t hash) const -> bool {
+    if (m_buckets == nullptr || m_stash_size < StashCapacity) {
+      return false;
+    }
+    const std::uint8_t tag = tag_of(hash);
+    const size_type first = bucket_of(hash);
+    const size_type second = alternate(first, tag);
+    if (first == second) {
+      return false;
+    }
+    for (size_type index : {first, second}) {
+      for (size_type slot = 0; slot < BucketWays; ++slot) {
+        if (m_buckets[index].tags[slot] != tag ||
+            hash_of(*m_buckets[index].key(slot)) != hash) {
+          return false;
+        }
+      }
+    }
+    for (size_type slot = 0; slot < m_stash_size; ++slot) {
+      if (hash_of(*stash_key(slot)) != hash) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Random-walk cuckoo insertion. The key left homeless at the end of the
+  // walk goes to the stash; if that is full too, the homeless key is handed
+  // back in key with all other moves kept (no key is lost), and the caller
+  // grows the table.
+  auto try_place(Key &key, std::uint64_t hash) -> bool {
+    std::uint8_t tag = tag_of(hash);
+    size_type index = bucket_of(hash);
+    for (size_type candidate : {index, alternate(index, tag)}) {
+      if (const size_type slot = free_slot(m_buckets[candidate]);
+          slot != BucketWays) {
+        put(m_buckets[candidate], slot, std::move(key), tag);
+        return true;
+      }
+    }
+
+    for (size_type kick = 0; kick < MaxKicks; ++kick) {
+      m_seed ^= m_seed << 13;
+      m_seed ^= m_seed >> 7;
+      m_seed ^= m_seed << 17;
+      Bucket &bucket = m_buckets[index];
+      const size_type victim = static_cast<size_type>(m_seed % BucketWays);
+      using std::swap;
+      swap(key, *bucket.key(victim));
+      swap(tag, bucket.tags[victim]);
+      index = alternate(index, tag);
+      if (const size_type slot = free_slot(m_buckets[index]);
+          slot != BucketWays) {
+        put(m_buckets[index], slot, std::move(key), tag);
+        return true;
+      }
+    }
+    if (m_stash_size == StashCapacity) {
+      return false;
+    }
+    ::new (static_cast<void *>(m_stash[m_stash_size])) Key(std::move(key));
+    ++m_stash_size;
+    return true;
+  }
+
+  auto rehash(size_type buckets) -> void {
+    HashSet bigger;
+    bigger.m_hash = m_hash;
+    bigger.m_equal = m_equal;
+    bigger.m_seed = m_seed;
+    bigger.allocate(buckets);
+    for (size_type i = 0; i < bucket_count(); ++i) {
+      for (size_type slot = 0; slot < BucketWays; ++slot) {
+        if (m_buckets[i].tags[slot] != 0) {
+          Key &key = *m_buckets[i].key(slot);
+          bigger.place(key, bigger.hash_of(key), false);
+        }
+      }
+    }
+    for (size_type slot = 0; slot < m_stash_size; ++slot) {
+      Key &key = *stash_key(slot);
+      bigger.place(key, bigger.hash_of(key), false);
+    }
+    bigger.m_size = m_size;
+    swap(bigger);
+  }
+
+  auto allocate(size_type buckets) -> void {
+    m_buckets = static_cast<Bucket *>(::operator new(
+        buckets * sizeof(Bucket), std::align_val_t{alignof(Bucket)}));
+    for (size_type i = 0; i < buckets; ++i) {
+      for (auto &tag : m_buckets[i].tags) {
+        tag = 0;
+      }
+    }
+    m_bucket_mask = buckets - 1;
+  }
+
+  static auto deallocate(Bucket *buckets) noexcept -> void {
+    if (buckets != nullptr) {
+      ::operator delete(static_cast<void *>(buckets),
+                        std::align_val_t{alignof(Bucket)});
+    }
+  }
+
+  // Positions enumerate bucket slots first, then the stash.
+  [[nodiscard]] auto end_position() const noexcept -> size_type {
+    return capacity() + m_stash_size;
+  }
+
+  [[nodiscard]] auto next_occupied(size_type position) const noexcept
+      -> size_type {
+    const size_type slots = capacity();
+    while (position < slots &&
+           m_buckets[position / BucketWays].tags[position % BucketWays] == 0) {
+      ++position;
+    }
+    return position < end_position() ? position : end_position();
+  }
+
+  [[nodiscard]] auto key_at(size_type position) const noexcept -> const Key * {
+    const size_type slots = capacity();
+    return position < slots
+               ? m_buckets[position / BucketWays].key(position % BucketWays)
+               : stash_key(position - slots);
+  }
+};
+
+#endif // __HASH_SET_HPP__
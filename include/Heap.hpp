@@ -0,0 +1,320 @@
+#ifndef __HEAP_HPP__
+#define __HEAP_HPP__
+
+#include "Vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Array-backed d-ary heap with stable handles
+ *
+ * @tparam ValueType The type of elements stored in the heap
+ * @tparam Compare Ordering in the sense of std::priority_queue: top() is an
+ * element that no other element compares greater than (std::less gives a
+ * max-heap, std::greater a min-heap)
+ * @tparam Arity Children per node; 4 halves and 8 thirds the height of the
+ * tree, and the children scanned by each sift-down step sit side by side
+ *
+ * Every inserted element is assigned a handle that stays valid until the
+ * element is popped or erased, so it can later be updated or removed in
+ * O(log n). Handles of removed elements are recycled.
+ *
+ * Complexity guarantees:
+ * - Heap(first, last), heapify(first, last): O(n)
+ * - push(), emplace(): O(log n)
+ * - pop(), erase(handle): O(Arity * log n)
+ * - decrease_key(handle, value): O(log n)
+ * - update(handle, value): O(Arity * log n)
+ * - top(), value(handle), contains(handle): O(1)
+ * - size(), empty(): O(1)
+ *
+ * @example
+ * Heap<int, std::greater<int>, 4> heap;
+ * auto handle = heap.push(10);
+ * heap.push(5);
+ * heap.decrease_key(handle, 1);
+ * assert(heap.top() == 1);
+ */
+template <typename ValueType, typename Compare = std::less<ValueType>,
+          std::size_t Arity = 2>
+class Heap {
+  static_assert(Arity >= 2, "Heap arity must be at least 2");
+
+public:
+  using value_type = ValueType;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using value_compare = Compare;
+  using handle_type = std::uint32_t;
+
+private:
+  struct Entry {
+    value_type value;
+    handle_type handle;
+
+    template <typename... Args>
+    explicit Entry(handle_type h, Args &&...args)
+        : value(std::forward<Args>(args)...), handle(h) {}
+  };
+
+  static constexpr handle_type npos = std::numeric_limits<handle_type>::max();
+
+  Vector<Entry> m_entries;
+  Vector<handle_type> m_position;
+  Vector<handle_type> m_free;
+  Compare m_compare;
+
+public:
+  // Constructors
+  Heap() = default;
+
+  explicit Heap(const Compare &compare) : m_compare(compare) {}
+
+  /**
+   * @brief Builds a heap from [first, last) in O(n); the i-th element of the
+   * range receives handle i.
+   */
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  Heap(InputIt first, InputIt last, const Compare &compare = Compare())
+      : m_compare(compare) {
+    heapify(first, last);
+  }
+
+  Heap(std::initializer_list<value_type> init_list,
+       const Compare &compare = Compare())
+      : Heap(init_list.begin(), init_list.end(), compare) {}
+
+  // Element access
+  [[nodiscard]] auto top() const -> const_reference {
+    if (empty()) {
+      throw std::out_of_range("Cannot access top of empty heap");
+    }
+    return m_entries.data()[0].value;
+  }
+
+  [[nodiscard]] auto top_handle() const -> handle_type {
+    if (empty()) {
+      throw std::out_of_range("Cannot access top of empty heap");
+    }
+    return m_entries.data()[0].handle;
+  }
+
+  [[nodiscard]] auto value(handle_type handle) const -> const_reference {
+    return m_entries.data()[index_of(handle)].value;
+  }
+
+  [[nodiscard]] auto contains(handle_type handle) const noexcept -> bool {
+    return handle < m_position.size() && m_position.data()[handle] != npos;
+  }
+
+  // Capacity
+  [[nodiscard]] auto empty() const noexcept -> bool {
+    return m_entries.empty();
+  }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return empty(); }
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return m_entries.size();
+  }
+
+  auto reserve(size_type new_capacity) -> void {
+    m_entries.reserve(new_capacity);
+    m_position.reserve(new_capacity);
+  }
+
+  // Modifiers
+  /**
+   * @brief Replaces the contents with [first, last) using bottom-up
+   * heapify; the i-th element of the range receives handle i.
+   */
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  auto heapify(InputIt first, InputIt last) -> void {
+    clear();
+    for (; first != last; ++first) {
+      const auto handle = next_handle();
+      m_entries.emplace_back(handle, *first);
+      m_position.push_back(handle);
+    }
+    const size_type count = size();
+    if (count > 1) {
+      for (size_type i = (count - 2) / Arity + 1; i-- > 0;) {
+        sift_down(i);
+      }
+    }
+  }
+
+  auto push(const value_type &value) -> handle_type { return emplace(value); }
+  auto push(value_type &&value) -> handle_type {
+    return emplace(std::move(value));
+  }
+
+  /**
+   * @return handle of the new element
+   */
+  template <typename... Args> auto emplace(Args &&...args) -> handle_type {
+    const handle_type handle = acquire_handle();
+    try {
+      m_entries.emplace_back(handle, std::forward<Args>(args)...);
+    } catch (...) {
+      m_free.push_back(handle);
+      throw;
+    }
+    sift_up(size() - 1);
+    return handle;
+  }
+
+  auto pop() -> void {
+    if (empty()) {
+      throw std::out_of_range("Cannot pop from empty heap");
+    }
+    remove_at(0);
+  }
+
+  /**
+   * @brief Removes the element behind handle from anywhere in the heap.
+   */
+  auto erase(handle_type handle) -> void { remove_at(index_of(handle)); }
+
+  /**
+   * @brief Moves the element behind handle toward the top after giving it
+   * a value that ranks at least as high as its current one.
+   *
+   * @throws std::invalid_argument if value ranks below the current value
+   */
+  auto decrease_key(handle_type handle, value_type value) -> void {
+    const size_type index = index_of(handle);
+    Entry *entries = m_entries.data();
+    if (m_compare(value, entries[index].value)) {
+      throw std::invalid_argument("New key ranks below the current key");
+    }
+    entries[index].value = std::move(value);
+    sift_up(index);
+  }
+
+  /**
+   * @brief Replaces the value behind handle and restores the heap order in
+   * whichever direction it moved.
+   */
+  auto update(handle_type handle, value_type value) -> void {
+    const size_type index = index_of(handle);
+    m_entries.data()[index].value = std::move(value);
+    restore(index);
+  }
+
+  auto clear() noexcept -> void {
+    m_entries.clear();
+    m_position.clear();
+    m_free.clear();
+  }
+
+private:
+  auto index_of(handle_type handle) const -> size_type {
+    if (!contains(handle)) {
+      throw std::out_of_range("Invalid heap handle");
+    }
+    return m_position.data()[handle];
+  }
+
+  auto next_handle() const -> handle_type {
+    if (m_position.size() >= npos) {
+      throw std::length_error("Heap handle space exhausted");
+    }
+    return static_cast<handle_type>(m_position.size());
+  }
+
+  auto acquire_handle() -> handle_type {
+    if (!m_free.empty()) {
+      const handle_type handle = m_free.back();
+      m_free.pop_back();
+      return handle;
+    }
+    const handle_type handle = next_handle();
+    m_position.push_back(npos);
+    return handle;
+  }
+
+  auto place(Entry *entries, size_type index, Entry &&entry) noexcept(
+      std::is_nothrow_move_assignable_v<value_type>) -> void {
+    entries[index] = std::move(entry);
+    m_position.data()[entries[index].handle] =
+        static_cast<handle_type>(index);
+  }
+
+  auto remove_at(size_type index) -> void {
+    Entry *entries = m_entries.data();
+    const handle_type handle = entries[index].handle;
+    const size_type last = size() - 1;
+    if (index != last) {
+      place(entries, index, std::move(entries[last]));
+    }
+    m_entries.pop_back();
+    m_position.data()[handle] = npos;
+    m_free.push_back(handle);
+    if (index != last) {
+      restore(index);
+    }
+  }
+
+  auto restore(size_type index) -> void {
+    const Entry *entries = m_entries.data();
+    if (index > 0 &&
+        m_compare(entries[(index - 1) / Arity].value, entries[index].value)) {
+      sift_up(index);
+    } else {
+      sift_down(index);
+    }
+  }
+
+  // Both sifts carry the moving entry in a local and shift the others into
+  // the hole, writing each entry once per level.
+  auto sift_up(size_type index) -> void {
+    Entry *entries = m_entries.data();
+    Entry moving = std::move(entries[index]);
+    while (index > 0) {
+      const size_type parent = (index - 1) / Arity;
+      if (!m_compare(entries[parent].value, moving.value)) {
+        break;
+      }
+      place(entries, index, std::move(entries[parent]));
+      index = parent;
+    }
+    place(entries, index, std::move(moving));
+  }
+
+  auto sift_down(size_type index) -> void {
+    Entry *entries = m_entries.data();
+    const size_type count = size();
+    Entry moving = std::move(entries[index]);
+    while (true) {
+      const size_type first = index * Arity + 1;
+      if (first >= count) {
+        break;
+      }
+      const size_type last = first + Arity < count ? first + Arity : count;
+      size_type best = first;
+      for (size_type child = first + 1; child < last; ++child) {
+        if (m_compare(entries[best].value, entries[child].value)) {
+          best = child;
+        }
+      }
+      if (!m_compare(moving.value, entries[best].value)) {
+        break;
+      }
+      place(entries, index, std::move(entries[best]));
+      index = best;
+    }
+    place(entries, index, std::move(moving));
+  }
+};
+
+#endif // __HEAP_HPP__
@@ -0,0 +1,1161 @@
+#ifndef __INDEXED_LIST_HPP__
+#define __INDEXED_LIST_HPP__
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace details {
+/**
+ * @brief Growable contiguous array of list slots addressed by 32-bit index.
+ *
+ * Released slots are threaded onto an index freelist through their next
+ * link and handed out again before the array grows. The pool owns raw
+ * storage only: owners construct a slot's value in place after acquire()
+ * and destroy it before release(). Operations that move or copy values
+ * take the first slot of the owner's live chain and follow its next links.
+ *
+ * @tparam Slot The slot type, must expose a std::uint32_t next member, raw
+ * storage for the element and value() to reach it
+ */
+template <typename Slot> class SlotPool {
+public:
+  using index_type = std::uint32_t;
+  using size_type = std::size_t;
+  using value_type =
+      std::remove_reference_t<decltype(std::declval<Slot &>().value())>;
+
+  static constexpr index_type npos = std::numeric_limits<index_type>::max();
+
+  static_assert(std::is_trivially_copyable_v<Slot>,
+                "Slots hold raw storage and links only");
+
+private:
+  Slot *m_slots{nullptr};
+  index_type m_capacity{0};
+  index_type m_used{0};
+  index_type m_free{npos};
+
+public:
+  SlotPool() noexcept = default;
+
+  /**
+   * @brief Copies the links of other and the values on its chain from live.
+   */
+  SlotPool(const SlotPool &other, index_type live)
+      : m_slots(allocate(other.m_capacity)), m_capacity(other.m_capacity),
+        m_used(other.m_used), m_free(other.m_free) {
+    if (m_used != 0) {
+      std::memcpy(m_slots, other.m_slots, sizeof(Slot) * m_used);
+    }
+    if constexpr (!std::is_trivially_copyable_v<value_type>) {
+      index_type i = live;
+      try {
+        for (; i != npos; i = other.m_slots[i].next) {
+          ::new (static_cast<void *>(m_slots[i].storage))
+              value_type(other.m_slots[i].value());
+        }
+      } catch (...) {
+        destroy_chain(m_slots, live, i);
+        deallocate(m_slots);
+        throw;
+      }
+    }
+  }
+
+  SlotPool(SlotPool &&other) noexcept { swap(other); }
+
+  auto operator=(SlotPool &&other) noexcept -> SlotPool & {
+    swap(other);
+    return *this;
+  }
+
+  ~SlotPool() { deallocate(m_slots); }
+
+  [[nodiscard]] auto operator[](index_type index) noexcept -> Slot & {
+    return m_slots[index];
+  }
+  [[nodiscard]] auto operator[](index_type index) const noexcept
+      -> const Slot & {
+    return m_slots[index];
+  }
+
+  /**
+   * @brief Returns the index of a free slot, growing the array if needed.
+   *
+   * @param live first slot of the chain of values to relocate on growth
+   * @throws std::length_error if 2^32 - 1 slots are already in use
+   */
+  auto acquire(index_type live) -> index_type {
+    if (m_free != npos) {
+      const index_type index = m_free;
+      m_free = m_slots[index].next;
+      return index;
+    }
+    if (m_used == m_capacity) {
+      grow(m_capacity == 0 ? 8 : static_cast<size_type>(m_capacity) * 2,
+           live);
+    }
+    return m_used++;
+  }
+
+  auto release(index_type index) noexcept -> void {
+    m_slots[index].next = m_free;
+    m_free = index;
+  }
+
+  auto reserve(size_type capacity, index_type live) -> void {
+    if (capacity > m_capacity) {
+      grow(capacity, live);
+    }
+  }
+
+  // Destroys the values on the chain from live.
+  auto destroy_values(index_type live) noexcept -> void {
+    destroy_chain(m_slots, live, npos);
+  }
+
+  // Forgets every slot but keeps the allocation.
+  auto reset() noexcept -> void {
+    m_used = 0;
+    m_free = npos;
+  }
+
+  // True when the next acquire() grows the array.
+  [[nodiscard]] auto is_full() const noexcept -> bool {
+    return m_free == npos && m_used == m_capacity;
+  }
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return m_capacity;
+  }
+  [[nodiscard]] auto used() const noexcept -> index_type { return m_used; }
+  [[nodiscard]] auto free_head() const noexcept -> index_type {
+    return m_free;
+  }
+  [[nodiscard]] auto data() const noexcept -> const Slot * { return m_slots; }
+
+  // Adopts used slots copied from raw bytes, for deserialization.
+  auto assign(const void *slots, index_type used, index_type free_head)
+      -> void {
+    static_assert(std::is_trivially_copyable_v<value_type>,
+                  "Only trivially copyable slots can be assigned from bytes");
+    SlotPool temp;
+    temp.grow(used, npos);
+    std::memcpy(temp.m_slots, slots, sizeof(Slot) * used);
+    temp.m_used = used;
+    temp.m_free = free_head;
+    swap(temp);
+  }
+
+  auto swap(SlotPool &other) noexcept -> void {
+    using std::swap;
+    swap(m_slots, other.m_slots);
+    swap(m_capacity, other.m_capacity);
+    swap(m_used, other.m_used);
+    swap(m_free, other.m_free);
+  }
+
+private:
+  // Moves the links and the values on the chain from live into a larger
+  // array. A throwing move or copy leaves this pool untouched.
+  auto grow(size_type capacity, index_type live) -> void {
+    if (capacity >= npos) {
+      if (m_capacity == npos - 1) {
+        throw std::length_error("Indexed list exceeds 32-bit index range");
+      }
+      capacity = npos - 1;
+    }
+    Slot *slots = allocate(capacity);
+    if (m_used != 0) {
+      std::memcpy(slots, m_slots, sizeof(Slot) * m_used);
+    }
+    if constexpr (!std::is_trivially_copyable_v<value_type>) {
+      index_type i = live;
+      try {
+        for (; i != npos; i = m_slots[i].next) {
+          ::new (static_cast<void *>(slots[i].storage))
+              value_type(std::move_if_noexcept(m_slots[i].value()));
+        }
+      } catch (...) {
+        destroy_chain(slots, live, i);
+        deallocate(slots);
+        throw;
+      }
+      destroy_chain(m_slots, live, npos);
+    }
+    deallocate(m_slots);
+    m_slots = slots;
+    m_capacity = static_cast<index_type>(capacity);
+  }
+
+  static auto destroy_chain(Slot *slots, index_type first,
+                            index_type last) noexcept -> void {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (index_type i = first; i != last; i = slots[i].next) {
+        std::destroy_at(std::addressof(slots[i].value()));
+      }
+    }
+  }
+
+  static auto allocate(size_type capacity) -> Slot * {
+    if (capacity == 0) {
+      return nullptr;
+    }
+    return static_cast<Slot *>(::operator new(
+        capacity * sizeof(Slot), std::align_val_t{alignof(Slot)}));
+  }
+
+  static auto deallocate(Slot *slots) noexcept -> void {
+    if (slots != nullptr) {
+      ::operator delete(static_cast<void *>(slots),
+                        std::align_val_t{alignof(Slot)});
+    }
+  }
+};
+
+/**
+ * @brief Fixed header written in front of the slots by serialize().
+ */
+struct IndexedListHeader {
+  std::uint32_t front;
+  std::uint32_t back;
+  std::uint32_t free_head;
+  std::uint32_t size;
+  std::uint32_t used;
+};
+
+template <typename Slot, typename = void>
+struct has_prev_link : std::false_type {};
+
+template <typename Slot>
+struct has_prev_link<Slot, std::void_t<decltype(std::declval<Slot &>().prev)>>
+    : std::true_type {};
+
+/**
+ * @brief Checks the links restored by deserialize(): every index names a
+ * used slot or is npos, the live chain holds header.size slots ending at
+ * header.back, and no slot is reached twice through the live and free
+ * chains.
+ *
+ * @throws std::invalid_argument if the links are inconsistent
+ */
+template <typename Slot>
+auto check_links(const IndexedListHeader &header, const SlotPool<Slot> &slots)
+    -> void {
+  using index_type = std::uint32_t;
+  constexpr index_type npos = SlotPool<Slot>::npos;
+  const index_type used = header.used;
+  const auto valid = [used](index_type index) {
+    return index == npos || index < used;
+  };
+  const auto fail = [] {
+    throw std::invalid_argument("Corrupt indexed list buffer");
+  };
+  if (header.size > used || !valid(header.front) || !valid(header.back) ||
+      !valid(header.free_head)) {
+    fail();
+  }
+  std::vector<bool> seen(used);
+  index_type count = 0;
+  index_type prev = npos;
+  for (index_type i = header.front; i != npos; i = slots[i].next) {
+    if (seen[i] || !valid(slots[i].next)) {
+      fail();
+    }
+    if constexpr (has_prev_link<Slot>::value) {
+      if (slots[i].prev != prev) {
+        fail();
+      }
+    }
+    seen[i] = true;
+    prev = i;
+    ++count;
+  }
+  if (count != header.size || prev != header.back) {
+    fail();
+  }
+  for (index_type i = header.free_head; i != npos; i = slots[i].next) {
+    if (seen[i] || !valid(slots[i].next)) {
+      fail();
+    }
+    seen[i] = true;
+  }
+}
+} // namespace details
+
+/**
+ * @brief Forward iterator for IndexedList container
+ *
+ * @tparam ListType The list container type this iterator is for
+ *
+ * @note The iterator stores the list and a slot index, so it stays valid
+ * when the slot array grows.
+ */
+template <typename ListType> class IndexedList_Iterator {
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename ListType::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = value_type *;
+  using reference = value_type &;
+  using index_type = std::uint32_t;
+
+public:
+  constexpr explicit IndexedList_Iterator(ListType *list = nullptr,
+                                          index_type index = ListType::npos)
+      noexcept
+      : m_list(list), m_index(index) {}
+
+  auto operator++() noexcept -> IndexedList_Iterator & {
+    m_index = m_list->m_slots[m_index].next;
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> IndexedList_Iterator {
+    IndexedList_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference {
+    return m_list->m_slots[m_index].value();
+  }
+
+  auto operator->() const noexcept -> pointer {
+    return std::addressof(m_list->m_slots[m_index].value());
+  }
+
+  auto operator==(const IndexedList_Iterator &other) const noexcept -> bool {
+    return m_index == other.m_index;
+  }
+
+  auto operator!=(const IndexedList_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  friend ListType;
+
+  ListType *m_list;
+  index_type m_index;
+};
+
+/**
+ * @brief Const forward iterator for IndexedList container
+ *
+ * @tparam ListType The list container type this const iterator is for
+ */
+template <typename ListType> class cIndexedList_Iterator {
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename ListType::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type *;
+  using reference = const value_type &;
+  using index_type = std::uint32_t;
+
+public:
+  constexpr explicit cIndexedList_Iterator(const ListType *list = nullptr,
+                                           index_type index = ListType::npos)
+      noexcept
+      : m_list(list), m_index(index) {}
+
+  auto operator++() noexcept -> cIndexedList_Iterator & {
+    m_index = m_list->m_slots[m_index].next;
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> cIndexedList_Iterator {
+    cIndexedList_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference {
+    return m_list->m_slots[m_index].value();
+  }
+
+  auto operator->() const noexcept -> pointer {
+    return std::addressof(m_list->m_slots[m_index].value());
+  }
+
+  auto operator==(const cIndexedList_Iterator &other) const noexcept -> bool {
+    return m_index == other.m_index;
+  }
+
+  auto operator!=(const cIndexedList_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  const ListType *m_list;
+  index_type m_index;
+};
+
+/**
+ * @brief Singly linked list whose nodes live in one contiguous array and are
+ * linked by 32-bit indices.
+ *
+ * @tparam T The type of elements stored in the list
+ *
+ * Each element carries a single 4-byte link instead of an 8-byte pointer
+ * plus a separate heap block, and erased slots are reused through an index
+ * freelist. When T is trivially copyable the whole list can be written and
+ * restored with serialize() and deserialize().
+ *
+ * Complexity guarantees:
+ * - add(), add_front(), add_back(): O(1) amortized
+ * - emplace_front(), emplace_back(): O(1) amortized
+ * - insert_after(), erase_after(): O(1) amortized
+ * - remove_front(): O(1)
+ * - top(), bottom(), size(), is_empty(): O(1)
+ * - clear(): O(n)
+ */
+template <typename T> class IndexedList {
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using index_type = std::uint32_t;
+  using iterator = IndexedList_Iterator<IndexedList>;
+  using const_iterator = cIndexedList_Iterator<IndexedList>;
+
+  // Raw storage keeps T free of default construction; the value exists
+  // only while the slot is linked into the list.
+  struct Slot {
+    alignas(T) unsigned char storage[sizeof(T)];
+    index_type next;
+
+    auto value() noexcept -> T & {
+      return *std::launder(reinterpret_cast<T *>(storage));
+    }
+    auto value() const noexcept -> const T & {
+      return *std::launder(reinterpret_cast<const T *>(storage));
+    }
+  };
+
+  static constexpr index_type npos = details::SlotPool<Slot>::npos;
+
+private:
+  friend iterator;
+  friend const_iterator;
+
+  details::SlotPool<Slot> m_slots;
+  index_type m_front{npos};
+  index_type m_back{npos};
+  index_type m_size{0};
+
+public:
+  IndexedList() noexcept = default;
+
+  explicit IndexedList(std::initializer_list<T> init) {
+    reserve(init.size());
+    for (const auto &value : init) {
+      add_back(value);
+    }
+  }
+
+  IndexedList(const IndexedList &other)
+      : m_slots(other.m_slots, other.m_front), m_front(other.m_front),
+        m_back(other.m_back), m_size(other.m_size) {}
+
+  IndexedList(IndexedList &&other) noexcept { swap(other); }
+
+  auto operator=(const IndexedList &other) -> IndexedList & {
+    IndexedList temp(other);
+    swap(temp);
+    return *this;
+  }
+
+  auto operator=(IndexedList &&other) noexcept -> IndexedList & {
+    swap(other);
+    return *this;
+  }
+
+  ~IndexedList() { m_slots.destroy_values(m_front); }
+
+  auto add(const T &data) -> void { emplace_back(data); }
+  auto add(T &&data) -> void { emplace_back(std::move(data)); }
+  auto add_front(const T &data) -> void { emplace_front(data); }
+  auto add_front(T &&data) -> void { emplace_front(std::move(data)); }
+  auto add_back(const T &data) -> void { emplace_back(data); }
+  auto add_back(T &&data) -> void { emplace_back(std::move(data)); }
+
+  template <typename... Args> auto emplace_front(Args &&...args) -> reference {
+    const index_type index = make_slot(std::forward<Args>(args)...);
+    m_slots[index].next = m_front;
+    m_front = index;
+    if (m_back == npos) {
+      m_back = index;
+    }
+    ++m_size;
+    return m_slots[index].value();
+  }
+
+  template <typename... Args> auto emplace_back(Args &&...args) -> reference {
+    const index_type index = make_slot(std::forward<Args>(args)...);
+    m_slots[index].next = npos;
+    if (m_back == npos) {
+      m_front = index;
+    } else {
+      m_slots[m_back].next = index;
+    }
+    m_back = index;
+    ++m_size;
+    return m_slots[index].value();
+  }
+
+  /**
+   * @brief Inserts value after pos.
+   *
+   * @return iterator to the inserted element
+   */
+  auto insert_after(iterator pos, T value) -> iterator {
+    const index_type index = make_slot(std::move(value));
+    Slot &before = m_slots[pos.m_index];
+    m_slots[index].next = before.next;
+    m_slots[pos.m_index].next = index;
+    if (m_back == pos.m_index) {
+      m_back = index;
+    }
+    ++m_size;
+    return iterator(this, index);
+  }
+
+  /**
+   * @brief Erases the element following pos.
+   *
+   * @return iterator following the erased element
+   * @throws std::out_of_range if pos is end() or the last element
+   */
+  auto erase_after(iterator pos) -> iterator {
+    if (pos.m_index == npos) {
+      throw std::out_of_range("Cannot erase past the end of the list");
+    }
+    const index_type index = m_slots[pos.m_index].next;
+    if (index == npos) {
+      throw std::out_of_range("Cannot erase past the end of the list");
+    }
+    m_slots[pos.m_index].next = m_slots[index].next;
+    if (m_back == index) {
+      m_back = pos.m_index;
+    }
+    const index_type next = m_slots[index].next;
+    free_slot(index);
+    return iterator(this, next);
+  }
+
+  auto remove_front() -> void {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot remove from empty list");
+    }
+    const index_type index = m_front;
+    m_front = m_slots[index].next;
+    if (m_front == npos) {
+      m_back = npos;
+    }
+    free_slot(index);
+  }
+
+  auto clear() noexcept -> void {
+    m_slots.destroy_values(m_front);
+    m_slots.reset();
+    m_front = m_back = npos;
+    m_size = 0;
+  }
+
+  auto reserve(size_type capacity) -> void {
+    m_slots.reserve(capacity, m_front);
+  }
+
+  [[nodiscard]] auto top() const -> const_reference {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot access top of empty list");
+    }
+    return m_slots[m_front].value();
+  }
+
+  [[nodiscard]] auto bottom() const -> const_reference {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot access bottom of empty list");
+    }
+    return m_slots[m_back].value();
+  }
+
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_size == 0; }
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return m_slots.capacity();
+  }
+
+  auto begin() noexcept -> iterator { return iterator(this, m_front); }
+  auto end() noexcept -> iterator { return iterator(this, npos); }
+  auto begin() const noexcept -> const_iterator {
+    return const_iterator(this, m_front);
+  }
+  auto end() const noexcept -> const_iterator {
+    return const_iterator(this, npos);
+  }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+
+  /**
+   * @brief Number of bytes written by serialize().
+   */
+  [[nodiscard]] auto serialized_size() const noexcept -> size_type {
+    return sizeof(details::IndexedListHeader) +
+           sizeof(Slot) * static_cast<size_type>(m_slots.used());
+  }
+
+  /**
+   * @brief Writes the list into out with two memcpy calls.
+   *
+   * @param out Buffer of at least serialized_size() bytes
+   */
+  auto serialize(void *out) const -> void {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable elements can be serialized");
+    const details::IndexedListHeader header{m_front, m_back,
+                                            m_slots.free_head(), m_size,
+                                            m_slots.used()};
+    auto *bytes = static_cast<unsigned char *>(out);
+    std::memcpy(bytes, &header, sizeof(header));
+    if (header.used != 0) {
+      std::memcpy(bytes + sizeof(header), m_slots.data(),
+                  sizeof(Slot) * header.used);
+    }
+  }
+
+  /**
+   * @brief Restores a list written by serialize().
+   *
+   * @throws std::length_error if size is too small for the encoded list
+   * @throws std::invalid_argument if the encoded links are inconsistent
+   */
+  static auto deserialize(const void *in, size_type size) -> IndexedList {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable elements can be serialized");
+    details::IndexedListHeader header{};
+    if (size < sizeof(header)) {
+      throw std::length_error("Buffer too small for an indexed list");
+    }
+    const auto *bytes = static_cast<const unsigned char *>(in);
+    std::memcpy(&header, bytes, sizeof(header));
+    if (size < sizeof(header) + sizeof(Slot) * header.used) {
+      throw std::length_error("Buffer too small for an indexed list");
+    }
+    IndexedList list;
+    if (header.used != 0) {
+      list.m_slots.assign(bytes + sizeof(header), header.used,
+                          header.free_head);
+    }
+    details::check_links(header, list.m_slots);
+    list.m_front = header.front;
+    list.m_back = header.back;
+    list.m_size = header.size;
+    return list;
+  }
+
+private:
+  template <typename... Args> auto make_slot(Args &&...args) -> index_type {
+    if (m_size == npos - 1) {
+      throw std::length_error("Indexed list exceeds 32-bit index range");
+    }
+    if (m_slots.is_full()) {
+      // The arguments may name an element of this list, which growing
+      // relocates, so the value is built before the array grows.
+      T value(std::forward<Args>(args)...);
+      return construct_slot(std::move(value));
+    }
+    return construct_slot(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  auto construct_slot(Args &&...args) -> index_type {
+    const index_type index = m_slots.acquire(m_front);
+    try {
+      ::new (static_cast<void *>(m_slots[index].storage))
+          T(std::forward<Args>(args)...);
+    } catch (...) {
+      m_slots.release(index);
+      throw;
+    }
+    return index;
+  }
+
+  auto free_slot(index_type index) noexcept -> void {
+    std::destroy_at(std::addressof(m_slots[index].value()));
+    m_slots.release(index);
+    --m_size;
+  }
+
+  auto swap(IndexedList &other) noexcept -> void {
+    using std::swap;
+    m_slots.swap(other.m_slots);
+    swap(m_front, other.m_front);
+    swap(m_back, other.m_back);
+    swap(m_size, other.m_size);
+  }
+};
+
+/**
+ * @brief Bidirectional iterator for IndexedDoublyList container
+ *
+ * @tparam ListType The list container type this iterator is for
+ *
+ * @note The iterator stores the list and a slot index, so it stays valid
+ * when the slot array grows, and --end() reaches the back element.
+ */
+template <typename ListType> class IndexedDoublyList_Iterator {
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename ListType::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = value_type *;
+  using reference = value_type &;
+  using index_type = std::uint32_t;
+
+public:
+  constexpr explicit IndexedDoublyList_Iterator(
+      ListType *list = nullptr, index_type index = ListType::npos) noexcept
+      : m_list(list), m_index(index) {}
+
+  auto operator++() noexcept -> IndexedDoublyList_Iterator & {
+    m_index = m_list->m_slots[m_index].next;
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> IndexedDoublyList_Iterator {
+    IndexedDoublyList_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> IndexedDoublyList_Iterator & {
+    m_index = m_index == ListType::npos ? m_list->m_back
+                                        : m_list->m_slots[m_index].prev;
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> IndexedDoublyList_Iterator {
+    IndexedDoublyList_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference {
+    return m_list->m_slots[m_index].value();
+  }
+
+  auto operator->() const noexcept -> pointer {
+    return std::addressof(m_list->m_slots[m_index].value());
+  }
+
+  auto operator==(const IndexedDoublyList_Iterator &other) const noexcept
+      -> bool {
+    return m_index == other.m_index;
+  }
+
+  auto operator!=(const IndexedDoublyList_Iterator &other) const noexcept
+      -> bool {
+    return !(*this == other);
+  }
+
+private:
+  friend ListType;
+
+  ListType *m_list;
+  index_type m_index;
+};
+
+/**
+ * @brief Const bidirectional iterator for IndexedDoublyList container
+ *
+ * @tparam ListType The list container type this const iterator is for
+ */
+template <typename ListType> class cIndexedDoublyList_Iterator {
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename ListType::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type *;
+  using reference = const value_type &;
+  using index_type = std::uint32_t;
+
+public:
+  constexpr explicit cIndexedDoublyList_Iterator(
+      const ListType *list = nullptr,
+      index_type index = ListType::npos) noexcept
+      : m_list(list), m_index(index) {}
+
+  auto operator++() noexcept -> cIndexedDoublyList_Iterator & {
+    m_index = m_list->m_slots[m_index].next;
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> cIndexedDoublyList_Iterator {
+    cIndexedDoublyList_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> cIndexedDoublyList_Iterator & {
+    m_index = m_index == ListType::npos ? m_list->m_back
+                                        : m_list->m_slots[m_index].prev;
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> cIndexedDoublyList_Iterator {
+    cIndexedDoublyList_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference {
+    return m_list->m_slots[m_index].value();
+  }
+
+  auto operator->() const noexcept -> pointer {
+    return std::addressof(m_list->m_slots[m_index].value());
+  }
+
+  auto operator==(const cIndexedDoublyList_Iterator &other) const noexcept
+      -> bool {
+    return m_index == other.m_index;
+  }
+
+  auto operator!=(const cIndexedDoublyList_Iterator &other) const noexcept
+      -> bool {
+    return !(*this == other);
+  }
+
+private:
+  const ListType *m_list;
+  index_type m_index;
+};
+
+/**
+ * @brief Doubly linked list whose nodes live in one contiguous array and are
+ * linked by 32-bit indices.
+ *
+ * @tparam T The type of elements stored in the list
+ *
+ * The two links of an element take 8 bytes instead of the 16 bytes of a
+ * pointer-linked DoublyList node, and erased slots are reused through an
+ * index freelist. Iterators and element indices stay valid until their
+ * element is erased, even when the slot array grows. When T is trivially
+ * copyable the whole list can be written and restored with serialize() and
+ * deserialize().
+ *
+ * Complexity guarantees:
+ * - add(), add_front(), add_back(): O(1) amortized
+ * - emplace_front(), emplace_back(), emplace(), insert(): O(1) amortized
+ * - erase(), remove_front(), remove_back(): O(1)
+ * - top(), bottom(), size(), is_empty(): O(1)
+ * - clear(): O(n)
+ */
+template <typename T> class IndexedDoublyList {
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using index_type = std::uint32_t;
+  using iterator = IndexedDoublyList_Iterator<IndexedDoublyList>;
+  using const_iterator = cIndexedDoublyList_Iterator<IndexedDoublyList>;
+
+  // Raw storage keeps T free of default construction; the value exists
+  // only while the slot is linked into the list.
+  struct Slot {
+    alignas(T) unsigned char storage[sizeof(T)];
+    index_type next;
+    index_type prev;
+
+    auto value() noexcept -> T & {
+      return *std::launder(reinterpret_cast<T *>(storage));
+    }
+    auto value() const noexcept -> const T & {
+      return *std::launder(reinterpret_cast<const T *>(storage));
+    }
+  };
+
+  static constexpr index_type npos = details::SlotPool<Slot>::npos;
+
+private:
+  friend iterator;
+  friend const_iterator;
+
+  details::SlotPool<Slot> m_slots;
+  index_type m_front{npos};
+  index_type m_back{npos};
+  index_type m_size{0};
+
+public:
+  IndexedDoublyList() noexcept = default;
+
+  explicit IndexedDoublyList(std::initializer_list<T> init) {
+    reserve(init.size());
+    for (const auto &value : init) {
+      add_back(value);
+    }
+  }
+
+  IndexedDoublyList(const IndexedDoublyList &other)
+      : m_slots(other.m_slots, other.m_front), m_front(other.m_front),
+        m_back(other.m_back), m_size(other.m_size) {}
+
+  IndexedDoublyList(IndexedDoublyList &&other) noexcept { swap(other); }
+
+  auto operator=(const IndexedDoublyList &other) -> IndexedDoublyList & {
+    IndexedDoublyList temp(other);
+    swap(temp);
+    return *this;
+  }
+
+  auto operator=(IndexedDoublyList &&other) noexcept -> IndexedDoublyList & {
+    swap(other);
+    return *this;
+  }
+
+  ~IndexedDoublyList() { m_slots.destroy_values(m_front); }
+
+  auto add(const T &data) -> void { emplace_back(data); }
+  auto add(T &&data) -> void { emplace_back(std::move(data)); }
+  auto add_front(const T &data) -> void { emplace_front(data); }
+  auto add_front(T &&data) -> void { emplace_front(std::move(data)); }
+  auto add_back(const T &data) -> void { emplace_back(data); }
+  auto add_back(T &&data) -> void { emplace_back(std::move(data)); }
+
+  template <typename... Args> auto emplace_front(Args &&...args) -> reference {
+    return *emplace(begin(), std::forward<Args>(args)...);
+  }
+
+  template <typename... Args> auto emplace_back(Args &&...args) -> reference {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+
+  auto insert(iterator pos, const T &value) -> iterator {
+    return emplace(pos, value);
+  }
+
+  auto insert(iterator pos, T &&value) -> iterator {
+    return emplace(pos, std::move(value));
+  }
+
+  /**
+   * @brief Constructs an element in front of pos.
+   *
+   * @return iterator to the constructed element
+   */
+  template <typename... Args>
+  auto emplace(iterator pos, Args &&...args) -> iterator {
+    const index_type index = make_slot(std::forward<Args>(args)...);
+    const index_type next = pos.m_index;
+    const index_type prev = next == npos ? m_back : m_slots[next].prev;
+    m_slots[index].next = next;
+    m_slots[index].prev = prev;
+    if (prev == npos) {
+      m_front = index;
+    } else {
+      m_slots[prev].next = index;
+    }
+    if (next == npos) {
+      m_back = index;
+    } else {
+      m_slots[next].prev = index;
+    }
+    ++m_size;
+    return iterator(this, index);
+  }
+
+  /**
+   * @brief Unlinks the element at pos and returns its slot to the freelist.
+   *
+   * @return iterator following the erased element
+   * @throws std::out_of_range if pos is end()
+   */
+  auto erase(iterator pos) -> iterator {
+    const index_type index = pos.m_index;
+    if (index == npos) {
+      throw std::out_of_range("Cannot erase end iterator");
+    }
+    const index_type next = m_slots[index].next;
+    const index_type prev = m_slots[index].prev;
+    if (prev == npos) {
+      m_front = next;
+    } else {
+      m_slots[prev].next = next;
+    }
+    if (next == npos) {
+      m_back = prev;
+    } else {
+      m_slots[next].prev = prev;
+    }
+    std::destroy_at(std::addressof(m_slots[index].value()));
+    m_slots.release(index);
+    --m_size;
+    return iterator(this, next);
+  }
+
+  auto remove_front() -> void {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot remove from empty list");
+    }
+    erase(begin());
+  }
+
+  auto remove_back() -> void {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot remove from empty list");
+    }
+    erase(iterator(this, m_back));
+  }
+
+  auto clear() noexcept -> void {
+    m_slots.destroy_values(m_front);
+    m_slots.reset();
+    m_front = m_back = npos;
+    m_size = 0;
+  }
+
+  auto reserve(size_type capacity) -> void {
+    m_slots.reserve(capacity, m_front);
+  }
+
+  [[nodiscard]] auto top() const -> const_reference {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot access top of empty list");
+    }
+    return m_slots[m_front].value();
+  }
+
+  [[nodiscard]] auto bottom() const -> const_reference {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot access bottom of empty list");
+    }
+    return m_slots[m_back].value();
+  }
+
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_size == 0; }
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return m_slots.capacity();
+  }
+
+  auto begin() noexcept -> iterator { return iterator(this, m_front); }
+  auto end() noexcept -> iterator { return iterator(this, npos); }
+  auto begin() const noexcept -> const_iterator {
+    return const_iterator(this, m_front);
+  }
+  auto end() const noexcept -> const_iterator {
+    return const_iterator(this, npos);
+  }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+
+  /**
+   * @brief Number of bytes written by serialize().
+   */
+  [[nodiscard]] auto serialized_size() const noexcept -> size_type {
+    return sizeof(details::IndexedListHeader) +
+           sizeof(Slot) * static_cast<size_type>(m_slots.used());
+  }
+
+  /**
+   * @brief Writes the list into out with two memcpy calls.
+   *
+   * @param out Buffer of at least serialized_size() bytes
+   */
+  auto serialize(void *out) const -> void {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable elements can be serialized");
+    const details::IndexedListHeader header{m_front, m_back,
+                                            m_slots.free_head(), m_size,
+                                            m_slots.used()};
+    auto *bytes = static_cast<unsigned char *>(out);
+    std::memcpy(bytes, &header, sizeof(header));
+    if (header.used != 0) {
+      std::memcpy(bytes + sizeof(header), m_slots.data(),
+                  sizeof(Slot) * header.used);
+    }
+  }
+
+  /**
+   * @brief Restores a list written by serialize().
+   *
+   * @throws std::length_error if size is too small for the encoded list
+   * @throws std::invalid_argument if the encoded links are inconsistent
+   */
+  static auto deserialize(const void *in, size_type size)
+      -> IndexedDoublyList {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable elements can be serialized");
+    details::IndexedListHeader header{};
+    if (size < sizeof(header)) {
+      throw std::length_error("Buffer too small for an indexed list");
+    }
+    const auto *bytes = static_cast<const unsigned char *>(in);
+    std::memcpy(&header, bytes, sizeof(header));
+    if (size < sizeof(header) + sizeof(Slot) * header.used) {
+      throw std::length_error("Buffer too small for an indexed list");
+    }
+    IndexedDoublyList list;
+    if (header.used != 0) {
+      list.m_slots.assign(bytes + sizeof(header), header.used,
+                          header.free_head);
+    }
+    details::check_links(header, list.m_slots);
+    list.m_front = header.front;
+    list.m_back = header.back;
+    list.m_size = header.size;
+    return list;
+  }
+
+private:
+  template <typename... Args> auto make_slot(Args &&...args) -> index_type {
+    if (m_size == npos - 1) {
+      throw std::length_error("Indexed list exceeds 32-bit index range");
+    }
+    if (m_slots.is_full()) {
+      // The arguments may name an element of this list, which growing
+      // relocates, so the value is built before the array grows.
+      T value(std::forward<Args>(args)...);
+      return construct_slot(std::move(value));
+    }
+    return construct_slot(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  auto construct_slot(Args &&...args) -> index_type {
+    const index_type index = m_slots.acquire(m_front);
+    try {
+      ::new (static_cast<void *>(m_slots[index].storage))
+          T(std::forward<Args>(args)...);
+    } catch (...) {
+      m_slots.release(index);
+      throw;
+    }
+    return index;
+  }
+
+  auto swap(IndexedDoublyList &other) noexcept -> void {
+    using std::swap;
+    m_slots.swap(other.m_slots);
+    swap(m_front, other.m_front);
+    swap(m_back, other.m_back);
+    swap(m_size, other.m_size);
+  }
+};
+
+#endif // __INDEXED_LIST_HPP__
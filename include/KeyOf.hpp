@@ -0,0 +1,23 @@
+#ifndef __KEY_OF_HPP__
+#define __KEY_OF_HPP__
+
+namespace details {
+// Key extraction for containers that store whole entries but order and
+// search them by key: map entries are keyed by their first member, set
+// entries by themselves.
+struct KeyOfPair {
+  template <typename Pair>
+  auto operator()(const Pair &pair) const noexcept -> const auto & {
+    return pair.first;
+  }
+};
+
+struct KeyOfSelf {
+  template <typename T>
+  auto operator()(const T &value) const noexcept -> const T & {
+    return value;
+  }
+};
+} // namespace details
+
+#endif // __KEY_OF_HPP__
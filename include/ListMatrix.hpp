@@ -0,0 +1,539 @@
+#ifndef __LIST_MATRIX_HPP__
+#define __LIST_MATRIX_HPP__
+
+#include "Parallel.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+template <typename T, typename Index> class ListMatrix;
+
+/**
+ * @brief Coordinate-list (COO) accumulator for building a ListMatrix
+ *
+ * @tparam T The arithmetic element type
+ * @tparam Index Unsigned integer type of stored row and column indices
+ *
+ * insert() appends a (row, col, value) triple in O(1) amortized, in any
+ * order; entries given more than once for the same cell are summed when
+ * the triples are converted by build().
+ *
+ * Complexity guarantees:
+ * - insert(): O(1) amortized
+ * - build(): O(size() + rows + cols)
+ * - size(), rows(), cols(): O(1)
+ *
+ * @example
+ * ListMatrixBuilder<double> edges(3, 3);
+ * edges.insert(0, 2, 1.0);
+ * edges.insert(2, 0, 1.0);
+ * ListMatrix<double> adjacency = edges.build();
+ */
+template <typename T, typename Index = std::uint32_t> class ListMatrixBuilder {
+  static_assert(std::is_arithmetic_v<T>, "ListMatrix holds arithmetic types");
+  static_assert(std::is_unsigned_v<Index>, "Index must be unsigned");
+
+public:
+  using value_type = T;
+  using index_type = Index;
+  using size_type = std::size_t;
+
+private:
+  size_type m_rows;
+  size_type m_cols;
+  Vector<Index> m_row_of;
+  Vector<Index> m_col_of;
+  Vector<T> m_values;
+
+public:
+  /**
+   * @throws std::length_error if rows or cols do not fit in Index
+   */
+  ListMatrixBuilder(size_type rows, size_type cols)
+      : m_rows(rows), m_cols(cols) {
+    if (rows > std::numeric_limits<Index>::max() ||
+        cols > std::numeric_limits<Index>::max()) {
+      throw std::length_error("Matrix dimensions exceed index type");
+    }
+  }
+
+  /**
+   * @brief Adds value to the cell (row, col).
+   *
+   * @throws std::out_of_range if the cell lies outside the matrix
+   */
+  auto insert(size_type row, size_type col, const T &value) -> void {
+    if (row >= m_rows || col >= m_cols) {
+      throw std::out_of_range("Matrix index out of bounds");
+    }
+    m_row_of.push_back(static_cast<Index>(row));
+    m_col_of.push_back(static_cast<Index>(col));
+    m_values.push_back(value);
+  }
+
+  auto reserve(size_type count) -> void {
+    m_row_of.reserve(count);
+    m_col_of.reserve(count);
+    m_values.reserve(count);
+  }
+
+  auto clear() noexcept -> void {
+    m_row_of.clear();
+    m_col_of.clear();
+    m_values.clear();
+  }
+
+  /**
+   * @brief Calls fn(row, col, value) for every triple in insertion order.
+   */
+  template <typename Function> auto for_each(Function fn) const -> void {
+    for (size_type i = 0; i < m_values.size(); ++i) {
+      fn(static_cast<size_type>(m_row_of.data()[i]),
+         static_cast<size_type>(m_col_of.data()[i]), m_values.data()[i]);
+    }
+  }
+
+  /**
+   * @brief Converts the triples to compressed sparse rows.
+   */
+  [[nodiscard]] auto build() const -> ListMatrix<T, Index> {
+    return ListMatrix<T, Index>(*this);
+  }
+
+  // Capacity
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return m_values.size();
+  }
+  [[nodiscard]] auto is_empty() const noexcept -> bool {
+    return m_values.is_empty();
+  }
+  [[nodiscard]] auto rows() const noexcept -> size_type { return m_rows; }
+  [[nodiscard]] auto cols() const noexcept -> size_type { return m_cols; }
+
+private:
+  friend class ListMatrix<T, Index>;
+};
+
+/**
+ * @brief Sparse matrix in compressed sparse row (CSR) form
+ *
+ * @tparam T The arithmetic element type
+ * @tparam Index Unsigned integer type of stored column indices
+ *
+ * The nonzeros of each row sit contiguously in column order in two flat
+ * arrays (columns and values), and row r spans [offsets()[r],
+ * offsets()[r + 1]) of them. Matrices come from a ListMatrixBuilder, whose
+ * COO triples are converted with two counting-sort passes, or from
+ * slice_rows() and transpose() of another ListMatrix. The sparsity pattern
+ * is fixed once built; stored values can be changed in place.
+ *
+ * multiply() computes a sparse matrix-vector product and can split the
+ * rows across threads. The split balances stored entries plus rows, so a
+ * few very long rows, as in power-law graphs, do not leave threads idle.
+ *
+ * Complexity guarantees:
+ * - at(), contains(): O(log row_size())
+ * - row_size(): O(1)
+ * - for_each_in_row(): O(row_size())
+ * - multiply(): O(nonzeros() + rows())
+ * - slice_rows(first, last): O(last - first + nonzeros in the slice)
+ * - transpose(): O(nonzeros() + rows() + cols())
+ * - rows(), cols(), nonzeros(): O(1)
+ *
+ * @example
+ * ListMatrixBuilder<float> builder(2, 3);
+ * builder.insert(0, 1, 2.0F);
+ * builder.insert(1, 2, 3.0F);
+ * ListMatrix<float> matrix(builder);
+ * Vector<float> y = matrix.multiply(Vector<float>(3, 1.0F), 4);
+ * assert(y.data()[1] == 3.0F && matrix.transpose().at(2, 1) == 3.0F);
+ */
+template <typename T, typename Index = std::uint32_t> class ListMatrix {
+  static_assert(std::is_arithmetic_v<T>, "ListMatrix holds arithmetic types");
+  static_assert(std::is_unsigned_v<Index>, "Index must be unsigned");
+
+public:
+  using value_type = T;
+  using index_type = Index;
+  using size_type = std::size_t;
+
+private:
+  size_type m_rows{0};
+  size_type m_cols{0};
+  // Empty in a default-constructed or moved-from matrix, which reads as
+  // 0 x 0 through row_offsets().
+  Vector<size_type> m_offsets;
+  Vector<Index> m_columns;
+  Vector<T> m_values;
+
+public:
+  ListMatrix() = default;
+
+  ListMatrix(const ListMatrix &other) = default;
+
+  ListMatrix(ListMatrix &&other) noexcept
+      : m_rows(std::exchange(other.m_rows, 0)),
+        m_cols(std::exchange(other.m_cols, 0)),
+        m_offsets(std::move(other.m_offsets)),
+        m_columns(std::move(other.m_columns)),
+        m_values(std::move(other.m_values)) {}
+
+  auto operator=(const ListMatrix &other) -> ListMatrix & = default;
+
+  auto operator=(ListMatrix &&other) noexcept -> ListMatrix & {
+    ListMatrix temp(std::move(other));
+    swap(temp);
+    return *this;
+  }
+
+  ~ListMatrix() = default;
+
+  /**
+   * @brief rows x cols matrix without nonzeros.
+   */
+  ListMatrix(size_type rows, size_type cols)
+      : m_rows(rows), m_cols(cols), m_offsets(rows + 1) {
+    if (cols > std::numeric_limits<Index>::max()) {
+      throw std::length_error("Matrix dimensions exceed index type");
+    }
+  }
+
+  /**
+   * @brief Converts the builder's triples, summing repeated cells.
+   */
+  explicit ListMatrix(const ListMatrixBuilder<T, Index> &builder)
+      : m_rows(builder.m_rows), m_cols(builder.m_cols) {
+    const size_type count = builder.size();
+    const Index *row_of = builder.m_row_of.data();
+    const Index *col_of = builder.m_col_of.data();
+
+    // Pass 1 moves the triples into column order, pass 2 stably into row
+    // order, which leaves every row sorted by column. Both passes read
+    // their input sequentially.
+    Vector<size_type> starts(m_cols + 1);
+    size_type *start = starts.data();
+    Vector<Index> row_by_column(count);
+    Vector<T> value_by_column(count);
+    for (size_type i = 0; i < count; ++i) {
+      ++start[col_of[i] + 1];
+    }
+    for (size_type c = 0; c < m_cols; ++c) {
+      start[c + 1] += start[c];
+    }
+    {
+      Vector<size_type> cursor(starts);
+      for (size_type i = 0; i < count; ++i) {
+        const size_type at = cursor.data()[col_of[i]]++;
+        row_by_column.data()[at] = row_of[i];
+        value_by_column.data()[at] = builder.m_values.data()[i];
+      }
+    }
+    Vector<size_type> offsets(m_rows + 1);
+    size_type *offset = offsets.data();
+    for (size_type i = 0; i < count; ++i) {
+      ++offset[row_of[i] + 1];
+    }
+    for (size_type r = 0; r < m_rows; ++r) {
+      offset[r + 1] += offset[r];
+    }
+    Vector<Index> columns(count);
+    Vector<T> values(count);
+    {
+      Vector<size_type> cursor(offsets);
+      for (size_type c = 0; c < m_cols; ++c) {
+        for (size_type k = start[c]; k < start[c + 1]; ++k) {
+          const size_type at = cursor.data()[row_by_column.data()[k]]++;
+          columns.data()[at] = static_cast<Index>(c);
+          values.data()[at] = value_by_column.data()[k];
+        }
+      }
+    }
+
+    // Repeated cells are now adjacent; fold them in place.
+    size_type kept = 0;
+    size_type first = 0;
+    for (size_type r = 0; r < m_rows; ++r) {
+      const size_type last = offset[r + 1];
+      for (size_type k = first; k < last; ++k) {
+        if (kept > offset[r] && columns.data()[kept - 1] == columns.data()[k]) {
+          values.data()[kept - 1] += values.data()[k];
+        } else {
+          columns.data()[kept] = columns.data()[k];
+          values.data()[kept] = values.data()[k];
+          ++kept;
+        }
+      }
+      first = last;
+      offset[r + 1] = kept;
+    }
+    columns.resize(kept);
+    values.resize(kept);
+    m_offsets = std::move(offsets);
+    m_columns = std::move(columns);
+    m_values = std::move(values);
+  }
+
+  // Element access
+  /**
+   * @brief Value of the cell (row, col), zero when it is not stored.
+   *
+   * @throws std::out_of_range if the cell lies outside the matrix
+   */
+  [[nodiscard]] auto at(size_type row, size_type col) const -> T {
+    const T *value = find(row, col);
+    return value == nullptr ? T{} : *value;
+  }
+
+  [[nodiscard]] auto contains(size_type row, size_type col) const -> bool {
+    return find(row, col) != nullptr;
+  }
+
+  /**
+   * @brief Pointer to the stored value of (row, col), or nullptr.
+   *
+   * @throws std::out_of_range if the cell lies outside the matrix
+   */
+  [[nodiscard]] auto find(size_type row, size_type col) -> T * {
+    return const_cast<T *>(std::as_const(*this).find(row, col));
+  }
+
+  [[nodiscard]] auto find(size_type row, size_type col) const -> const T * {
+    if (row >= m_rows || col >= m_cols) {
+      throw std::out_of_range("Matrix index out of bounds");
+    }
+    const Index *first = m_columns.data() + row_offsets()[row];
+    const Index *last = m_columns.data() + row_offsets()[row + 1];
+    const Index *it = std::lower_bound(first, last, static_cast<Index>(col));
+    if (it == last || *it != col) {
+      return nullptr;
+    }
+    return m_values.data() + (it - m_columns.data());
+  }
+
+  [[nodiscard]] auto row_size(size_type row) const -> size_type {
+    check_row(row);
+    return row_offsets()[row + 1] - row_offsets()[row];
+  }
+
+  /**
+   * @brief Calls fn(col, value) for the stored cells of row in column
+   * order.
+   */
+  template <typename Function>
+  auto for_each_in_row(size_type row, Function fn) -> void {
+    check_row(row);
+    for (size_type k = row_offsets()[row]; k < row_offsets()[row + 1];
+         ++k) {
+      fn(static_cast<size_type>(m_columns.data()[k]), m_values.data()[k]);
+    }
+  }
+
+  template <typename Function>
+  auto for_each_in_row(size_type row, Function fn) const -> void {
+    check_row(row);
+    for (size_type k = row_offsets()[row]; k < row_offsets()[row + 1];
+         ++k) {
+      fn(static_cast<size_type>(m_columns.data()[k]),
+         static_cast<const T &>(m_values.data()[k]));
+    }
+  }
+
+  // Raw CSR arrays
+  [[nodiscard]] auto offsets() const noexcept -> const size_type * {
+    return row_offsets();
+  }
+  [[nodiscard]] auto columns() const noexcept -> const Index * {
+    return m_columns.data();
+  }
+  [[nodiscard]] auto values() noexcept -> T * { return m_values.data(); }
+  [[nodiscard]] auto values() const noexcept -> const T * {
+    return m_values.data();
+  }
+
+  // Operations
+  /**
+   * @brief y = A x for x of cols() elements.
+   *
+   * @param thread_count threads to split the rows across
+   * @throws std::invalid_argument if x does not have cols() elements
+   */
+  [[nodiscard]] auto multiply(const Vector<T> &x,
+                              size_type thread_count = 1) const -> Vector<T> {
+    if (x.size() != m_cols) {
+      throw std::invalid_argument("Matrix dimensions do not match");
+    }
+    Vector<T> y(m_rows);
+    multiply(x.data(), y.data(), thread_count);
+    return y;
+  }
+
+  /**
+   * @brief y = A x for raw arrays of cols() and rows() elements.
+   */
+  auto multiply(const T *x, T *y, size_type thread_count = 1) const -> void {
+    // Part p covers the rows whose work, entries plus rows before them,
+    // falls in [p, p + 1) * total / parts.
+    const size_type *offsets = row_offsets();
+    const size_type parts = std::clamp<size_type>(thread_count, 1, m_rows + 1);
+    const size_type total = m_values.size() + m_rows;
+    auto boundary = [&](size_type part) {
+      if (part == parts) {
+        return m_rows;
+      }
+      const size_type target = total / parts * part;
+      size_type low = 0;
+      size_type high = m_rows;
+      while (low < high) {
+        const size_type mid = low + (high - low) / 2;
+        if (offsets[mid] + mid < target) {
+          low = mid + 1;
+        } else {
+          high = mid;
+        }
+      }
+      return low;
+    };
+    details::parallel_ranges(
+        parts, 1, parts, [&](size_type first, size_type last) {
+          for (size_type part = first; part < last; ++part) {
+            multiply_rows(boundary(part), boundary(part + 1), x, y);
+          }
+        });
+  }
+
+  [[nodiscard]] auto operator*(const Vector<T> &x) const -> Vector<T> {
+    return multiply(x);
+  }
+
+  /**
+   * @brief Rows [first, last) as a (last - first) x cols() matrix.
+   *
+   * @throws std::out_of_range if the range is not within the matrix
+   */
+  [[nodiscard]] auto slice_rows(size_type first, size_type last) const
+      -> ListMatrix {
+    if (first > last || last > m_rows) {
+      throw std::out_of_range("Row range out of bounds");
+    }
+    ListMatrix result(last - first, m_cols);
+    const size_type begin = row_offsets()[first];
+    const size_type end = row_offsets()[last];
+    for (size_type r = first; r <= last; ++r) {
+      result.m_offsets.data()[r - first] = row_offsets()[r] - begin;
+    }
+    result.m_columns = Vector<Index>(m_columns.data() + begin,
+                                     m_columns.data() + end);
+    result.m_values = Vector<T>(m_values.data() + begin,
+                                m_values.data() + end);
+    return result;
+  }
+
+  /**
+   * @brief The cols() x rows() transpose, again with every row sorted by
+   * column.
+   *
+   * @throws std::length_error if rows() does not fit in Index
+   */
+  [[nodiscard]] auto transpose() const -> ListMatrix {
+    if (m_rows > std::numeric_limits<Index>::max()) {
+      throw std::length_error("Matrix dimensions exceed index type");
+    }
+    ListMatrix result(m_cols, m_rows);
+    const size_type count = m_values.size();
+    size_type *offset = result.m_offsets.data();
+    for (size_type k = 0; k < count; ++k) {
+      ++offset[m_columns.data()[k] + 1];
+    }
+    for (size_type c = 0; c < m_cols; ++c) {
+      offset[c + 1] += offset[c];
+    }
+    result.m_columns.resize(count);
+    result.m_values.resize(count);
+    Vector<size_type> cursor(result.m_offsets);
+    for (size_type r = 0; r < m_rows; ++r) {
+      for (size_type k = row_offsets()[r]; k < row_offsets()[r + 1];
+           ++k) {
+        const size_type at = cursor.data()[m_columns.data()[k]]++;
+        result.m_columns.data()[at] = static_cast<Index>(r);
+        result.m_values.data()[at] = m_values.data()[k];
+      }
+    }
+    return result;
+  }
+
+  [[nodiscard]] auto operator==(const ListMatrix &other) const noexcept
+      -> bool {
+    return m_rows == other.m_rows && m_cols == other.m_cols &&
+           std::equal(row_offsets(), row_offsets() + m_rows + 1,
+                      other.row_offsets()) &&
+           std::equal(m_columns.data(), m_columns.data() + m_columns.size(),
+                      other.m_columns.data()) &&
+           std::equal(m_values.data(), m_values.data() + m_values.size(),
+                      other.m_values.data());
+  }
+
+  [[nodiscard]] auto operator!=(const ListMatrix &other) const noexcept
+      -> bool {
+    return !(*this == other);
+  }
+
+  auto swap(ListMatrix &other) noexcept -> void {
+    using std::swap;
+    swap(m_rows, other.m_rows);
+    swap(m_cols, other.m_cols);
+    swap(m_offsets, other.m_offsets);
+    swap(m_columns, other.m_columns);
+    swap(m_values, other.m_values);
+  }
+
+  // Capacity
+  [[nodiscard]] auto rows() const noexcept -> size_type { return m_rows; }
+  [[nodiscard]] auto cols() const noexcept -> size_type { return m_cols; }
+  [[nodiscard]] auto nonzeros() const noexcept -> size_type {
+    return m_values.size();
+  }
+
+private:
+  [[nodiscard]] auto row_offsets() const noexcept -> const size_type * {
+    static constexpr size_type no_rows[1] = {0};
+    return m_offsets.is_empty() ? no_rows : m_offsets.data();
+  }
+
+  auto check_row(size_type row) const -> void {
+    if (row >= m_rows) {
+      throw std::out_of_range("Matrix index out of bounds");
+    }
+  }
+
+  // Four independent sums per row keep long rows from serializing on one
+  // add.
+  auto multiply_rows(size_type first, size_type last, const T *x,
+                     T *y) const noexcept -> void {
+    const size_type *offsets = row_offsets();
+    const Index *columns = m_columns.data();
+    const T *values = m_values.data();
+    for (size_type r = first; r < last; ++r) {
+      const size_type end = offsets[r + 1];
+      size_type k = offsets[r];
+      T sum[4] = {};
+      for (; k + 4 <= end; k += 4) {
+        sum[0] += values[k] * x[columns[k]];
+        sum[1] += values[k + 1] * x[columns[k + 1]];
+        sum[2] += values[k + 2] * x[columns[k + 2]];
+        sum[3] += values[k + 3] * x[columns[k + 3]];
+      }
+      for (; k < end; ++k) {
+        sum[0] += values[k] * x[columns[k]];
+      }
+      y[r] = (sum[0] + sum[1]) + (sum[2] + sum[3]);
+    }
+  }
+};
+
+#endif // __LIST_MATRIX_HPP__
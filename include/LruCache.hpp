@@ -0,0 +1,405 @@
+#ifndef __LRU_CACHE_HPP__
+#define __LRU_CACHE_HPP__
+
+#include "DoublyList.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Default entry weight used for the byte-size bound of LruCache.
+ */
+template <typename Key, typename Value> struct LruEntryBytes {
+  constexpr auto operator()(const Key &, const Value &) const noexcept
+      -> std::size_t {
+    return sizeof(Key) + sizeof(Value);
+  }
+};
+
+/**
+ * @brief Least-recently-used cache with O(1) lookup, insertion and eviction.
+ *
+ * @tparam Key The key type, must be hashable with Hash
+ * @tparam Value The cached value type
+ * @tparam Hash The hash function for keys
+ * @tparam KeyEqual The equality predicate for keys
+ * @tparam Weigher Callable returning the byte size charged for an entry
+ *
+ * @requires Key and Value must be default constructible
+ *
+ * Entries live in a DoublyList ordered from most to least recently used and
+ * a hash index maps each key to its list node. A hit relinks the node to the
+ * front with splice, so neither the node nor the value is moved in memory.
+ * The cache holds iterators into its own list and is therefore neither
+ * copyable nor movable.
+ *
+ * Complexity guarantees:
+ * - get(): O(1) average
+ * - peek(): O(1) average
+ * - put(): O(1) average, plus O(1) per evicted entry
+ * - erase(): O(1) average
+ * - size(), bytes(): O(1)
+ *
+ * @example
+ * LruCache<int, std::string> cache(2);
+ * cache.put(1, "one");
+ * cache.put(2, "two");
+ * cache.get(1);         // 1 becomes most recently used
+ * cache.put(3, "three"); // evicts 2
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Weigher = LruEntryBytes<Key, Value>>
+class LruCache {
+public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using eviction_callback = std::function<void(const Key &, Value &)>;
+
+  static constexpr size_type unbounded = std::numeric_limits<size_type>::max();
+
+private:
+  struct Entry {
+    Key key{};
+    Value value{};
+    size_type bytes{0};
+
+    Entry() = default;
+    Entry(const Key &k, Value &&v, size_type b)
+        : key(k), value(std::move(v)), bytes(b) {}
+  };
+
+  using list_type = DoublyList<Entry>;
+  using list_iterator = typename list_type::iterator;
+
+  list_type m_entries;
+  std::unordered_map<Key, list_iterator, Hash, KeyEqual> m_index;
+  size_type m_capacity;
+  size_type m_max_bytes;
+  size_type m_bytes{0};
+  Weigher m_weigher;
+  eviction_callback m_on_evict;
+
+public:
+  /**
+   * @param capacity Maximum number of entries, must be > 0
+   * @param max_bytes Maximum total weight of the entries
+   * @throws std::invalid_argument if capacity or max_bytes is 0
+   */
+  explicit LruCache(size_type capacity, size_type max_bytes = unbounded,
+                    const Hash &hash = Hash{},
+                    const KeyEqual &equal = KeyEqual{},
+                    const Weigher &weigher = Weigher{})
+      : m_index(0, hash, equal), m_capacity(capacity),
+        m_max_bytes(max_bytes), m_weigher(weigher) {
+    if (capacity == 0 || max_bytes == 0) {
+      throw std::invalid_argument("Cache capacity must be greater than 0");
+    }
+    if (capacity != unbounded) {
+      m_index.reserve(capacity);
+    }
+  }
+
+  LruCache(const LruCache &) = delete;
+  LruCache(LruCache &&) = delete;
+  auto operator=(const LruCache &) -> LruCache & = delete;
+  auto operator=(LruCache &&) -> LruCache & = delete;
+
+  ~LruCache() = default;
+
+  /**
+   * @brief Registers a callback invoked on every entry evicted by the
+   * capacity or byte bound, before the entry is destroyed.
+   *
+   * Explicit erase() and clear() do not invoke it.
+   */
+  auto on_evict(eviction_callback callback) -> void {
+    m_on_evict = std::move(callback);
+  }
+
+  /**
+   * @brief Looks up key and marks it most recently used.
+   *
+   * @return pointer to the cached value, nullptr on a miss. The pointer stays
+   * valid until the entry is evicted or erased.
+   */
+  [[nodiscard]] auto get(const Key &key) -> Value * {
+    auto found = m_index.find(key);
+    if (found == m_index.end()) {
+      return nullptr;
+    }
+    touch(found->second);
+    return &found->second->value;
+  }
+
+  /**
+   * @brief Looks up key without changing the recency order.
+   */
+  [[nodiscard]] auto peek(const Key &key) const -> const Value * {
+    auto found = m_index.find(key);
+    return found == m_index.end() ? nullptr : &found->second->value;
+  }
+
+  [[nodiscard]] auto contains(const Key &key) const -> bool {
+    return m_index.find(key) != m_index.end();
+  }
+
+  /**
+   * @brief Inserts or replaces the value for key and marks it most recently
+   * used, evicting least recently used entries to honour both bounds.
+   *
+   * @throws std::length_error if the entry alone exceeds the byte bound
+   */
+  auto put(const Key &key, Value value) -> void {
+    const size_type weight = m_weigher(key, value);
+    if (weight > m_max_bytes) {
+      throw std::length_error("Entry exceeds cache byte capacity");
+    }
+
+    auto found = m_index.find(key);
+    if (found != m_index.end()) {
+      Entry &entry = *found->second;
+      m_bytes = m_bytes - entry.bytes + weight;
+      entry.value = std::move(value);
+      entry.bytes = weight;
+      touch(found->second);
+    } else {
+      m_entries.emplace_front(key, std::move(value), weight);
+      try {
+        m_index.emplace(key, m_entries.begin());
+      } catch (...) {
+        m_entries.erase(m_entries.begin());
+        throw;
+      }
+      m_bytes += weight;
+    }
+    evict_to_bounds();
+  }
+
+  /**
+   * @brief Removes key from the cache.
+   *
+   * @return true if an entry was removed
+   */
+  auto erase(const Key &key) -> bool {
+    auto found = m_index.find(key);
+    if (found == m_index.end()) {
+      return false;
+    }
+    m_bytes -= found->second->bytes;
+    m_entries.erase(found->second);
+    m_index.erase(found);
+    return true;
+  }
+
+  auto clear() noexcept -> void {
+    m_index.clear();
+    m_entries.clear();
+    m_bytes = 0;
+  }
+
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return m_entries.size();
+  }
+  [[nodiscard]] auto is_empty() const noexcept -> bool {
+    return m_entries.is_empty();
+  }
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return m_capacity;
+  }
+  [[nodiscard]] auto bytes() const noexcept -> size_type { return m_bytes; }
+  [[nodiscard]] auto max_bytes() const noexcept -> size_type {
+    return m_max_bytes;
+  }
+
+  /**
+   * @brief Visits the entries from most to least recently used.
+   */
+  template <typename Visitor> auto for_each(Visitor visit) const -> void {
+    for (const auto &entry : m_entries) {
+      visit(entry.key, entry.value);
+    }
+  }
+
+private:
+  auto touch(list_iterator it) noexcept -> void {
+    m_entries.splice(m_entries.begin(), m_entries, it);
+  }
+
+  auto evict_to_bounds() -> void {
+    while (m_entries.size() > m_capacity || m_bytes > m_max_bytes) {
+      auto victim = m_entries.end();
+      --victim;
+      if (m_on_evict) {
+        m_on_evict(victim->key, victim->value);
+      }
+      m_bytes -= victim->bytes;
+      m_index.erase(victim->key);
+      m_entries.erase(victim);
+    }
+  }
+};
+
+/**
+ * @brief LruCache partitioned into independently locked shards.
+ *
+ * Each key is routed by its hash to one shard, so threads touching different
+ * shards never contend. Capacity and byte bounds are split between the
+ * shards, the first total % shard_count shards taking one more, so the
+ * shard bounds add up to exactly the totals; recency is tracked per shard.
+ * Lookups return copies because a reference into a shard cannot outlive its
+ * lock; eviction callbacks run while the shard lock is held.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Weigher = LruEntryBytes<Key, Value>>
+class ShardedLruCache {
+public:
+  using cache_type = LruCache<Key, Value, Hash, KeyEqual, Weigher>;
+  using key_type = Key;
+  using mapped_type = Value;
+  using size_type = std::size_t;
+  using eviction_callback = typename cache_type::eviction_callback;
+
+  static constexpr size_type unbounded = cache_type::unbounded;
+
+private:
+  struct Shard {
+    mutable std::mutex mutex;
+    cache_type cache;
+
+    Shard(size_type capacity, size_type max_bytes, const Hash &hash,
+          const KeyEqual &equal, const Weigher &weigher)
+        : cache(capacity, max_bytes, hash, equal, weigher) {}
+  };
+
+  std::vector<std::unique_ptr<Shard>> m_shards;
+  Hash m_hash;
+
+public:
+  /**
+   * @param capacity Maximum number of entries across all shards
+   * @param shard_count Number of shards, must be > 0 and <= capacity
+   * @param max_bytes Maximum total weight across all shards, unbounded or
+   * at least shard_count
+   * @throws std::invalid_argument if shard_count is 0 or exceeds capacity or
+   * a bounded max_bytes
+   */
+  explicit ShardedLruCache(size_type capacity, size_type shard_count = 16,
+                           size_type max_bytes = unbounded,
+                           const Hash &hash = Hash{},
+                           const KeyEqual &equal = KeyEqual{},
+                           const Weigher &weigher = Weigher{})
+      : m_hash(hash) {
+    if (shard_count == 0 || shard_count > capacity) {
+      throw std::invalid_argument("Shard count must be in [1, capacity]");
+    }
+    if (max_bytes != unbounded && shard_count > max_bytes) {
+      throw std::invalid_argument("Shard count must not exceed max_bytes");
+    }
+    m_shards.reserve(shard_count);
+    for (size_type i = 0; i < shard_count; ++i) {
+      m_shards.push_back(std::make_unique<Shard>(
+          split(capacity, shard_count, i), split(max_bytes, shard_count, i),
+          hash, equal, weigher));
+    }
+  }
+
+  auto on_evict(const eviction_callback &callback) -> void {
+    for (auto &shard : m_shards) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->cache.on_evict(callback);
+    }
+  }
+
+  [[nodiscard]] auto get(const Key &key) -> std::optional<Value> {
+    Shard &shard = shard_for(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (const Value *value = shard.cache.get(key)) {
+      return *value;
+    }
+    return std::nullopt;
+  }
+
+  [[nodiscard]] auto contains(const Key &key) const -> bool {
+    const Shard &shard = shard_for(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache.contains(key);
+  }
+
+  auto put(const Key &key, Value value) -> void {
+    Shard &shard = shard_for(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.cache.put(key, std::move(value));
+  }
+
+  auto erase(const Key &key) -> bool {
+    Shard &shard = shard_for(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache.erase(key);
+  }
+
+  auto clear() -> void {
+    for (auto &shard : m_shards) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->cache.clear();
+    }
+  }
+
+  /**
+   * @brief Number of entries; shards are locked one at a time, so the result
+   * is only a snapshot under concurrent modification.
+   */
+  [[nodiscard]] auto size() const -> size_type {
+    size_type total = 0;
+    for (const auto &shard : m_shards) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      total += shard->cache.size();
+    }
+    return total;
+  }
+
+  [[nodiscard]] auto shard_count() const noexcept -> size_type {
+    return m_shards.size();
+  }
+
+private:
+  // Share of total for shard index; the shares sum to total exactly.
+  static auto split(size_type total, size_type parts, size_type index) noexcept
+      -> size_type {
+    if (total == unbounded) {
+      return unbounded;
+    }
+    return total / parts + (index < total % parts ? 1 : 0);
+  }
+
+  // Fibonacci hashing spreads weak hashes such as the identity hash of
+  // integers before the shard index is taken.
+  auto shard_index(const Key &key) const -> size_type {
+    const auto mixed = static_cast<std::uint64_t>(m_hash(key)) *
+                       UINT64_C(0x9E3779B97F4A7C15);
+    return static_cast<size_type>((mixed >> 32) % m_shards.size());
+  }
+
+  auto shard_for(const Key &key) -> Shard & {
+    return *m_shards[shard_index(key)];
+  }
+
+  auto shard_for(const Key &key) const -> const Shard & {
+    return *m_shards[shard_index(key)];
+  }
+};
+
+#endif // __LRU_CACHE_HPP__
@@ -0,0 +1,67 @@
+#ifndef __PARALLEL_HPP__
+#define __PARALLEL_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace details {
+/**
+ * @brief Runs work(first, last) over [0, count) split into contiguous
+ * ranges, one per thread, whose bounds are multiples of grain.
+ *
+ * The calling thread takes the first range. The first exception thrown by
+ * work is rethrown once every thread has finished. If a thread cannot be
+ * started, the ones already running are joined and the error is
+ * rethrown; their ranges will have been processed, the others not.
+ */
+template <typename Work>
+auto parallel_ranges(std::size_t count, std::size_t grain,
+                     std::size_t thread_count, Work work) -> void {
+  const std::size_t chunks = (count + grain - 1) / grain;
+  thread_count = std::clamp<std::size_t>(thread_count, 1,
+                                         std::max<std::size_t>(chunks, 1));
+  if (thread_count == 1) {
+    work(std::size_t{0}, count);
+    return;
+  }
+  const std::size_t span = (chunks + thread_count - 1) / thread_count * grain;
+  std::exception_ptr failure;
+  std::mutex failure_mutex;
+  auto run = [&](std::size_t first) {
+    try {
+      work(first, std::min(count, first + span));
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(failure_mutex);
+      if (!failure) {
+        failure = std::current_exception();
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count - 1);
+  try {
+    for (std::size_t first = span; first < count; first += span) {
+      threads.emplace_back(run, first);
+    }
+  } catch (...) {
+    // A joinable std::thread would terminate on destruction.
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    throw;
+  }
+  run(0);
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (failure) {
+    std::rethrow_exception(failure);
+  }
+}
+} // namespace details
+
+#endif // __PARALLEL_HPP__
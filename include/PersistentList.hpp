@@ -0,0 +1,241 @@
+#ifndef __PERSISTENT_LIST_HPP__
+#define __PERSISTENT_LIST_HPP__
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace details {
+/**
+ * @brief Immutable, reference-counted node shared between list versions.
+ */
+template <typename T> struct PersistentNode final {
+  const T data;
+  PersistentNode *const next;
+  mutable std::atomic<std::size_t> refs{1};
+
+  template <typename... Args>
+  explicit PersistentNode(PersistentNode *tail, Args &&...args)
+      : data(std::forward<Args>(args)...), next(tail) {}
+};
+} // namespace details
+
+template <typename T> class PersistentList_Iterator {
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T *;
+  using reference = const T &;
+  using node_pointer = const details::PersistentNode<T> *;
+
+public:
+  constexpr explicit PersistentList_Iterator(node_pointer ptr = nullptr) noexcept
+      : m_ptr(ptr) {}
+
+  auto operator++() noexcept -> PersistentList_Iterator & {
+    m_ptr = m_ptr->next;
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> PersistentList_Iterator {
+    PersistentList_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference { return m_ptr->data; }
+
+  auto operator->() const noexcept -> pointer {
+    return std::addressof(m_ptr->data);
+  }
+
+  auto operator==(const PersistentList_Iterator &other) const noexcept -> bool {
+    return m_ptr == other.m_ptr;
+  }
+
+  auto operator!=(const PersistentList_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  node_pointer m_ptr;
+};
+
+/**
+ * @brief Persistent singly linked list whose versions share their nodes
+ *
+ * @tparam T The type of elements stored in the list
+ *
+ * Nodes are immutable and reference counted. Copying a list (or calling
+ * snapshot()) shares the whole chain in O(1); add_front() and
+ * remove_front() only create or release the front node, so every earlier
+ * version keeps observing exactly the elements it had. Reference counts are
+ * atomic, so different list objects sharing nodes may be used and destroyed
+ * from different threads; a single list object is not synchronized.
+ *
+ * Complexity guarantees:
+ * - void add_front(const T& data) = O(1)
+ * - const T& emplace_front(Args&&... args) = O(1)
+ * - void remove_front() = O(1), plus releasing nodes no other version owns
+ * - PersistentList snapshot() = O(1)
+ * - PersistentList tail() = O(1)
+ * - void clear() = O(1), plus releasing nodes no other version owns
+ * - const T& top() = O(1)
+ * - size_t size() = O(1)
+ * - const_iterator begin() = O(1)
+ * - const_iterator end() = O(1)
+ */
+template <typename T> class PersistentList {
+private:
+  using node_type = details::PersistentNode<T>;
+
+  node_type *m_front{nullptr};
+  size_t m_size{0};
+
+public:
+  using iterator = PersistentList_Iterator<T>;
+  using const_iterator = PersistentList_Iterator<T>;
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+
+public:
+  PersistentList() = default;
+
+  /**
+   * @brief Builds a list holding the elements in the given order.
+   */
+  explicit PersistentList(std::initializer_list<T> _list) {
+    for (auto it = std::rbegin(_list); it != std::rend(_list); ++it) {
+      add_front(*it);
+    }
+  }
+
+  PersistentList(const PersistentList &other) noexcept
+      : m_front(acquire(other.m_front)), m_size(other.m_size) {}
+
+  PersistentList(PersistentList &&other) noexcept
+      : m_front(std::exchange(other.m_front, nullptr)),
+        m_size(std::exchange(other.m_size, 0)) {}
+
+  auto operator=(const PersistentList &other) noexcept -> PersistentList & {
+    if (this != &other) {
+      node_type *front = acquire(other.m_front);
+      release(m_front);
+      m_front = front;
+      m_size = other.m_size;
+    }
+    return *this;
+  }
+
+  auto operator=(PersistentList &&other) noexcept -> PersistentList & {
+    if (this != &other) {
+      release(m_front);
+      m_front = std::exchange(other.m_front, nullptr);
+      m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+  }
+
+  ~PersistentList() noexcept { release(m_front); }
+
+  auto add_front(const T &data) -> void { emplace_front(data); }
+  auto add_front(T &&data) -> void { emplace_front(std::move(data)); }
+
+  template <typename... Args>
+  auto emplace_front(Args &&...args) -> const_reference {
+    // The new node adopts this version's reference to the old front.
+    m_front = new node_type(m_front, std::forward<Args>(args)...);
+    ++m_size;
+    return m_front->data;
+  }
+
+  auto remove_front() -> void {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot remove from empty list");
+    }
+    node_type *front = m_front;
+    m_front = acquire(front->next);
+    --m_size;
+    release(front);
+  }
+
+  /**
+   * @brief O(1) copy of the current version.
+   */
+  [[nodiscard]] auto snapshot() const noexcept -> PersistentList {
+    return PersistentList(*this);
+  }
+
+  /**
+   * @brief The list without its first element, sharing every node.
+   */
+  [[nodiscard]] auto tail() const -> PersistentList {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot take tail of empty list");
+    }
+    PersistentList rest;
+    rest.m_front = acquire(m_front->next);
+    rest.m_size = m_size - 1;
+    return rest;
+  }
+
+  auto clear() noexcept -> void {
+    release(m_front);
+    m_front = nullptr;
+    m_size = 0;
+  }
+
+  auto top() const -> const_reference {
+    if (is_empty()) {
+      throw std::out_of_range("List is empty");
+    }
+    return m_front->data;
+  }
+
+  /**
+   * @brief Whether both lists are the same version, i.e. share their front.
+   */
+  [[nodiscard]] auto shares_with(const PersistentList &other) const noexcept
+      -> bool {
+    return m_front == other.m_front;
+  }
+
+  auto begin() const noexcept -> const_iterator {
+    return const_iterator(m_front);
+  }
+  auto end() const noexcept -> const_iterator { return const_iterator(nullptr); }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+
+  [[nodiscard]] auto size() const noexcept -> size_t { return m_size; }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_size == 0; }
+
+private:
+  static auto acquire(node_type *node) noexcept -> node_type * {
+    if (node != nullptr) {
+      node->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    return node;
+  }
+
+  // Drops one reference and frees the run of nodes it kept alive, iteratively
+  // so long chains cannot overflow the stack.
+  static auto release(node_type *node) noexcept -> void {
+    while (node != nullptr &&
+           node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      node_type *next = node->next;
+      delete node;
+      node = next;
+    }
+  }
+};
+
+#endif // __PERSISTENT_LIST_HPP__
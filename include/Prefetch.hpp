@@ -0,0 +1,26 @@
+#ifndef __PREFETCH_HPP__
+#define __PREFETCH_HPP__
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <xmmintrin.h>
+#endif
+
+namespace details {
+/**
+ * @brief Hints the cache to load the line holding address for a read.
+ *
+ * Compiles to nothing on toolchains without a prefetch intrinsic; never
+ * faults, so it is safe to call on any address, including nullptr.
+ */
+inline auto prefetch(const void *address) noexcept -> void {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER)
+  _mm_prefetch(static_cast<const char *>(address), _MM_HINT_T0);
+#else
+  (void)address;
+#endif
+}
+} // namespace details
+
+#endif // __PREFETCH_HPP__
@@ -0,0 +1,888 @@
+#ifndef __SKIP_LIST_MAP_HPP__
+#define __SKIP_LIST_MAP_HPP__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace details {
+/**
+ * @brief Pool of skip list nodes whose tower of next pointers is stored
+ * inline after the node.
+ *
+ * Blocks are carved from large chunks and recycled through one freelist per
+ * tower height, so a node and its whole tower share one contiguous block
+ * and erase/insert churn does not reach the allocator.
+ *
+ * @tparam Node The node header type, followed in memory by Height links
+ * @tparam Link The type of one tower link
+ * @tparam MaxHeight The tallest tower the pool must serve
+ */
+template <typename Node, typename Link, std::size_t MaxHeight> class TowerPool {
+private:
+  static constexpr std::size_t alignment = alignof(Node) > alignof(Link)
+                                               ? alignof(Node)
+                                               : alignof(Link);
+  static constexpr std::size_t chunk_bytes = 64 * 1024;
+
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  struct Chunk {
+    Chunk *next;
+  };
+
+  static constexpr std::size_t chunk_header =
+      (sizeof(Chunk) + alignment - 1) / alignment * alignment;
+
+  FreeBlock *m_free[MaxHeight + 1]{};
+  Chunk *m_chunks{nullptr};
+  unsigned char *m_cursor{nullptr};
+  std::size_t m_remaining{0};
+
+public:
+  TowerPool() noexcept = default;
+  TowerPool(const TowerPool &) = delete;
+  TowerPool(TowerPool &&other) noexcept { swap(other); }
+  auto operator=(const TowerPool &) -> TowerPool & = delete;
+  auto operator=(TowerPool &&other) noexcept -> TowerPool & {
+    swap(other);
+    return *this;
+  }
+  ~TowerPool() { release(); }
+
+  [[nodiscard]] static constexpr auto block_size(std::size_t height) noexcept
+      -> std::size_t {
+    return (sizeof(Node) + height * sizeof(Link) + alignment - 1) / alignment *
+           alignment;
+  }
+
+  [[nodiscard]] auto allocate(std::size_t height) -> void * {
+    if (FreeBlock *block = m_free[height]) {
+      m_free[height] = block->next;
+      return block;
+    }
+    const std::size_t bytes = block_size(height);
+    if (m_remaining < bytes) {
+      add_chunk();
+    }
+    void *block = m_cursor;
+    m_cursor += bytes;
+    m_remaining -= bytes;
+    return block;
+  }
+
+  auto deallocate(void *block, std::size_t height) noexcept -> void {
+    auto *free_block = static_cast<FreeBlock *>(block);
+    free_block->next = m_free[height];
+    m_free[height] = free_block;
+  }
+
+  // Returns every chunk to the allocator; blocks must hold no live objects.
+  auto release() noexcept -> void {
+    while (m_chunks != nullptr) {
+      Chunk *next = m_chunks->next;
+      ::operator delete(static_cast<void *>(m_chunks),
+                        std::align_val_t{alignment});
+      m_chunks = next;
+    }
+    for (auto &head : m_free) {
+      head = nullptr;
+    }
+    m_cursor = nullptr;
+    m_remaining = 0;
+  }
+
+  auto swap(TowerPool &other) noexcept -> void {
+    using std::swap;
+    swap(m_free, other.m_free);
+    swap(m_chunks, other.m_chunks);
+    swap(m_cursor, other.m_cursor);
+    swap(m_remaining, other.m_remaining);
+  }
+
+private:
+  auto add_chunk() -> void {
+    static_assert(chunk_bytes >= chunk_header + block_size(MaxHeight),
+                  "A chunk must hold the tallest tower");
+    auto *chunk = static_cast<Chunk *>(
+        ::operator new(chunk_bytes, std::align_val_t{alignment}));
+    chunk->next = m_chunks;
+    m_chunks = chunk;
+    m_cursor = reinterpret_cast<unsigned char *>(chunk) + chunk_header;
+    m_remaining = chunk_bytes - chunk_header;
+  }
+};
+
+// Xorshift step used to draw tower heights.
+inline auto next_random(std::uint64_t &state) noexcept -> std::uint64_t {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+// Geometric height with p = 1/4 per extra level, capped at max_height.
+inline auto tower_height(std::uint64_t bits, std::size_t max_height) noexcept
+    -> std::size_t {
+  std::size_t height = 1;
+  while ((bits & 3) == 0 && height < max_height) {
+    ++height;
+    bits >>= 2;
+  }
+  return height;
+}
+} // namespace details
+
+/**
+ * @brief Bidirectional iterator for SkipListMap container
+ *
+ * @tparam MapType The map container type this iterator is for
+ */
+template <typename MapType> class SkipListMap_Iterator {
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename MapType::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = value_type *;
+  using reference = value_type &;
+  using node_pointer = typename MapType::node_pointer;
+
+public:
+  constexpr explicit SkipListMap_Iterator(const MapType *map = nullptr,
+                                          node_pointer node = nullptr) noexcept
+      : m_map(map), m_node(node) {}
+
+  auto operator++() noexcept -> SkipListMap_Iterator & {
+    m_node = m_node->next()[0];
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> SkipListMap_Iterator {
+    SkipListMap_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> SkipListMap_Iterator & {
+    m_node = m_node == nullptr ? m_map->m_tail : m_node->prev;
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> SkipListMap_Iterator {
+    SkipListMap_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference { return m_node->entry; }
+  auto operator->() const noexcept -> pointer {
+    return std::addressof(m_node->entry);
+  }
+
+  auto operator==(const SkipListMap_Iterator &other) const noexcept -> bool {
+    return m_node == other.m_node;
+  }
+
+  auto operator!=(const SkipListMap_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  friend MapType;
+
+  const MapType *m_map;
+  node_pointer m_node;
+};
+
+/**
+ * @brief Const bidirectional iterator for SkipListMap container
+ *
+ * @tparam MapType The map container type this const iterator is for
+ */
+template <typename MapType> class cSkipListMap_Iterator {
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename MapType::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type *;
+  using reference = const value_type &;
+  using node_pointer = typename MapType::node_pointer;
+
+public:
+  constexpr explicit cSkipListMap_Iterator(const MapType *map = nullptr,
+                                           node_pointer node = nullptr) noexcept
+      : m_map(map), m_node(node) {}
+
+  auto operator++() noexcept -> cSkipListMap_Iterator & {
+    m_node = m_node->next()[0];
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> cSkipListMap_Iterator {
+    cSkipListMap_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> cSkipListMap_Iterator & {
+    m_node = m_node == nullptr ? m_map->m_tail : m_node->prev;
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> cSkipListMap_Iterator {
+    cSkipListMap_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference { return m_node->entry; }
+  auto operator->() const noexcept -> pointer {
+    return std::addressof(m_node->entry);
+  }
+
+  auto operator==(const cSkipListMap_Iterator &other) const noexcept -> bool {
+    return m_node == other.m_node;
+  }
+
+  auto operator!=(const cSkipListMap_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  const MapType *m_map;
+  node_pointer m_node;
+};
+
+/**
+ * @brief Ordered map implemented as a skip list
+ *
+ * @tparam Key The key type, ordered by Compare
+ * @tparam Value The mapped type
+ * @tparam Compare Strict weak ordering on keys
+ *
+ * Every node stores its entry, a back link for reverse iteration and a tower
+ * of 1 to MaxHeight forward links. Tower heights are geometric with p = 1/4,
+ * which keeps the expected number of links per node at 4/3, and a node is
+ * allocated together with its tower from a pool so a search touches one
+ * block per visited node.
+ *
+ * Complexity guarantees (expected):
+ * - find(), contains(), at(): O(log n)
+ * - insert(), emplace(), operator[](): O(log n)
+ * - erase(): O(log n)
+ * - lower_bound(), upper_bound(): O(log n)
+ * - scan(lo, hi, visitor): O(log n + k) for k visited entries
+ * - size(), is_empty(): O(1)
+ * - begin(), end(), ++, --: O(1)
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class SkipListMap {
+public:
+  static constexpr std::size_t MaxHeight = 16;
+
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key, Value>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using key_compare = Compare;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = SkipListMap_Iterator<SkipListMap>;
+  using const_iterator = cSkipListMap_Iterator<SkipListMap>;
+
+private:
+  struct Node {
+    value_type entry;
+    Node *prev{nullptr};
+    std::size_t height{1};
+
+    template <typename... Args>
+    explicit Node(std::size_t h, Args &&...args)
+        : entry(std::forward<Args>(args)...), height(h) {}
+
+    [[nodiscard]] auto next() noexcept -> Node ** {
+      return reinterpret_cast<Node **>(reinterpret_cast<unsigned char *>(this) +
+                                       sizeof(Node));
+    }
+  };
+
+public:
+  using node_pointer = Node *;
+
+private:
+  friend iterator;
+  friend const_iterator;
+
+  details::TowerPool<Node, Node *, MaxHeight> m_pool;
+  Node *m_head[MaxHeight]{};
+  Node *m_tail{nullptr};
+  size_type m_height{1};
+  size_type m_size{0};
+  std::uint64_t m_seed{0x9E3779B97F4A7C15ULL};
+  Compare m_compare;
+
+public:
+  SkipListMap() = default;
+
+  explicit SkipListMap(const Compare &compare) : m_compare(compare) {}
+
+  explicit SkipListMap(std::initializer_list<value_type> init) {
+    for (const auto &entry : init) {
+      insert(entry.first, entry.second);
+    }
+  }
+
+  SkipListMap(const SkipListMap &other) : m_compare(other.m_compare) {
+    for (const auto &entry : other) {
+      insert(entry.first, entry.second);
+    }
+  }
+
+  SkipListMap(SkipListMap &&other) noexcept { swap(other); }
+
+  auto operator=(const SkipListMap &other) -> SkipListMap & {
+    if (this != &other) {
+      SkipListMap temp(other);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  auto operator=(SkipListMap &&other) noexcept -> SkipListMap & {
+    swap(other);
+    return *this;
+  }
+
+  ~SkipListMap() { destroy_nodes(); }
+
+  // Lookup
+  [[nodiscard]] auto find(const Key &key) -> iterator {
+    return iterator(this, find_node(key));
+  }
+
+  [[nodiscard]] auto find(const Key &key) const -> const_iterator {
+    return const_iterator(this, find_node(key));
+  }
+
+  [[nodiscard]] auto contains(const Key &key) const -> bool {
+    return find_node(key) != nullptr;
+  }
+
+  [[nodiscard]] auto at(const Key &key) -> Value & {
+    Node *node = find_node(key);
+    if (node == nullptr) {
+      throw std::out_of_range("Key not found in map");
+    }
+    return node->entry.second;
+  }
+
+  [[nodiscard]] auto at(const Key &key) const -> const Value & {
+    const Node *node = find_node(key);
+    if (node == nullptr) {
+      throw std::out_of_range("Key not found in map");
+    }
+    return node->entry.second;
+  }
+
+  auto operator[](const Key &key) -> Value & {
+    return emplace(key).first->second;
+  }
+
+  /**
+   * @brief First entry whose key is not less than key.
+   */
+  [[nodiscard]] auto lower_bound(const Key &key) const -> const_iterator {
+    return const_iterator(this, first_not_less(key));
+  }
+
+  [[nodiscard]] auto lower_bound(const Key &key) -> iterator {
+    return iterator(this, first_not_less(key));
+  }
+
+  /**
+   * @brief First entry whose key is greater than key.
+   */
+  [[nodiscard]] auto upper_bound(const Key &key) const -> const_iterator {
+    return const_iterator(this, first_greater(key));
+  }
+
+  [[nodiscard]] auto upper_bound(const Key &key) -> iterator {
+    return iterator(this, first_greater(key));
+  }
+
+  /**
+   * @brief Visits the entries with keys in [lo, hi) in ascending order.
+   *
+   * @return number of visited entries
+   */
+  template <typename Visitor>
+  auto scan(const Key &lo, const Key &hi, Visitor visit) const -> size_type {
+    size_type count = 0;
+    for (Node *node = first_not_less(lo);
+         node != nullptr && m_compare(node->entry.first, hi);
+         node = node->next()[0]) {
+      visit(node->entry.first, node->entry.second);
+      ++count;
+    }
+    return count;
+  }
+
+  // Modifiers
+  /**
+   * @brief Inserts (key, value) unless key is already present.
+   *
+   * @return iterator to the entry for key and whether it was inserted
+   */
+  auto insert(const Key &key, const Value &value) -> std::pair<iterator, bool> {
+    return emplace(key, value);
+  }
+
+  auto insert(const Key &key, Value &&value) -> std::pair<iterator, bool> {
+    return emplace(key, std::move(value));
+  }
+
+  /**
+   * @brief Inserts or overwrites the value for key.
+   *
+   * @return true if a new entry was inserted
+   */
+  template <typename V> auto insert_or_assign(const Key &key, V &&value) -> bool {
+    auto [it, inserted] = emplace(key, std::forward<V>(value));
+    if (!inserted) {
+      it->second = std::forward<V>(value);
+    }
+    return inserted;
+  }
+
+  /**
+   * @brief Constructs the value for key from args unless key is present.
+   */
+  template <typename... Args>
+  auto emplace(const Key &key, Args &&...args) -> std::pair<iterator, bool> {
+    Node **links[MaxHeight];
+    Node *pred = nullptr;
+    Node *found = find_links(key, links, pred);
+    if (found != nullptr && !m_compare(key, found->entry.first)) {
+      return {iterator(this, found), false};
+    }
+
+    const size_type height =
+        details::tower_height(details::next_random(m_seed), MaxHeight);
+    for (; m_height < height; ++m_height) {
+      links[m_height] = &m_head[m_height];
+    }
+
+    Node *node = create_node(height, std::piecewise_construct,
+                             std::forward_as_tuple(key),
+                             std::forward_as_tuple(std::forward<Args>(args)...));
+    for (size_type level = 0; level < height; ++level) {
+      node->next()[level] = *links[level];
+      *links[level] = node;
+    }
+    node->prev = pred;
+    if (Node *succ = node->next()[0]) {
+      succ->prev = node;
+    } else {
+      m_tail = node;
+    }
+    ++m_size;
+    return {iterator(this, node), true};
+  }
+
+  /**
+   * @brief Removes the entry for key.
+   *
+   * @return number of removed entries (0 or 1)
+   */
+  auto erase(const Key &key) -> size_type {
+    Node **links[MaxHeight];
+    Node *pred = nullptr;
+    Node *target = find_links(key, links, pred);
+    if (target == nullptr || m_compare(key, target->entry.first)) {
+      return 0;
+    }
+    unlink(target, links);
+    return 1;
+  }
+
+  /**
+   * @brief Removes the entry at pos.
+   *
+   * @return iterator following the removed entry
+   * @throws std::out_of_range if pos is end()
+   */
+  auto erase(iterator pos) -> iterator {
+    if (pos.m_node == nullptr) {
+      throw std::out_of_range("Cannot erase end iterator");
+    }
+    Node *next = pos.m_node->next()[0];
+    Node **links[MaxHeight];
+    Node *pred = nullptr;
+    find_links(pos.m_node->entry.first, links, pred);
+    unlink(pos.m_node, links);
+    return iterator(this, next);
+  }
+
+  auto clear() noexcept -> void {
+    destroy_nodes();
+    m_pool.release();
+    for (auto &head : m_head) {
+      head = nullptr;
+    }
+    m_tail = nullptr;
+    m_height = 1;
+    m_size = 0;
+  }
+
+  // Capacity
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_size == 0; }
+
+  // Iterators
+  auto begin() noexcept -> iterator { return iterator(this, m_head[0]); }
+  auto end() noexcept -> iterator { return iterator(this, nullptr); }
+  auto begin() const noexcept -> const_iterator {
+    return const_iterator(this, m_head[0]);
+  }
+  auto end() const noexcept -> const_iterator {
+    return const_iterator(this, nullptr);
+  }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+
+private:
+  // Descends from the top level, recording in links[level] the link that
+  // points at the first node not less than key; pred receives the level-0
+  // predecessor. Returns that first node.
+  auto find_links(const Key &key, Node **links[], Node *&pred) -> Node * {
+    pred = nullptr;
+    for (size_type level = m_height; level-- > 0;) {
+      Node **link = pred == nullptr ? &m_head[level] : &pred->next()[level];
+      while (*link != nullptr && m_compare((*link)->entry.first, key)) {
+        pred = *link;
+        link = &pred->next()[level];
+      }
+      links[level] = link;
+    }
+    return *links[0];
+  }
+
+  auto first_not_less(const Key &key) const -> Node * {
+    Node *pred = nullptr;
+    Node *candidate = nullptr;
+    for (size_type level = m_height; level-- > 0;) {
+      candidate = pred == nullptr ? m_head[level] : pred->next()[level];
+      while (candidate != nullptr && m_compare(candidate->entry.first, key)) {
+        pred = candidate;
+        candidate = pred->next()[level];
+      }
+    }
+    return candidate;
+  }
+
+  auto first_greater(const Key &key) const -> Node * {
+    Node *pred = nullptr;
+    Node *candidate = nullptr;
+    for (size_type level = m_height; level-- > 0;) {
+      candidate = pred == nullptr ? m_head[level] : pred->next()[level];
+      while (candidate != nullptr && !m_compare(key, candidate->entry.first)) {
+        pred = candidate;
+        candidate = pred->next()[level];
+      }
+    }
+    return candidate;
+  }
+
+  auto find_node(const Key &key) const -> Node * {
+    Node *node = first_not_less(key);
+    return node != nullptr && !m_compare(key, node->entry.first) ? node
+                                                                  : nullptr;
+  }
+
+  template <typename... Args>
+  auto create_node(size_type height, Args &&...args) -> Node * {
+    void *block = m_pool.allocate(height);
+    try {
+      return new (block) Node(height, std::forward<Args>(args)...);
+    } catch (...) {
+      m_pool.deallocate(block, height);
+      throw;
+    }
+  }
+
+  auto destroy_node(Node *node) noexcept -> void {
+    const size_type height = node->height;
+    node->~Node();
+    m_pool.deallocate(node, height);
+  }
+
+  // Unlinks target, whose predecessor links at each level are in links.
+  auto unlink(Node *target, Node **links[]) noexcept -> void {
+    for (size_type level = 0; level < target->height; ++level) {
+      *links[level] = target->next()[level];
+    }
+    if (Node *succ = target->next()[0]) {
+      succ->prev = target->prev;
+    } else {
+      m_tail = target->prev;
+    }
+    destroy_node(target);
+    while (m_height > 1 && m_head[m_height - 1] == nullptr) {
+      --m_height;
+    }
+    --m_size;
+  }
+
+  auto destroy_nodes() noexcept -> void {
+    Node *node = m_head[0];
+    while (node != nullptr) {
+      Node *next = node->next()[0];
+      node->~Node();
+      node = next;
+    }
+  }
+
+  auto swap(SkipListMap &other) noexcept -> void {
+    using std::swap;
+    m_pool.swap(other.m_pool);
+    swap(m_head, other.m_head);
+    swap(m_tail, other.m_tail);
+    swap(m_height, other.m_height);
+    swap(m_size, other.m_size);
+    swap(m_seed, other.m_seed);
+    swap(m_compare, other.m_compare);
+  }
+};
+
+/**
+ * @brief Insert-only skip list map for read-mostly indexes shared between
+ * threads
+ *
+ * @tparam Key The key type, ordered by Compare
+ * @tparam Value The mapped type, immutable once inserted
+ * @tparam Compare Strict weak ordering on keys
+ *
+ * insert() links a node bottom-up with compare-and-swap on each level and
+ * never blocks. Readers only follow acquire loads and never retry, because
+ * entries are never removed or modified while the map is shared; a pointer
+ * returned by find() stays valid for the lifetime of the map. Nodes are
+ * allocated with their tower inline and are released by the destructor.
+ *
+ * Complexity guarantees (expected, without contention):
+ * - find(), contains(): O(log n)
+ * - insert(): O(log n)
+ * - scan(lo, hi, visitor): O(log n + k) for k visited entries
+ * - size(): O(1)
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class ConcurrentSkipListMap {
+public:
+  static constexpr std::size_t MaxHeight = 16;
+
+  using key_type = Key;
+  using mapped_type = Value;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+private:
+  struct Node {
+    const Key key;
+    const Value value;
+    std::size_t height;
+
+    template <typename V>
+    Node(std::size_t h, const Key &k, V &&v)
+        : key(k), value(std::forward<V>(v)), height(h) {}
+
+    [[nodiscard]] auto next() noexcept -> std::atomic<Node *> * {
+      return reinterpret_cast<std::atomic<Node *> *>(
+          reinterpret_cast<unsigned char *>(this) + sizeof(Node));
+    }
+  };
+
+  static constexpr std::size_t alignment =
+      alignof(Node) > alignof(std::atomic<Node *>) ? alignof(Node)
+                                                   : alignof(std::atomic<Node *>);
+
+  std::atomic<Node *> m_head[MaxHeight]{};
+  std::atomic<size_type> m_size{0};
+  Compare m_compare;
+
+public:
+  ConcurrentSkipListMap() = default;
+  explicit ConcurrentSkipListMap(const Compare &compare)
+      : m_compare(compare) {}
+
+  ConcurrentSkipListMap(const ConcurrentSkipListMap &) = delete;
+  ConcurrentSkipListMap(ConcurrentSkipListMap &&) = delete;
+  auto operator=(const ConcurrentSkipListMap &)
+      -> ConcurrentSkipListMap & = delete;
+  auto operator=(ConcurrentSkipListMap &&) -> ConcurrentSkipListMap & = delete;
+
+  ~ConcurrentSkipListMap() {
+    Node *node = m_head[0].load(std::memory_order_relaxed);
+    while (node != nullptr) {
+      Node *next = node->next()[0].load(std::memory_order_relaxed);
+      destroy_node(node);
+      node = next;
+    }
+  }
+
+  /**
+   * @brief Inserts (key, value) unless key is already present. Safe to call
+   * concurrently with other inserts and lookups.
+   *
+   * @return true if the entry was inserted
+   */
+  template <typename V> auto insert(const Key &key, V &&value) -> bool {
+    std::atomic<Node *> *links[MaxHeight];
+    Node *succs[MaxHeight];
+    if (find_links(key, links, succs)) {
+      return false;
+    }
+
+    thread_local std::uint64_t seed =
+        0x9E3779B97F4A7C15ULL ^ reinterpret_cast<std::uintptr_t>(&seed);
+    const size_type height =
+        details::tower_height(details::next_random(seed), MaxHeight);
+    Node *node = create_node(height, key, std::forward<V>(value));
+
+    while (true) {
+      for (size_type level = 0; level < height; ++level) {
+        node->next()[level].store(succs[level], std::memory_order_relaxed);
+      }
+      Node *expected = succs[0];
+      if (links[0]->compare_exchange_strong(expected, node,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+        break;
+      }
+      if (find_links(key, links, succs)) {
+        destroy_node(node);
+        return false;
+      }
+    }
+
+    // The node is now visible; publish it on the upper levels.
+    for (size_type level = 1; level < height; ++level) {
+      while (true) {
+        Node *expected = succs[level];
+        if (links[level]->compare_exchange_strong(expected, node,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed)) {
+          break;
+        }
+        find_links(key, links, succs);
+        node->next()[level].store(succs[level], std::memory_order_relaxed);
+      }
+    }
+    m_size.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /**
+   * @return pointer to the value for key, nullptr if absent
+   */
+  [[nodiscard]] auto find(const Key &key) const -> const Value * {
+    const Node *node = first_not_less(key);
+    return node != nullptr && !m_compare(key, node->key) ? &node->value
+                                                         : nullptr;
+  }
+
+  [[nodiscard]] auto contains(const Key &key) const -> bool {
+    return find(key) != nullptr;
+  }
+
+  /**
+   * @brief Visits the entries with keys in [lo, hi) in ascending order.
+   * Entries inserted concurrently may or may not be visited.
+   *
+   * @return number of visited entries
+   */
+  template <typename Visitor>
+  auto scan(const Key &lo, const Key &hi, Visitor visit) const -> size_type {
+    size_type count = 0;
+    for (Node *node = first_not_less(lo);
+         node != nullptr && m_compare(node->key, hi);
+         node = node->next()[0].load(std::memory_order_acquire)) {
+      visit(node->key, node->value);
+      ++count;
+    }
+    return count;
+  }
+
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return m_size.load(std::memory_order_relaxed);
+  }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return size() == 0; }
+
+private:
+  // Records at every level the link to the first node not less than key
+  // and that node; returns whether key is present.
+  auto find_links(const Key &key, std::atomic<Node *> *links[],
+                  Node *succs[]) -> bool {
+    Node *pred = nullptr;
+    for (size_type level = MaxHeight; level-- > 0;) {
+      std::atomic<Node *> *link =
+          pred == nullptr ? &m_head[level] : &pred->next()[level];
+      Node *curr = link->load(std::memory_order_acquire);
+      while (curr != nullptr && m_compare(curr->key, key)) {
+        pred = curr;
+        link = &curr->next()[level];
+        curr = link->load(std::memory_order_acquire);
+      }
+      links[level] = link;
+      succs[level] = curr;
+    }
+    return succs[0] != nullptr && !m_compare(key, succs[0]->key);
+  }
+
+  auto first_not_less(const Key &key) const -> Node * {
+    Node *pred = nullptr;
+    Node *curr = nullptr;
+    for (size_type level = MaxHeight; level-- > 0;) {
+      curr = (pred == nullptr ? m_head[level] : pred->next()[level])
+                 .load(std::memory_order_acquire);
+      while (curr != nullptr && m_compare(curr->key, key)) {
+        pred = curr;
+        curr = pred->next()[level].load(std::memory_order_acquire);
+      }
+    }
+    return curr;
+  }
+
+  template <typename V>
+  static auto create_node(size_type height, const Key &key, V &&value)
+      -> Node * {
+    const size_type bytes = sizeof(Node) + height * sizeof(std::atomic<Node *>);
+    void *block = ::operator new(bytes, std::align_val_t{alignment});
+    Node *node = nullptr;
+    try {
+      node = new (block) Node(height, key, std::forward<V>(value));
+    } catch (...) {
+      ::operator delete(block, std::align_val_t{alignment});
+      throw;
+    }
+    for (size_type level = 0; level < height; ++level) {
+      new (&node->next()[level]) std::atomic<Node *>(nullptr);
+    }
+    return node;
+  }
+
+  static auto destroy_node(Node *node) noexcept -> void {
+    node->~Node();
+    ::operator delete(static_cast<void *>(node), std::align_val_t{alignment});
+  }
+};
+
+#endif // __SKIP_LIST_MAP_HPP__
@@ -0,0 +1,453 @@
+#ifndef __SMALL_VECTOR_HPP__
+#define __SMALL_VECTOR_HPP__
+
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Vector that stores up to InlineCapacity elements inside the object
+ * and only allocates when it grows beyond them
+ *
+ * @tparam ValueType The type of elements stored in the vector
+ * @tparam InlineCapacity Number of elements kept in the inline buffer, > 0
+ * @tparam Growth Policy with static next_capacity(capacity, required)
+ *
+ * Moving a spilled vector steals its heap buffer. Moving an inline vector
+ * relocates its elements, which is a memcpy of at most InlineCapacity
+ * elements for trivially relocatable types.
+ *
+ * Complexity guarantees:
+ * - operator[], front(), back(): O(1)
+ * - push_back(), emplace_back(): O(1) amortized, no allocation while
+ *   size() <= InlineCapacity
+ * - pop_back(): O(1)
+ * - erase(): O(n)
+ * - reserve(), shrink_to_fit(): O(n)
+ * - size(), capacity(), empty(), is_inline(): O(1)
+ * - begin(), end(): O(1)
+ */
+template <typename ValueType, size_t InlineCapacity,
+          typename Growth = DoublingGrowth>
+class SmallVector {
+public:
+  using value_type = ValueType;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using iterator = Vector_Iterator<SmallVector>;
+  using const_iterator = cVector_Iterator<SmallVector>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+  static_assert(InlineCapacity > 0, "Inline capacity must be greater than 0");
+  static_assert(alignof(ValueType) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                "Over-aligned element types are not supported");
+
+private:
+  pointer m_data;
+  size_type m_size{0};
+  size_type m_capacity{InlineCapacity};
+  alignas(value_type) unsigned char m_inline[InlineCapacity *
+                                             sizeof(value_type)];
+
+public:
+  // Constructors
+  SmallVector() noexcept : m_data(inline_data()) {}
+
+  SmallVector(std::initializer_list<value_type> init_list) : SmallVector() {
+    reserve(init_list.size());
+    for (const auto &value : init_list) {
+      emplace_back(value);
+    }
+  }
+
+  SmallVector(const SmallVector &other) : SmallVector() {
+    reserve(other.m_size);
+    for (const auto &value : other) {
+      emplace_back(value);
+    }
+  }
+
+  SmallVector(SmallVector &&other) noexcept(
+      is_trivially_relocatable_v<value_type> ||
+      std::is_nothrow_move_constructible_v<value_type>)
+      : SmallVector() {
+    take(other);
+  }
+
+  auto operator=(const SmallVector &other) -> SmallVector & {
+    if (this != &other) {
+      clear();
+      reserve(other.m_size);
+      for (const auto &value : other) {
+        emplace_back(value);
+      }
+    }
+    return *this;
+  }
+
+  auto operator=(SmallVector &&other) noexcept(
+      is_trivially_relocatable_v<value_type> ||
+      std::is_nothrow_move_constructible_v<value_type>) -> SmallVector & {
+    if (this != &other) {
+      reset();
+      take(other);
+    }
+    return *this;
+  }
+
+  ~SmallVector() { reset(); }
+
+  // Element access
+  [[nodiscard]] auto operator[](size_type idx) -> reference {
+    if (idx >= m_size) {
+      throw std::out_of_range("SmallVector index out of bounds");
+    }
+    return m_data[idx];
+  }
+
+  [[nodiscard]] auto operator[](size_type idx) const -> const_reference {
+    if (idx >= m_size) {
+      throw std::out_of_range("SmallVector index out of bounds");
+    }
+    return m_data[idx];
+  }
+
+  [[nodiscard]] auto front() -> reference {
+    if (empty()) {
+      throw std::out_of_range("Cannot access front of empty vector");
+    }
+    return m_data[0];
+  }
+
+  [[nodiscard]] auto front() const -> const_reference {
+    if (empty()) {
+      throw std::out_of_range("Cannot access front of empty vector");
+    }
+    return m_data[0];
+  }
+
+  [[nodiscard]] auto back() -> reference {
+    if (empty()) {
+      throw std::out_of_range("Cannot access back of empty vector");
+    }
+    return m_data[m_size - 1];
+  }
+
+  [[nodiscard]] auto back() const -> const_reference {
+    if (empty()) {
+      throw std::out_of_range("Cannot access back of empty vector");
+    }
+    return m_data[m_size - 1];
+  }
+
+  [[nodiscard]] auto data() noexcept -> pointer { return m_data; }
+  [[nodiscard]] auto data() const noexcept -> const_pointer { return m_data; }
+
+  // Capacity
+  [[nodiscard]] auto empty() const noexcept -> bool { return m_size == 0; }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return empty(); }
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return m_capacity;
+  }
+  [[nodiscard]] static constexpr auto inline_capacity() noexcept -> size_type {
+    return InlineCapacity;
+  }
+
+  /**
+   * @brief Whether the elements live in the inline buffer.
+   */
+  [[nodiscard]] auto is_inline() const noexcept -> bool {
+    return m_data == inline_data();
+  }
+
+  auto reserve(size_type new_capacity) -> void {
+    if (new_capacity > m_capacity) {
+      move_to(allocate(new_capacity), new_capacity);
+    }
+  }
+
+  /**
+   * @brief Releases unused heap capacity, moving the elements back inline
+   * when they fit.
+   */
+  auto shrink_to_fit() -> void {
+    if (is_inline() || m_capacity == m_size) {
+      return;
+    }
+    if (m_size <= InlineCapacity) {
+      move_to(inline_data(), InlineCapacity);
+    } else {
+      move_to(allocate(m_size), m_size);
+    }
+  }
+
+  // Modifiers
+  auto push_back(const value_type &value) -> void { emplace_back(value); }
+  auto push_back(value_type &&value) -> void { emplace_back(std::move(value)); }
+
+  template <typename... Args> auto emplace_back(Args &&...args) -> reference {
+    if (m_size == m_capacity) {
+      return emplace_back_grow(std::forward<Args>(args)...);
+    }
+    ::new (static_cast<void *>(m_data + m_size))
+        value_type(std::forward<Args>(args)...);
+    return m_data[m_size++];
+  }
+
+  auto pop_back() -> void {
+    if (empty()) {
+      throw std::out_of_range("Cannot pop from empty vector");
+    }
+    std::destroy_at(m_data + --m_size);
+  }
+
+  /**
+   * @return iterator following the removed element
+   * @throws std::out_of_range if pos is end()
+   */
+  auto erase(iterator pos) -> iterator {
+    if (pos == end()) {
+      throw std::out_of_range("Cannot erase end iterator");
+    }
+    return erase(pos, pos + 1);
+  }
+
+  auto erase(iterator first, iterator last) -> iterator {
+    if (first != last) {
+      pointer new_end = std::move(last.m_ptr, m_data + m_size, first.m_ptr);
+      std::destroy(new_end, m_data + m_size);
+      m_size = static_cast<size_type>(new_end - m_data);
+    }
+    return first;
+  }
+
+  auto clear() noexcept -> void {
+    std::destroy(m_data, m_data + m_size);
+    m_size = 0;
+  }
+
+  // Iterators
+  [[nodiscard]] auto begin() noexcept -> iterator { return iterator(m_data); }
+  [[nodiscard]] auto end() noexcept -> iterator {
+    return iterator(m_data + m_size);
+  }
+  [[nodiscard]] auto begin() const noexcept -> const_iterator {
+    return const_iterator(m_data);
+  }
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return const_iterator(m_data + m_size);
+  }
+  [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+    return begin();
+  }
+  [[nodiscard]] auto cend() const noexcept -> const_iterator { return end(); }
+
+private:
+  auto inline_data() noexcept -> pointer {
+    return reinterpret_cast<pointer>(m_inline);
+  }
+
+  auto inline_data() const noexcept -> const_pointer {
+    return reinterpret_cast<const_pointer>(m_inline);
+  }
+
+  static auto allocate(size_type count) -> pointer {
+    if (count > std::numeric_limits<size_type>::max() / sizeof(value_type)) {
+      throw std::length_error("SmallVector capacity exceeds maximum size");
+    }
+    return static_cast<pointer>(::operator new(count * sizeof(value_type)));
+  }
+
+  auto release_heap() noexcept -> void {
+    if (!is_inline()) {
+      ::operator delete(static_cast<void *>(m_data));
+    }
+  }
+
+  // Destroys the elements and returns to the empty inline state.
+  auto reset() noexcept -> void {
+    clear();
+    release_heap();
+    m_data = inline_data();
+    m_capacity = InlineCapacity;
+  }
+
+  // Takes the elements of other, which must be distinct from this empty,
+  // inline vector; other is left empty and inline.
+  auto take(SmallVector &other) -> void {
+    if (other.is_inline()) {
+      details::relocate_into(other.m_data, other.m_size, m_data);
+      details::release_relocated(other.m_data, other.m_data + other.m_size);
+    } else {
+      m_data = std::exchange(other.m_data, other.inline_data());
+      m_capacity = std::exchange(other.m_capacity, InlineCapacity);
+    }
+    m_size = std::exchange(other.m_size, 0);
+  }
+
+  // Relocates the elements into buffer, which holds new_capacity elements
+  // and is either fresh heap storage or the inline buffer.
+  auto move_to(pointer buffer, size_type new_capacity) -> void {
+    try {
+      details::relocate_into(m_data, m_size, buffer);
+    } catch (...) {
+      if (buffer != inline_data()) {
+        ::operator delete(static_cast<void *>(buffer));
+      }
+      throw;
+    }
+    details::release_relocated(m_data, m_data + m_size);
+    release_heap();
+    m_data = buffer;
+    m_capacity = new_capacity;
+  }
+
+  template <typename... Args>
+  auto emplace_back_grow(Args &&...args) -> reference {
+    const size_type new_capacity = Growth::next_capacity(m_capacity, m_size + 1);
+    pointer buffer = allocate(new_capacity);
+    // Construct first: args may refer to an element of the old buffer.
+    try {
+      ::new (static_cast<void *>(buffer + m_size))
+          value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      ::operator delete(static_cast<void *>(buffer));
+      throw;
+    }
+    try {
+      details::relocate_into(m_data, m_size, buffer);
+    } catch (...) {
+      std::destroy_at(buffer + m_size);
+      ::operator delete(static_cast<void *>(buffer));
+      throw;
+    }
+    details::release_relocated(m_data, m_data + m_size);
+    release_heap();
+    m_data = buffer;
+    m_capacity = new_capacity;
+    return m_data[m_size++];
+  }
+};
+
+/**
+ * @brief Stack adapter over SmallVector that never runs out of room
+ *
+ * @tparam ValueType The type of elements stored in the stack
+ * @tparam InlineCapacity Elements kept inside the object before the stack
+ * spills to the heap
+ *
+ * Offers the ArrayStack interface without a fixed size: the common shallow
+ * stack costs no allocation, and a deep one grows instead of throwing.
+ *
+ * Complexity guarantees:
+ * - push(), emplace(): O(1) amortized
+ * - pop(), top(): O(1)
+ * - size(), empty(): O(1)
+ * - begin(), end(): O(1)
+ *
+ * @example
+ * GrowableStack<int, 4> stack;
+ * for (int i = 0; i < 100; ++i) {
+ *   stack.push(i);
+ * }
+ * assert(stack.top() == 99);
+ */
+template <typename ValueType, size_t InlineCapacity = 16>
+class GrowableStack {
+public:
+  using container_type = SmallVector<ValueType, InlineCapacity>;
+  using value_type = ValueType;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename container_type::iterator;
+  using const_iterator = typename container_type::const_iterator;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+
+private:
+  container_type m_data;
+
+public:
+  GrowableStack() = default;
+
+  GrowableStack(std::initializer_list<value_type> init_list)
+      : m_data(init_list) {}
+
+  // Element access
+  [[nodiscard]] auto top() const -> const_reference {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot access top of empty stack");
+    }
+    return m_data.back();
+  }
+
+  [[nodiscard]] auto top() -> reference {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot access top of empty stack");
+    }
+    return m_data.back();
+  }
+
+  // Modifiers
+  auto push(const value_type &value) -> void { m_data.push_back(value); }
+  auto push(value_type &&value) -> void { m_data.push_back(std::move(value)); }
+
+  template <typename... Args> auto emplace(Args &&...args) -> void {
+    m_data.emplace_back(std::forward<Args>(args)...);
+  }
+
+  auto pop() -> void {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot pop from empty stack");
+    }
+    m_data.pop_back();
+  }
+
+  auto clear() noexcept -> void { m_data.clear(); }
+  auto reserve(size_type new_capacity) -> void { m_data.reserve(new_capacity); }
+  auto shrink_to_fit() -> void { m_data.shrink_to_fit(); }
+
+  // Capacity
+  [[nodiscard]] auto empty() const noexcept -> bool { return m_data.empty(); }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return empty(); }
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return m_data.size();
+  }
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return m_data.capacity();
+  }
+  [[nodiscard]] auto is_inline() const noexcept -> bool {
+    return m_data.is_inline();
+  }
+
+  // Iterators, bottom to top
+  [[nodiscard]] auto begin() noexcept -> iterator { return m_data.begin(); }
+  [[nodiscard]] auto end() noexcept -> iterator { return m_data.end(); }
+  [[nodiscard]] auto begin() const noexcept -> const_iterator {
+    return m_data.begin();
+  }
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return m_data.end();
+  }
+  [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+    return m_data.cbegin();
+  }
+  [[nodiscard]] auto cend() const noexcept -> const_iterator {
+    return m_data.cend();
+  }
+};
+
+#endif // __SMALL_VECTOR_HPP__
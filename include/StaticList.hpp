@@ -0,0 +1,479 @@
+#ifndef __STATIC_LIST_HPP__
+#define __STATIC_LIST_HPP__
+
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Bidirectional iterator for StaticList container
+ *
+ * @tparam ListType The list container type this iterator is for
+ */
+template <typename ListType> class StaticList_Iterator {
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename ListType::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = value_type *;
+  using reference = value_type &;
+  using index_type = typename ListType::index_type;
+
+public:
+  constexpr explicit StaticList_Iterator(ListType *list = nullptr,
+                                         index_type index = ListType::npos)
+      noexcept
+      : m_list(list), m_index(index) {}
+
+  auto operator++() noexcept -> StaticList_Iterator & {
+    m_index = m_list->m_nodes[m_index].next;
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> StaticList_Iterator {
+    StaticList_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> StaticList_Iterator & {
+    m_index = m_index == ListType::npos ? m_list->m_back
+                                        : m_list->m_nodes[m_index].prev;
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> StaticList_Iterator {
+    StaticList_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference {
+    return m_list->m_nodes[m_index].value();
+  }
+
+  auto operator->() const noexcept -> pointer {
+    return std::addressof(m_list->m_nodes[m_index].value());
+  }
+
+  auto operator==(const StaticList_Iterator &other) const noexcept -> bool {
+    return m_index == other.m_index;
+  }
+
+  auto operator!=(const StaticList_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  friend ListType;
+
+  ListType *m_list;
+  index_type m_index;
+};
+
+/**
+ * @brief Const bidirectional iterator for StaticList container
+ *
+ * @tparam ListType The list container type this const iterator is for
+ */
+template <typename ListType> class cStaticList_Iterator {
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename ListType::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type *;
+  using reference = const value_type &;
+  using index_type = typename ListType::index_type;
+
+public:
+  constexpr explicit cStaticList_Iterator(const ListType *list = nullptr,
+                                          index_type index = ListType::npos)
+      noexcept
+      : m_list(list), m_index(index) {}
+
+  auto operator++() noexcept -> cStaticList_Iterator & {
+    m_index = m_list->m_nodes[m_index].next;
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> cStaticList_Iterator {
+    cStaticList_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> cStaticList_Iterator & {
+    m_index = m_index == ListType::npos ? m_list->m_back
+                                        : m_list->m_nodes[m_index].prev;
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> cStaticList_Iterator {
+    cStaticList_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference {
+    return m_list->m_nodes[m_index].value();
+  }
+
+  auto operator->() const noexcept -> pointer {
+    return std::addressof(m_list->m_nodes[m_index].value());
+  }
+
+  auto operator==(const cStaticList_Iterator &other) const noexcept -> bool {
+    return m_index == other.m_index;
+  }
+
+  auto operator!=(const cStaticList_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  const ListType *m_list;
+  index_type m_index;
+};
+
+/**
+ * @brief Fixed-capacity doubly linked list that never allocates
+ *
+ * @tparam ValueType The type of elements stored in the list
+ * @tparam Capacity The maximum number of elements, must be > 0
+ *
+ * Nodes live in an array inside the list object and are linked by indices
+ * sized to the capacity; unused nodes are kept on a free-index stack and
+ * hold no element, which is constructed in place on insertion. No
+ * operation calls the allocator, so the list is usable where new is
+ * forbidden. Inserting into a full list throws std::length_error, like
+ * ArrayStack, while the try_ variants report exhaustion by returning false.
+ *
+ * Complexity guarantees:
+ * - add(), add_front(), add_back(): O(1)
+ * - try_add_front(), try_add_back(): O(1)
+ * - emplace_front(), emplace_back(), emplace(), insert(): O(1)
+ * - erase(), remove_front(), remove_back(): O(1)
+ * - splice(): O(1)
+ * - top(), bottom(), size(), empty(), full(): O(1)
+ * - clear(): O(n)
+ *
+ * @example
+ * StaticList<int, 4> list;
+ * list.add_back(1);
+ * list.add_front(0);
+ * assert(list.try_add_back(2));
+ */
+template <typename ValueType, std::size_t Capacity,
+          typename = std::enable_if_t<(Capacity > 0)>>
+class StaticList {
+public:
+  using value_type = ValueType;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using index_type =
+      std::conditional_t<(Capacity < UINT16_MAX), std::uint16_t,
+                         std::uint32_t>;
+  using iterator = StaticList_Iterator<StaticList>;
+  using const_iterator = cStaticList_Iterator<StaticList>;
+
+  static_assert(Capacity < UINT32_MAX, "Capacity must fit a 32-bit index");
+
+  static constexpr index_type npos = static_cast<index_type>(Capacity);
+
+private:
+  friend iterator;
+  friend const_iterator;
+
+  // The element lives in raw storage and exists only while the node is
+  // linked into the list.
+  struct Node {
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+    index_type next;
+    index_type prev;
+
+    auto value() noexcept -> value_type & {
+      return *std::launder(reinterpret_cast<value_type *>(storage));
+    }
+    auto value() const noexcept -> const value_type & {
+      return *std::launder(reinterpret_cast<const value_type *>(storage));
+    }
+  };
+
+  Node m_nodes[Capacity];
+  index_type m_free[Capacity]{};
+  index_type m_free_top{0};
+  index_type m_front{npos};
+  index_type m_back{npos};
+
+public:
+  StaticList() noexcept { reset_free_stack(); }
+
+  explicit StaticList(std::initializer_list<value_type> init) {
+    if (init.size() > Capacity) {
+      throw std::length_error("Initializer list size exceeds list capacity");
+    }
+    reset_free_stack();
+    for (const auto &value : init) {
+      add_back(value);
+    }
+  }
+
+  StaticList(const StaticList &other) : StaticList() {
+    for (const auto &value : other) {
+      add_back(value);
+    }
+  }
+
+  StaticList(StaticList &&other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>)
+      : StaticList() {
+    for (auto &value : other) {
+      emplace_back(std::move(value));
+    }
+    other.clear();
+  }
+
+  auto operator=(const StaticList &other) -> StaticList & {
+    if (this != &other) {
+      clear();
+      for (const auto &value : other) {
+        add_back(value);
+      }
+    }
+    return *this;
+  }
+
+  auto operator=(StaticList &&other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) -> StaticList & {
+    if (this != &other) {
+      clear();
+      for (auto &value : other) {
+        emplace_back(std::move(value));
+      }
+      other.clear();
+    }
+    return *this;
+  }
+
+  ~StaticList() { clear(); }
+
+  // Element access
+  [[nodiscard]] auto top() const -> const_reference {
+    if (empty()) {
+      throw std::out_of_range("Cannot access top of empty list");
+    }
+    return m_nodes[m_front].value();
+  }
+
+  [[nodiscard]] auto bottom() const -> const_reference {
+    if (empty()) {
+      throw std::out_of_range("Cannot access bottom of empty list");
+    }
+    return m_nodes[m_back].value();
+  }
+
+  // Modifiers
+  auto add(const value_type &data) -> void { emplace_back(data); }
+  auto add(value_type &&data) -> void { emplace_back(std::move(data)); }
+  auto add_front(const value_type &data) -> void { emplace_front(data); }
+  auto add_front(value_type &&data) -> void { emplace_front(std::move(data)); }
+  auto add_back(const value_type &data) -> void { emplace_back(data); }
+  auto add_back(value_type &&data) -> void { emplace_back(std::move(data)); }
+
+  /**
+   * @brief Adds data at the front unless the list is full.
+   *
+   * @return false if the list is full
+   */
+  auto try_add_front(value_type data) -> bool {
+    if (full()) {
+      return false;
+    }
+    emplace_front(std::move(data));
+    return true;
+  }
+
+  /**
+   * @brief Adds data at the back unless the list is full.
+   *
+   * @return false if the list is full
+   */
+  auto try_add_back(value_type data) -> bool {
+    if (full()) {
+      return false;
+    }
+    emplace_back(std::move(data));
+    return true;
+  }
+
+  template <typename... Args> auto emplace_front(Args &&...args) -> reference {
+    return *emplace(begin(), std::forward<Args>(args)...);
+  }
+
+  template <typename... Args> auto emplace_back(Args &&...args) -> reference {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+
+  auto insert(iterator pos, const value_type &value) -> iterator {
+    return emplace(pos, value);
+  }
+
+  auto insert(iterator pos, value_type &&value) -> iterator {
+    return emplace(pos, std::move(value));
+  }
+
+  /**
+   * @brief Constructs an element in front of pos.
+   *
+   * @return iterator to the constructed element
+   * @throws std::length_error if the list is full
+   */
+  template <typename... Args>
+  auto emplace(iterator pos, Args &&...args) -> iterator {
+    if (full()) {
+      throw std::length_error("Cannot add to full list");
+    }
+    const index_type index = m_free[m_free_top - 1];
+    ::new (static_cast<void *>(m_nodes[index].storage))
+        value_type(std::forward<Args>(args)...);
+    --m_free_top;
+    link_before(pos.m_index, index);
+    return iterator(this, index);
+  }
+
+  /**
+   * @brief Unlinks the element at pos and returns its node to the free
+   * stack.
+   *
+   * @return iterator following the erased element
+   * @throws std::out_of_range if pos is end()
+   */
+  auto erase(iterator pos) -> iterator {
+    const index_type index = pos.m_index;
+    if (index == npos) {
+      throw std::out_of_range("Cannot erase end iterator");
+    }
+    const index_type next = m_nodes[index].next;
+    unlink(index);
+    std::destroy_at(std::addressof(m_nodes[index].value()));
+    m_free[m_free_top++] = index;
+    return iterator(this, next);
+  }
+
+  auto remove_front() -> void {
+    if (empty()) {
+      throw std::out_of_range("Cannot remove from empty list");
+    }
+    erase(begin());
+  }
+
+  auto remove_back() -> void {
+    if (empty()) {
+      throw std::out_of_range("Cannot remove from empty list");
+    }
+    erase(iterator(this, m_back));
+  }
+
+  /**
+   * @brief Relinks the element at it in front of pos without moving it.
+   */
+  auto splice(iterator pos, iterator it) noexcept -> void {
+    if (it.m_index == pos.m_index || m_nodes[it.m_index].next == pos.m_index) {
+      return;
+    }
+    unlink(it.m_index);
+    link_before(pos.m_index, it.m_index);
+  }
+
+  auto clear() noexcept -> void {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (index_type i = m_front; i != npos; i = m_nodes[i].next) {
+        std::destroy_at(std::addressof(m_nodes[i].value()));
+      }
+    }
+    m_front = m_back = npos;
+    reset_free_stack();
+  }
+
+  // Capacity
+  [[nodiscard]] auto empty() const noexcept -> bool {
+    return m_free_top == Capacity;
+  }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return empty(); }
+  [[nodiscard]] auto full() const noexcept -> bool { return m_free_top == 0; }
+  [[nodiscard]] auto is_full() const noexcept -> bool { return full(); }
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return Capacity - m_free_top;
+  }
+  [[nodiscard]] constexpr auto capacity() const noexcept -> size_type {
+    return Capacity;
+  }
+  [[nodiscard]] constexpr auto max_size() const noexcept -> size_type {
+    return Capacity;
+  }
+
+  // Iterators
+  [[nodiscard]] auto begin() noexcept -> iterator {
+    return iterator(this, m_front);
+  }
+  [[nodiscard]] auto end() noexcept -> iterator { return iterator(this, npos); }
+  [[nodiscard]] auto begin() const noexcept -> const_iterator {
+    return const_iterator(this, m_front);
+  }
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return const_iterator(this, npos);
+  }
+  [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+    return begin();
+  }
+  [[nodiscard]] auto cend() const noexcept -> const_iterator { return end(); }
+
+private:
+  // Pops in ascending index order so a fresh list fills the array in order.
+  auto reset_free_stack() noexcept -> void {
+    for (size_type i = 0; i < Capacity; ++i) {
+      m_free[i] = static_cast<index_type>(Capacity - 1 - i);
+    }
+    m_free_top = static_cast<index_type>(Capacity);
+  }
+
+  auto link_before(index_type next, index_type index) noexcept -> void {
+    const index_type prev = next == npos ? m_back : m_nodes[next].prev;
+    m_nodes[index].next = next;
+    m_nodes[index].prev = prev;
+    if (prev == npos) {
+      m_front = index;
+    } else {
+      m_nodes[prev].next = index;
+    }
+    if (next == npos) {
+      m_back = index;
+    } else {
+      m_nodes[next].prev = index;
+    }
+  }
+
+  auto unlink(index_type index) noexcept -> void {
+    const index_type next = m_nodes[index].next;
+    const index_type prev = m_nodes[index].prev;
+    if (prev == npos) {
+      m_front = next;
+    } else {
+      m_nodes[prev].next = next;
+    }
+    if (next == npos) {
+      m_back = prev;
+    } else {
+      m_nodes[next].prev = prev;
+    }
+  }
+};
+
+#endif // __STATIC_LIST_HPP__
@@ -0,0 +1,517 @@
+#ifndef __TREE_HEAP_HPP__
+#define __TREE_HEAP_HPP__
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace details {
+// Fixed-size block pool carved from 64KB chunks. A pool can absorb another
+// one in O(1), taking over its chunks and free blocks, which is what lets
+// two heaps meld without copying nodes.
+template <typename Node> class NodePool {
+private:
+  static constexpr std::size_t alignment = alignof(Node) > alignof(void *)
+                                               ? alignof(Node)
+                                               : alignof(void *);
+  static constexpr std::size_t block_bytes =
+      (sizeof(Node) + alignment - 1) / alignment * alignment;
+  static constexpr std::size_t chunk_bytes = 64 * 1024;
+
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  struct Chunk {
+    Chunk *next;
+  };
+
+  static constexpr std::size_t chunk_header =
+      (sizeof(Chunk) + alignment - 1) / alignment * alignment;
+
+  static_assert(chunk_bytes >= chunk_header + block_bytes,
+                "A chunk must hold at least one node");
+
+  FreeBlock *m_free{nullptr};
+  FreeBlock *m_free_tail{nullptr};
+  Chunk *m_chunks{nullptr};
+  Chunk *m_chunks_tail{nullptr};
+  unsigned char *m_cursor{nullptr};
+  std::size_t m_remaining{0};
+
+public:
+  NodePool() noexcept = default;
+  NodePool(const NodePool &) = delete;
+  NodePool(NodePool &&other) noexcept { swap(other); }
+  auto operator=(const NodePool &) -> NodePool & = delete;
+  auto operator=(NodePool &&other) noexcept -> NodePool & {
+    swap(other);
+    return *this;
+  }
+  ~NodePool() { release(); }
+
+  [[nodiscard]] auto allocate() -> void * {
+    if (FreeBlock *block = m_free) {
+      m_free = block->next;
+      if (m_free == nullptr) {
+        m_free_tail = nullptr;
+      }
+      return block;
+    }
+    if (m_remaining < block_bytes) {
+      add_chunk();
+    }
+    void *block = m_cursor;
+    m_cursor += block_bytes;
+    m_remaining -= block_bytes;
+    return block;
+  }
+
+  auto deallocate(void *block) noexcept -> void {
+    auto *free_block = static_cast<FreeBlock *>(block);
+    free_block->next = m_free;
+    m_free = free_block;
+    if (m_free_tail == nullptr) {
+      m_free_tail = free_block;
+    }
+  }
+
+  // Takes ownership of every chunk and free block of other. The unused tail
+  // of other's current chunk stays reserved until release().
+  auto absorb(NodePool &other) noexcept -> void {
+    if (other.m_chunks == nullptr) {
+      return;
+    }
+    if (other.m_free != nullptr) {
+      other.m_free_tail->next = m_free;
+      if (m_free == nullptr) {
+        m_free_tail = other.m_free_tail;
+      }
+      m_free = other.m_free;
+    }
+    other.m_chunks_tail->next = m_chunks;
+    if (m_chunks == nullptr) {
+      m_chunks_tail = other.m_chunks_tail;
+    }
+    m_chunks = other.m_chunks;
+    if (m_remaining < other.m_remaining) {
+      m_cursor = other.m_cursor;
+      m_remaining = other.m_remaining;
+    }
+    other.forget();
+  }
+
+  // Returns every chunk to the allocator; blocks must hold no live objects.
+  auto release() noexcept -> void {
+    while (m_chunks != nullptr) {
+      Chunk *next = m_chunks->next;
+      ::operator delete(static_cast<void *>(m_chunks),
+                        std::align_val_t{alignment});
+      m_chunks = next;
+    }
+    forget();
+  }
+
+  auto swap(NodePool &other) noexcept -> void {
+    using std::swap;
+    swap(m_free, other.m_free);
+    swap(m_free_tail, other.m_free_tail);
+    swap(m_chunks, other.m_chunks);
+    swap(m_chunks_tail, other.m_chunks_tail);
+    swap(m_cursor, other.m_cursor);
+    swap(m_remaining, other.m_remaining);
+  }
+
+private:
+  auto forget() noexcept -> void {
+    m_free = m_free_tail = nullptr;
+    m_chunks = m_chunks_tail = nullptr;
+    m_cursor = nullptr;
+    m_remaining = 0;
+  }
+
+  auto add_chunk() -> void {
+    auto *chunk = static_cast<Chunk *>(
+        ::operator new(chunk_bytes, std::align_val_t{alignment}));
+    chunk->next = m_chunks;
+    if (m_chunks == nullptr) {
+      m_chunks_tail = chunk;
+    }
+    m_chunks = chunk;
+    m_cursor = reinterpret_cast<unsigned char *>(chunk) + chunk_header;
+    m_remaining = chunk_bytes - chunk_header;
+  }
+};
+
+// Pairing heap node. prev points to the parent for a leftmost child and to
+// the left sibling otherwise, so any node can be cut out in O(1).
+template <typename T> struct PairingNode {
+  T data;
+  PairingNode *child{nullptr};
+  PairingNode *sibling{nullptr};
+  PairingNode *prev{nullptr};
+
+  template <typename... Args>
+  explicit PairingNode(Args &&...args) : data(std::forward<Args>(args)...) {}
+};
+} // namespace details
+
+/**
+ * @brief Handle to an element of a TreeHeap
+ *
+ * Stays valid until the element is popped or erased, including across
+ * meld() into another heap. A default-constructed handle refers to nothing.
+ */
+template <typename HeapType> class TreeHeap_Handle {
+public:
+  using node_pointer = typename HeapType::node_pointer;
+
+private:
+  node_pointer m_node{nullptr};
+
+  explicit TreeHeap_Handle(node_pointer node) noexcept : m_node(node) {}
+
+  friend HeapType;
+
+public:
+  TreeHeap_Handle() noexcept = default;
+
+  explicit operator bool() const noexcept { return m_node != nullptr; }
+
+  auto operator==(const TreeHeap_Handle &other) const noexcept -> bool {
+    return m_node == other.m_node;
+  }
+  auto operator!=(const TreeHeap_Handle &other) const noexcept -> bool {
+    return m_node != other.m_node;
+  }
+};
+
+/**
+ * @brief Mergeable priority queue implemented as a pairing heap
+ *
+ * @tparam ValueType The type of elements stored in the heap
+ * @tparam Compare Ordering in the sense of std::priority_queue: std::less
+ * gives a max-heap, std::greater a min-heap
+ *
+ * Nodes come from a chunked pool owned by the heap; meld() hands the other
+ * heap's pool over wholesale, so no node is copied or reallocated.
+ *
+ * Complexity guarantees:
+ * - push(), emplace(), meld(): O(1)
+ * - top(), value(handle), size(), empty(): O(1)
+ * - decrease_key(handle, value): O(1), with the restructuring deferred to
+ *   the next pop()
+ * - pop(), erase(handle): O(log n) amortized
+ *
+ * @example
+ * TreeHeap<int, std::greater<int>> timers, expired;
+ * auto handle = timers.push(30);
+ * expired.push(20);
+ * timers.meld(expired);
+ * timers.decrease_key(handle, 10);
+ * assert(timers.top() == 10 && expired.empty());
+ */
+template <typename ValueType, typename Compare = std::less<ValueType>>
+class TreeHeap {
+public:
+  using value_type = ValueType;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using value_compare = Compare;
+  using node_type = details::PairingNode<value_type>;
+  using node_pointer = node_type *;
+  using handle_type = TreeHeap_Handle<TreeHeap<ValueType, Compare>>;
+
+private:
+  details::NodePool<node_type> m_pool;
+  node_pointer m_root{nullptr};
+  size_type m_size{0};
+  Compare m_compare;
+
+public:
+  // Constructors
+  TreeHeap() = default;
+
+  explicit TreeHeap(const Compare &compare) : m_compare(compare) {}
+
+  TreeHeap(std::initializer_list<value_type> init_list,
+           const Compare &compare = Compare())
+      : m_compare(compare) {
+    for (const auto &value : init_list) {
+      push(value);
+    }
+  }
+
+  // Copies hold the same values; handles into other do not carry over.
+  TreeHeap(const TreeHeap &other) : m_compare(other.m_compare) {
+    other.visit_nodes([this](const node_type *node) { push(node->data); });
+  }
+
+  TreeHeap(TreeHeap &&other) noexcept : m_compare(other.m_compare) {
+    swap(other);
+  }
+
+  auto operator=(const TreeHeap &other) -> TreeHeap & {
+    if (this != &other) {
+      TreeHeap copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  auto operator=(TreeHeap &&other) noexcept -> TreeHeap & {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~TreeHeap() { destroy_nodes(); }
+
+  // Element access
+  [[nodiscard]] auto top() const -> const_reference {
+    if (m_root == nullptr) {
+      throw std::out_of_range("Cannot access top of empty heap");
+    }
+    return m_root->data;
+  }
+
+  [[nodiscard]] auto top_handle() const -> handle_type {
+    if (m_root == nullptr) {
+      throw std::out_of_range("Cannot access top of empty heap");
+    }
+    return handle_type(m_root);
+  }
+
+  [[nodiscard]] auto value(handle_type handle) const -> const_reference {
+    return node_of(handle)->data;
+  }
+
+  // Capacity
+  [[nodiscard]] auto empty() const noexcept -> bool {
+    return m_root == nullptr;
+  }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return empty(); }
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_size; }
+
+  // Modifiers
+  auto push(const value_type &value) -> handle_type { return emplace(value); }
+  auto push(value_type &&value) -> handle_type {
+    return emplace(std::move(value));
+  }
+
+  /**
+   * @return handle of the new element
+   */
+  template <typename... Args> auto emplace(Args &&...args) -> handle_type {
+    void *block = m_pool.allocate();
+    node_pointer node;
+    try {
+      node = ::new (block) node_type(std::forward<Args>(args)...);
+    } catch (...) {
+      m_pool.deallocate(block);
+      throw;
+    }
+    m_root = m_root == nullptr ? node : link(m_root, node);
+    ++m_size;
+    return handle_type(node);
+  }
+
+  auto pop() -> void {
+    if (m_root == nullptr) {
+      throw std::out_of_range("Cannot pop from empty heap");
+    }
+    node_pointer old_root = m_root;
+    m_root = merge_pairs(old_root->child);
+    destroy_node(old_root);
+  }
+
+  /**
+   * @brief Moves every element of other into this heap in O(1), leaving
+   * other empty. Handles into other stay valid and now refer to this heap.
+   */
+  auto meld(TreeHeap &other) -> void {
+    if (this == &other || other.m_root == nullptr) {
+      return;
+    }
+    m_pool.absorb(other.m_pool);
+    m_root = m_root == nullptr ? other.m_root : link(m_root, other.m_root);
+    m_size += other.m_size;
+    other.m_root = nullptr;
+    other.m_size = 0;
+  }
+
+  auto meld(TreeHeap &&other) -> void { meld(other); }
+
+  /**
+   * @brief Gives the element behind handle a value that ranks at least as
+   * high as its current one and moves it to the root list.
+   *
+   * @throws std::invalid_argument if value ranks below the current value
+   */
+  auto decrease_key(handle_type handle, value_type value) -> void {
+    node_pointer node = node_of(handle);
+    if (m_compare(value, node->data)) {
+      throw std::invalid_argument("New key ranks below the current key");
+    }
+    node->data = std::move(value);
+    if (node != m_root) {
+      cut(node);
+      m_root = link(m_root, node);
+    }
+  }
+
+  /**
+   * @brief Removes the element behind handle from anywhere in the heap.
+   */
+  auto erase(handle_type handle) -> void {
+    node_pointer node = node_of(handle);
+    if (node == m_root) {
+      pop();
+      return;
+    }
+    cut(node);
+    if (node_pointer children = merge_pairs(node->child)) {
+      m_root = link(m_root, children);
+    }
+    destroy_node(node);
+  }
+
+  auto clear() noexcept -> void {
+    destroy_nodes();
+    m_root = nullptr;
+    m_size = 0;
+  }
+
+  auto swap(TreeHeap &other) noexcept -> void {
+    using std::swap;
+    m_pool.swap(other.m_pool);
+    swap(m_root, other.m_root);
+    swap(m_size, other.m_size);
+    swap(m_compare, other.m_compare);
+  }
+
+private:
+  static auto node_of(handle_type handle) -> node_pointer {
+    if (!handle) {
+      throw std::out_of_range("Invalid heap handle");
+    }
+    return handle.m_node;
+  }
+
+  // Links two detached roots; the lower ranked one becomes the leftmost
+  // child of the other.
+  auto link(node_pointer a, node_pointer b) -> node_pointer {
+    if (m_compare(a->data, b->data)) {
+      std::swap(a, b);
+    }
+    b->sibling = a->child;
+    if (a->child != nullptr) {
+      a->child->prev = b;
+    }
+    b->prev = a;
+    a->child = b;
+    a->sibling = nullptr;
+    a->prev = nullptr;
+    return a;
+  }
+
+  static auto cut(node_pointer node) noexcept -> void {
+    if (node->prev->child == node) {
+      node->prev->child = node->sibling;
+    } else {
+      node->prev->sibling = node->sibling;
+    }
+    if (node->sibling != nullptr) {
+      node->sibling->prev = node->prev;
+    }
+    node->sibling = nullptr;
+    node->prev = nullptr;
+  }
+
+  // Standard two-pass pairing: link neighbours left to right, then fold the
+  // results right to left. The first pass stacks its results through the
+  // sibling links so no extra storage is needed.
+  auto merge_pairs(node_pointer first) -> node_pointer {
+    if (first == nullptr) {
+      return nullptr;
+    }
+    node_pointer stack = nullptr;
+    while (first != nullptr) {
+      node_pointer a = first;
+      node_pointer b = a->sibling;
+      if (b == nullptr) {
+        a->sibling = stack;
+        stack = a;
+        break;
+      }
+      first = b->sibling;
+      a->sibling = b->sibling = nullptr;
+      node_pointer merged = link(a, b);
+      merged->sibling = stack;
+      stack = merged;
+    }
+    node_pointer result = stack;
+    stack = stack->sibling;
+    result->sibling = nullptr;
+    result->prev = nullptr;
+    while (stack != nullptr) {
+      node_pointer next = stack->sibling;
+      stack->sibling = nullptr;
+      result = link(result, stack);
+      stack = next;
+    }
+    return result;
+  }
+
+  auto destroy_node(node_pointer node) noexcept -> void {
+    node->~node_type();
+    m_pool.deallocate(node);
+    --m_size;
+  }
+
+  // Preorder walk without extra storage: after a subtree is done, climb
+  // through the prev links to the nearest ancestor with a right sibling.
+  // Only pointer fields are read after visit(node) returns.
+  template <typename Visitor> auto visit_nodes(Visitor visit) const -> void {
+    const node_type *node = m_root;
+    while (node != nullptr) {
+      visit(node);
+      if (node->child != nullptr) {
+        node = node->child;
+        continue;
+      }
+      while (node != nullptr && node->sibling == nullptr) {
+        node = parent_of(node);
+      }
+      if (node != nullptr) {
+        node = node->sibling;
+      }
+    }
+  }
+
+  static auto parent_of(const node_type *node) noexcept -> const node_type * {
+    while (node->prev != nullptr && node->prev->child != node) {
+      node = node->prev;
+    }
+    return node->prev;
+  }
+
+  auto destroy_nodes() noexcept -> void {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      visit_nodes([](const node_type *node) {
+        std::destroy_at(&const_cast<node_type *>(node)->data);
+      });
+    }
+    m_pool.release();
+  }
+};
+
+#endif // __TREE_HEAP_HPP__
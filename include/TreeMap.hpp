@@ -0,0 +1,1262 @@
+#ifndef __TREE_MAP_HPP__
+#define __TREE_MAP_HPP__
+
+#include "KeyOf.hpp"
+#include "Prefetch.hpp"
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace details {
+/**
+ * @brief Number of leading elements of a sorted node array for which
+ * before(element) holds.
+ *
+ * Arithmetic elements are counted with one comparison per slot, which has
+ * no data-dependent branch and vectorizes; other elements use a branchless
+ * binary search whose halving step compiles to a conditional move.
+ */
+template <typename T, typename Before>
+[[nodiscard]] auto node_partition_point(const T *first, std::size_t count,
+                                        Before before) -> std::size_t {
+  if constexpr (std::is_arithmetic_v<T>) {
+    std::size_t below = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      below += static_cast<std::size_t>(before(first[i]));
+    }
+    return below;
+  } else {
+    if (count == 0) {
+      return 0;
+    }
+    const T *base = first;
+    while (count > 1) {
+      const std::size_t half = count / 2;
+      base = before(base[half]) ? base + half : base;
+      count -= half;
+    }
+    return static_cast<std::size_t>(base - first) +
+           static_cast<std::size_t>(before(*base));
+  }
+}
+
+/**
+ * @brief Moves the elements of [first, last) to dst, which may overlap the
+ * source on either side; the sources end their lifetime.
+ *
+ * A throw part way would leave a node with a hole in it, so the elements
+ * must relocate without throwing.
+ */
+template <typename T>
+auto relocate_overlapping(T *first, T *last, T *dst) noexcept -> void {
+  static_assert(is_trivially_relocatable_v<T> ||
+                    std::is_nothrow_move_constructible_v<T>,
+                "B+tree keys and values must be nothrow move constructible");
+  if (first == dst || first == last) {
+    return;
+  }
+  if constexpr (is_trivially_relocatable_v<T>) {
+    std::memmove(static_cast<void *>(dst), static_cast<const void *>(first),
+                 static_cast<std::size_t>(last - first) * sizeof(T));
+  } else if (dst < first) {
+    for (; first != last; ++first, ++dst) {
+      ::new (static_cast<void *>(dst)) T(std::move(*first));
+      std::destroy_at(first);
+    }
+  } else {
+    dst += last - first;
+    while (last != first) {
+      --last;
+      --dst;
+      ::new (static_cast<void *>(dst)) T(std::move(*last));
+      std::destroy_at(last);
+    }
+  }
+}
+
+template <typename Key, typename Entry, typename KeyOf, typename Compare>
+class BPlusTree;
+} // namespace details
+
+/**
+ * @brief Bidirectional iterator over the entries of a B+tree
+ *
+ * @tparam Tree The tree type this iterator is for
+ *
+ * Walks the doubly linked leaf chain, so ++ and -- never revisit inner
+ * nodes.
+ */
+template <typename Tree> class Tree_Iterator {
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename Tree::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = value_type *;
+  using reference = value_type &;
+  using leaf_pointer = typename Tree::leaf_pointer;
+  using size_type = std::size_t;
+
+public:
+  constexpr explicit Tree_Iterator(const Tree *tree = nullptr,
+                                   leaf_pointer leaf = nullptr,
+                                   size_type index = 0) noexcept
+      : m_tree(tree), m_leaf(leaf), m_index(index) {}
+
+  auto operator++() noexcept -> Tree_Iterator & {
+    if (++m_index == m_leaf->count) {
+      m_leaf = m_leaf->next;
+      m_index = 0;
+    }
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> Tree_Iterator {
+    Tree_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> Tree_Iterator & {
+    if (m_leaf == nullptr || m_index == 0) {
+      m_leaf = m_leaf == nullptr ? m_tree->m_last : m_leaf->prev;
+      m_index = m_leaf->count;
+    }
+    --m_index;
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> Tree_Iterator {
+    Tree_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference {
+    return m_leaf->entries()[m_index];
+  }
+  auto operator->() const noexcept -> pointer {
+    return m_leaf->entries() + m_index;
+  }
+
+  auto operator==(const Tree_Iterator &other) const noexcept -> bool {
+    return m_leaf == other.m_leaf && m_index == other.m_index;
+  }
+
+  auto operator!=(const Tree_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  friend Tree;
+  template <typename> friend class cTree_Iterator;
+
+  const Tree *m_tree;
+  leaf_pointer m_leaf;
+  size_type m_index;
+};
+
+/**
+ * @brief Const bidirectional iterator over the entries of a B+tree
+ *
+ * @tparam Tree The tree type this const iterator is for
+ */
+template <typename Tree> class cTree_Iterator {
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename Tree::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type *;
+  using reference = const value_type &;
+  using leaf_pointer = typename Tree::leaf_pointer;
+  using size_type = std::size_t;
+
+public:
+  constexpr explicit cTree_Iterator(const Tree *tree = nullptr,
+                                    leaf_pointer leaf = nullptr,
+                                    size_type index = 0) noexcept
+      : m_tree(tree), m_leaf(leaf), m_index(index) {}
+
+  constexpr cTree_Iterator(const Tree_Iterator<Tree> &other) noexcept
+      : m_tree(other.m_tree), m_leaf(other.m_leaf), m_index(other.m_index) {}
+
+  auto operator++() noexcept -> cTree_Iterator & {
+    if (++m_index == m_leaf->count) {
+      m_leaf = m_leaf->next;
+      m_index = 0;
+    }
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> cTree_Iterator {
+    cTree_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> cTree_Iterator & {
+    if (m_leaf == nullptr || m_index == 0) {
+      m_leaf = m_leaf == nullptr ? m_tree->m_last : m_leaf->prev;
+      m_index = m_leaf->count;
+    }
+    --m_index;
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> cTree_Iterator {
+    cTree_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference {
+    return m_leaf->entries()[m_index];
+  }
+  auto operator->() const noexcept -> pointer {
+    return m_leaf->entries() + m_index;
+  }
+
+  auto operator==(const cTree_Iterator &other) const noexcept -> bool {
+    return m_leaf == other.m_leaf && m_index == other.m_index;
+  }
+
+  auto operator!=(const cTree_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  friend Tree;
+
+  const Tree *m_tree;
+  leaf_pointer m_leaf;
+  size_type m_index;
+};
+
+namespace details {
+/**
+ * @brief B+tree of unique keys shared by TreeMap and TreeSet
+ *
+ * @tparam Key The key type, ordered by Compare
+ * @tparam Entry The stored element, from which KeyOf extracts the key
+ * @tparam KeyOf Functor returning the key of an Entry
+ * @tparam Compare Strict weak ordering on keys
+ *
+ * Entries live only in the leaves, which are linked in key order; inner
+ * nodes hold separator keys and child pointers. Every node is cache-line
+ * aligned and holds about node_bytes of keys or entries, so a lookup costs
+ * one short burst of adjacent lines per level, all prefetched before the
+ * node is searched. Nodes other than the root stay at least half full.
+ *
+ * Entries and keys shift inside a node on insert and erase; types that are
+ * not is_trivially_relocatable are moved one by one, so entries and keys
+ * must move without throwing.
+ */
+template <typename Key, typename Entry, typename KeyOf, typename Compare>
+class BPlusTree {
+public:
+  using key_type = Key;
+  using value_type = Entry;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using iterator = Tree_Iterator<BPlusTree>;
+  using const_iterator = cTree_Iterator<BPlusTree>;
+
+  static constexpr size_type node_bytes = 256;
+  static constexpr size_type cache_line = 64;
+  static constexpr size_type leaf_slots =
+      std::clamp<size_type>(node_bytes / sizeof(Entry), 4, 128);
+  static constexpr size_type inner_slots =
+      std::clamp<size_type>(node_bytes / sizeof(Key), 4, 128);
+  static constexpr size_type min_leaf = leaf_slots / 2;
+  static constexpr size_type min_inner = inner_slots / 2;
+  // Non-root nodes have at least 3 children and leaves at least 2 entries,
+  // so no tree that fits in memory comes close to this height.
+  static constexpr size_type max_height = 40;
+
+private:
+  struct Node {
+    std::uint16_t count{0};
+    bool leaf;
+
+    explicit Node(bool is_leaf) noexcept : leaf(is_leaf) {}
+  };
+
+  struct alignas(cache_line) Leaf : Node {
+    Leaf *prev{nullptr};
+    Leaf *next{nullptr};
+    alignas(Entry) unsigned char storage[leaf_slots * sizeof(Entry)];
+
+    Leaf() noexcept : Node(true) {}
+
+    [[nodiscard]] auto entries() noexcept -> Entry * {
+      return std::launder(reinterpret_cast<Entry *>(storage));
+    }
+  };
+
+  // Keys come first so the search reads the leading lines of the node.
+  struct alignas(cache_line) Inner : Node {
+    alignas(Key) unsigned char storage[inner_slots * sizeof(Key)];
+    Node *children[inner_slots + 1];
+
+    Inner() noexcept : Node(false) {}
+
+    [[nodiscard]] auto keys() noexcept -> Key * {
+      return std::launder(reinterpret_cast<Key *>(storage));
+    }
+  };
+
+  // The inner nodes on the way from the root to a leaf and the child taken
+  // in each.
+  struct Path {
+    Inner *nodes[max_height];
+    size_type slots[max_height];
+    size_type depth{0};
+  };
+
+  // Nodes allocated before a split starts, so the split itself never
+  // fails halfway for lack of memory.
+  struct Spare {
+    Leaf *leaf{nullptr};
+    Inner *inners[max_height];
+    size_type count{0};
+
+    Spare() = default;
+    Spare(const Spare &) = delete;
+    auto operator=(const Spare &) -> Spare & = delete;
+    ~Spare() {
+      delete leaf;
+      while (count > 0) {
+        delete inners[--count];
+      }
+    }
+
+    auto take_leaf() noexcept -> Leaf * { return std::exchange(leaf, nullptr); }
+    auto take_inner() noexcept -> Inner * { return inners[--count]; }
+  };
+
+public:
+  using leaf_pointer = Leaf *;
+
+private:
+  friend iterator;
+  friend const_iterator;
+
+  Node *m_root{nullptr};
+  Leaf *m_first{nullptr};
+  Leaf *m_last{nullptr};
+  size_type m_size{0};
+  size_type m_height{0};
+  Compare m_compare;
+
+public:
+  BPlusTree() = default;
+
+  explicit BPlusTree(const Compare &compare) : m_compare(compare) {}
+
+  BPlusTree(const BPlusTree &other) : m_compare(other.m_compare) {
+    build(other.begin(), other.end());
+  }
+
+  BPlusTree(BPlusTree &&other) noexcept { swap(other); }
+
+  auto operator=(const BPlusTree &other) -> BPlusTree & {
+    if (this != &other) {
+      BPlusTree temp(other);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  auto operator=(BPlusTree &&other) noexcept -> BPlusTree & {
+    swap(other);
+    return *this;
+  }
+
+  ~BPlusTree() { clear(); }
+
+  // Lookup
+  [[nodiscard]] auto find(const Key &key) const -> const_iterator {
+    if (m_root == nullptr) {
+      return end();
+    }
+    Leaf *leaf = descend(key);
+    const size_type index = leaf_lower_bound(leaf, key);
+    if (index < leaf->count &&
+        !m_compare(key, KeyOf{}(leaf->entries()[index]))) {
+      return const_iterator(this, leaf, index);
+    }
+    return end();
+  }
+
+  [[nodiscard]] auto lower_bound(const Key &key) const -> const_iterator {
+    if (m_root == nullptr) {
+      return end();
+    }
+    Leaf *leaf = descend(key);
+    return position(leaf, leaf_lower_bound(leaf, key));
+  }
+
+  [[nodiscard]] auto upper_bound(const Key &key) const -> const_iterator {
+    if (m_root == nullptr) {
+      return end();
+    }
+    Leaf *leaf = descend(key);
+    const size_type index = node_partition_point(
+        leaf->entries(), leaf->count,
+        [&](const Entry &entry) { return !m_compare(key, KeyOf{}(entry)); });
+    return position(leaf, index);
+  }
+
+  /**
+   * @brief Visits the entries with keys in [lo, hi) in ascending order.
+   *
+   * Only the leaf holding hi compares keys against it; every leaf before
+   * it is visited whole while the next leaf is prefetched.
+   *
+   * @return number of visited entries
+   */
+  template <typename Visitor>
+  auto scan(const Key &lo, const Key &hi, Visitor &visit) const -> size_type {
+    size_type count = 0;
+    const_iterator from = lower_bound(lo);
+    size_type index = from.m_index;
+    for (Leaf *leaf = from.m_leaf; leaf != nullptr;
+         leaf = leaf->next, index = 0) {
+      details::prefetch(leaf->next);
+      Entry *entries = leaf->entries();
+      size_type stop = leaf->count;
+      const bool last = !m_compare(KeyOf{}(entries[stop - 1]), hi);
+      if (last) {
+        stop = node_partition_point(entries, stop, [&](const Entry &entry) {
+          return m_compare(KeyOf{}(entry), hi);
+        });
+      }
+      for (; index < stop; ++index) {
+        visit(entries[index]);
+        ++count;
+      }
+      if (last) {
+        break;
+      }
+    }
+    return count;
+  }
+
+  // Modifiers
+  /**
+   * @brief Constructs an entry for key from args unless key is present.
+   *
+   * @return iterator to the entry for key and whether it was inserted
+   */
+  template <typename... Args>
+  auto emplace(const Key &key, Args &&...args) -> std::pair<iterator, bool> {
+    if (m_root == nullptr) {
+      auto *leaf = new Leaf();
+      try {
+        ::new (static_cast<void *>(leaf->entries()))
+            Entry(std::forward<Args>(args)...);
+      } catch (...) {
+        delete leaf;
+        throw;
+      }
+      leaf->count = 1;
+      m_root = m_first = m_last = leaf;
+      m_height = 1;
+      m_size = 1;
+      return {iterator(this, leaf, 0), true};
+    }
+
+    Path path;
+    Leaf *leaf = descend(key, path);
+    const size_type index = leaf_lower_bound(leaf, key);
+    if (index < leaf->count &&
+        !m_compare(key, KeyOf{}(leaf->entries()[index]))) {
+      return {iterator(this, leaf, index), false};
+    }
+    const iterator at = leaf->count < leaf_slots
+                            ? open_gap(leaf, index)
+                            : split_leaf(path, leaf, index);
+    try {
+      ::new (static_cast<void *>(at.m_leaf->entries() + at.m_index))
+          Entry(std::forward<Args>(args)...);
+    } catch (...) {
+      close_gap(at.m_leaf, at.m_index);
+      throw;
+    }
+    ++m_size;
+    return {at, true};
+  }
+
+  /**
+   * @brief Removes the entry for key.
+   *
+   * @return number of removed entries (0 or 1)
+   */
+  auto erase(const Key &key) -> size_type {
+    if (m_root == nullptr) {
+      return 0;
+    }
+    Path path;
+    Leaf *leaf = descend(key, path);
+    const size_type index = leaf_lower_bound(leaf, key);
+    if (index == leaf->count ||
+        m_compare(key, KeyOf{}(leaf->entries()[index]))) {
+      return 0;
+    }
+    erase_at(path, leaf, index);
+    return 1;
+  }
+
+  /**
+   * @brief Removes the entry at pos.
+   *
+   * @return iterator following the removed entry
+   * @throws std::out_of_range if pos is end()
+   */
+  auto erase(const_iterator pos) -> iterator {
+    if (pos.m_leaf == nullptr) {
+      throw std::out_of_range("Cannot erase end iterator");
+    }
+    Path path;
+    descend(KeyOf{}(pos.m_leaf->entries()[pos.m_index]), path);
+    return erase_at(path, pos.m_leaf, pos.m_index);
+  }
+
+  /**
+   * @brief Replaces the contents with the strictly ascending range
+   * [first, last) in O(n).
+   *
+   * Leaves are filled left to right and each inner level is built over the
+   * one below it, so every node ends up full except near the right edge.
+   *
+   * @throws std::invalid_argument if the keys are not strictly ascending;
+   * the tree is then left unchanged
+   */
+  template <typename InputIt>
+  auto assign_sorted(InputIt first, InputIt last) -> void {
+    BPlusTree fresh(m_compare);
+    fresh.build(first, last);
+    swap(fresh);
+  }
+
+  auto clear() noexcept -> void {
+    if (m_root != nullptr) {
+      destroy_subtree(m_root);
+    }
+    m_root = nullptr;
+    m_first = m_last = nullptr;
+    m_size = 0;
+    m_height = 0;
+  }
+
+  auto swap(BPlusTree &other) noexcept -> void {
+    using std::swap;
+    swap(m_root, other.m_root);
+    swap(m_first, other.m_first);
+    swap(m_last, other.m_last);
+    swap(m_size, other.m_size);
+    swap(m_height, other.m_height);
+    swap(m_compare, other.m_compare);
+  }
+
+  // Capacity
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_size == 0; }
+  [[nodiscard]] auto height() const noexcept -> size_type { return m_height; }
+
+  // Iterators
+  auto begin() noexcept -> iterator { return iterator(this, m_first, 0); }
+  auto end() noexcept -> iterator { return iterator(this, nullptr, 0); }
+  auto begin() const noexcept -> const_iterator {
+    return const_iterator(this, m_first, 0);
+  }
+  auto end() const noexcept -> const_iterator {
+    return const_iterator(this, nullptr, 0);
+  }
+
+  // Removes the constness an iterator picked up from a const lookup.
+  [[nodiscard]] auto mutable_iterator(const_iterator it) noexcept
+      -> iterator {
+    return iterator(this, it.m_leaf, it.m_index);
+  }
+
+private:
+  template <size_type Bytes>
+  static auto prefetch_node(const void *node) noexcept -> void {
+    const auto *bytes = static_cast<const unsigned char *>(node);
+    for (size_type offset = 0; offset < Bytes; offset += cache_line) {
+      details::prefetch(bytes + offset);
+    }
+  }
+
+  auto child_index(Inner *inner, const Key &key) const -> size_type {
+    return node_partition_point(
+        inner->keys(), inner->count,
+        [&](const Key &separator) { return !m_compare(key, separator); });
+  }
+
+  auto leaf_lower_bound(Leaf *leaf, const Key &key) const -> size_type {
+    return node_partition_point(
+        leaf->entries(), leaf->count,
+        [&](const Entry &entry) { return m_compare(KeyOf{}(entry), key); });
+  }
+
+  // Separator i is the smallest key of child i + 1, or a key below it that
+  // is still above everything in child i, so a key equal to a separator
+  // is always found to its right.
+  auto descend(const Key &key) const -> Leaf * {
+    Node *node = m_root;
+    while (!node->leaf) {
+      auto *inner = static_cast<Inner *>(node);
+      node = inner->children[child_index(inner, key)];
+      prefetch_node<sizeof(Inner)>(node);
+    }
+    return static_cast<Leaf *>(node);
+  }
+
+  auto descend(const Key &key, Path &path) const -> Leaf * {
+    Node *node = m_root;
+    while (!node->leaf) {
+      auto *inner = static_cast<Inner *>(node);
+      const size_type slot = child_index(inner, key);
+      path.nodes[path.depth] = inner;
+      path.slots[path.depth] = slot;
+      ++path.depth;
+      node = inner->children[slot];
+      prefetch_node<sizeof(Inner)>(node);
+    }
+    return static_cast<Leaf *>(node);
+  }
+
+  // The iterator for slot index of leaf, stepping to the next leaf when
+  // index is one past the last entry.
+  auto position(Leaf *leaf, size_type index) const noexcept
+      -> const_iterator {
+    return index == leaf->count ? const_iterator(this, leaf->next, 0)
+                                : const_iterator(this, leaf, index);
+  }
+
+  auto open_gap(Leaf *leaf, size_type index) -> iterator {
+    Entry *entries = leaf->entries();
+    relocate_overlapping(entries + index, entries + leaf->count,
+                         entries + index + 1);
+    ++leaf->count;
+    return iterator(this, leaf, index);
+  }
+
+  auto close_gap(Leaf *leaf, size_type index) -> void {
+    Entry *entries = leaf->entries();
+    relocate_overlapping(entries + index + 1, entries + leaf->count,
+                         entries + index);
+    --leaf->count;
+  }
+
+  // Splits the full leaf in half and opens a gap for index in the half
+  // that owns it, then pushes the new right half into the parents.
+  auto split_leaf(Path &path, Leaf *leaf, size_type index) -> iterator {
+    Spare spare;
+    spare.leaf = new Leaf();
+    size_type depth = path.depth;
+    while (depth > 0 && path.nodes[depth - 1]->count == inner_slots) {
+      --depth;
+    }
+    for (size_type needed = path.depth - depth + (depth == 0 ? 1 : 0);
+         spare.count < needed; ++spare.count) {
+      spare.inners[spare.count] = new Inner();
+    }
+
+    constexpr size_type mid = leaf_slots / 2;
+    Key separator(KeyOf{}(leaf->entries()[mid]));
+    Leaf *right = spare.take_leaf();
+    relocate_overlapping(leaf->entries() + mid, leaf->entries() + leaf->count,
+                         right->entries());
+    right->count = static_cast<std::uint16_t>(leaf->count - mid);
+    leaf->count = static_cast<std::uint16_t>(mid);
+
+    right->prev = leaf;
+    right->next = leaf->next;
+    if (leaf->next != nullptr) {
+      leaf->next->prev = right;
+    } else {
+      m_last = right;
+    }
+    leaf->next = right;
+
+    const iterator at = index <= mid ? open_gap(leaf, index)
+                                     : open_gap(right, index - mid);
+    insert_separator(path, path.depth, std::move(separator), right, spare);
+    return at;
+  }
+
+  // Adds separator and its right child to the inner node at depth - 1,
+  // splitting it (and its ancestors) when full.
+  auto insert_separator(Path &path, size_type depth, Key &&separator,
+                        Node *right, Spare &spare) -> void {
+    if (depth == 0) {
+      Inner *root = spare.take_inner();
+      ::new (static_cast<void *>(root->keys())) Key(std::move(separator));
+      root->children[0] = m_root;
+      root->children[1] = right;
+      root->count = 1;
+      m_root = root;
+      ++m_height;
+      return;
+    }
+    Inner *inner = path.nodes[depth - 1];
+    const size_type slot = path.slots[depth - 1];
+    if (inner->count < inner_slots) {
+      inner_insert(inner, slot, std::move(separator), right);
+      return;
+    }
+
+    constexpr size_type mid = inner_slots / 2;
+    Inner *sibling = spare.take_inner();
+    Key *keys = inner->keys();
+    relocate_overlapping(keys + mid + 1, keys + inner->count,
+                         sibling->keys());
+    std::copy(inner->children + mid + 1, inner->children + inner->count + 1,
+              sibling->children);
+    sibling->count = static_cast<std::uint16_t>(inner->count - mid - 1);
+    Key promoted(std::move(keys[mid]));
+    std::destroy_at(keys + mid);
+    inner->count = static_cast<std::uint16_t>(mid);
+
+    if (slot <= mid) {
+      inner_insert(inner, slot, std::move(separator), right);
+    } else {
+      inner_insert(sibling, slot - mid - 1, std::move(separator), right);
+    }
+    insert_separator(path, depth - 1, std::move(promoted), sibling, spare);
+  }
+
+  auto inner_insert(Inner *inner, size_type slot, Key &&separator,
+                    Node *right) -> void {
+    Key *keys = inner->keys();
+    relocate_overlapping(keys + slot, keys + inner->count, keys + slot + 1);
+    ::new (static_cast<void *>(keys + slot)) Key(std::move(separator));
+    std::copy_backward(inner->children + slot + 1,
+                       inner->children + inner->count + 1,
+                       inner->children + inner->count + 2);
+    inner->children[slot + 1] = right;
+    ++inner->count;
+  }
+
+  // Removes entry index of leaf, whose ancestors are recorded in path,
+  // and returns the position of the entry that followed it.
+  auto erase_at(Path &path, Leaf *leaf, size_type index) -> iterator {
+    std::destroy_at(leaf->entries() + index);
+    close_gap(leaf, index);
+    --m_size;
+    if (leaf->count >= min_leaf || path.depth == 0) {
+      if (m_size == 0) {
+        clear();
+        return end();
+      }
+      return mutable_iterator(position(leaf, index));
+    }
+
+    Inner *parent = path.nodes[path.depth - 1];
+    const size_type slot = path.slots[path.depth - 1];
+    Entry *entries = leaf->entries();
+    if (slot > 0) {
+      auto *left = static_cast<Leaf *>(parent->children[slot - 1]);
+      if (left->count > min_leaf) {
+        open_gap(leaf, 0);
+        --left->count;
+        relocate_overlapping(left->entries() + left->count,
+                             left->entries() + left->count + 1, entries);
+        parent->keys()[slot - 1] = KeyOf{}(entries[0]);
+        return mutable_iterator(position(leaf, index + 1));
+      }
+    }
+    if (slot < parent->count) {
+      auto *right = static_cast<Leaf *>(parent->children[slot + 1]);
+      if (right->count > min_leaf) {
+        relocate_overlapping(right->entries(), right->entries() + 1,
+                             entries + leaf->count);
+        ++leaf->count;
+        close_gap(right, 0);
+        parent->keys()[slot] = KeyOf{}(right->entries()[0]);
+        return iterator(this, leaf, index);
+      }
+    }
+
+    if (slot > 0) {
+      auto *left = static_cast<Leaf *>(parent->children[slot - 1]);
+      const size_type at = left->count + index;
+      merge_leaves(left, leaf);
+      remove_child(path, path.depth - 1, slot - 1);
+      return mutable_iterator(position(left, at));
+    }
+    merge_leaves(leaf, static_cast<Leaf *>(parent->children[slot + 1]));
+    remove_child(path, path.depth - 1, slot);
+    return mutable_iterator(position(leaf, index));
+  }
+
+  // Appends the entries of right to left and frees right.
+  auto merge_leaves(Leaf *left, Leaf *right) -> void {
+    relocate_overlapping(right->entries(), right->entries() + right->count,
+                         left->entries() + left->count);
+    left->count = static_cast<std::uint16_t>(left->count + right->count);
+    left->next = right->next;
+    if (right->next != nullptr) {
+      right->next->prev = left;
+    } else {
+      m_last = left;
+    }
+    delete right;
+  }
+
+  // Drops separator `separator` and child separator + 1 (already merged
+  // into its left neighbour) from the inner node at path depth, then
+  // repairs that node if it fell below half full.
+  auto remove_child(Path &path, size_type depth, size_type separator)
+      -> void {
+    Inner *inner = path.nodes[depth];
+    Key *keys = inner->keys();
+    std::destroy_at(keys + separator);
+    relocate_overlapping(keys + separator + 1, keys + inner->count,
+                         keys + separator);
+    std::copy(inner->children + separator + 2,
+              inner->children + inner->count + 1,
+              inner->children + separator + 1);
+    --inner->count;
+
+    if (depth == 0) {
+      if (inner->count == 0) {
+        m_root = inner->children[0];
+        delete inner;
+        --m_height;
+      }
+      return;
+    }
+    if (inner->count >= min_inner) {
+      return;
+    }
+
+    Inner *parent = path.nodes[depth - 1];
+    const size_type slot = path.slots[depth - 1];
+    if (slot > 0) {
+      auto *left = static_cast<Inner *>(parent->children[slot - 1]);
+      if (left->count > min_inner) {
+        relocate_overlapping(keys, keys + inner->count, keys + 1);
+        ::new (static_cast<void *>(keys))
+            Key(std::move(parent->keys()[slot - 1]));
+        std::copy_backward(inner->children,
+                           inner->children + inner->count + 1,
+                           inner->children + inner->count + 2);
+        inner->children[0] = left->children[left->count];
+        ++inner->count;
+        --left->count;
+        parent->keys()[slot - 1] = std::move(left->keys()[left->count]);
+        std::destroy_at(left->keys() + left->count);
+        return;
+      }
+    }
+    if (slot < parent->count) {
+      auto *right = static_cast<Inner *>(parent->children[slot + 1]);
+      if (right->count > min_inner) {
+        ::new (static_cast<void *>(keys + inner->count))
+            Key(std::move(parent->keys()[slot]));
+        inner->children[inner->count + 1] = right->children[0];
+        ++inner->count;
+        parent->keys()[slot] = std::move(right->keys()[0]);
+        std::destroy_at(right->keys());
+        relocate_overlapping(right->keys() + 1,
+                             right->keys() + right->count, right->keys());
+        std::copy(right->children + 1, right->children + right->count + 1,
+                  right->children);
+        --right->count;
+        return;
+      }
+    }
+
+    if (slot > 0) {
+      merge_inners(static_cast<Inner *>(parent->children[slot - 1]), inner,
+                   parent->keys()[slot - 1]);
+      remove_child(path, depth - 1, slot - 1);
+    } else {
+      merge_inners(inner, static_cast<Inner *>(parent->children[slot + 1]),
+                   parent->keys()[slot]);
+      remove_child(path, depth - 1, slot);
+    }
+  }
+
+  // Appends separator and the keys and children of right to left and
+  // frees right. The separator is left moved-from for the caller to drop.
+  auto merge_inners(Inner *left, Inner *right, Key &separator) -> void {
+    Key *keys = left->keys();
+    ::new (static_cast<void *>(keys + left->count)) Key(std::move(separator));
+    relocate_overlapping(right->keys(), right->keys() + right->count,
+                         keys + left->count + 1);
+    std::copy(right->children, right->children + right->count + 1,
+              left->children + left->count + 1);
+    left->count = static_cast<std::uint16_t>(left->count + 1 + right->count);
+    delete right;
+  }
+
+  auto destroy_subtree(Node *node) noexcept -> void {
+    if (node->leaf) {
+      auto *leaf = static_cast<Leaf *>(node);
+      std::destroy_n(leaf->entries(), leaf->count);
+      delete leaf;
+      return;
+    }
+    auto *inner = static_cast<Inner *>(node);
+    std::destroy_n(inner->keys(), inner->count);
+    for (size_type i = 0; i <= inner->count; ++i) {
+      destroy_subtree(inner->children[i]);
+    }
+    delete inner;
+  }
+
+  // Bulk load into an empty tree; on failure every node built so far is
+  // released and the tree is left empty.
+  template <typename InputIt> auto build(InputIt first, InputIt last) -> void {
+    Vector<Inner *> inners;
+    try {
+      const Entry *previous = nullptr;
+      for (; first != last; ++first) {
+        Leaf *leaf = m_last;
+        if (leaf == nullptr || leaf->count == leaf_slots) {
+          leaf = new Leaf();
+          leaf->prev = m_last;
+          (m_last != nullptr ? m_last->next : m_first) = leaf;
+          m_last = leaf;
+        }
+        Entry *slot = leaf->entries() + leaf->count;
+        ::new (static_cast<void *>(slot)) Entry(*first);
+        ++leaf->count;
+        if (previous != nullptr &&
+            !m_compare(KeyOf{}(*previous), KeyOf{}(*slot))) {
+          throw std::invalid_argument("Input range is not strictly ascending");
+        }
+        previous = slot;
+        ++m_size;
+      }
+      if (m_size == 0) {
+        return;
+      }
+      balance_last_leaf();
+
+      Vector<Node *> level;
+      for (Leaf *leaf = m_first; leaf != nullptr; leaf = leaf->next) {
+        level.push_back(leaf);
+      }
+      m_height = 1;
+      while (level.size() > 1) {
+        // Children are dealt out evenly, which keeps every group above
+        // half full whenever more than one group is needed.
+        const size_type nodes = level.size();
+        const size_type groups = (nodes + inner_slots) / (inner_slots + 1);
+        Vector<Node *> parents;
+        parents.reserve(groups);
+        size_type child = 0;
+        for (size_type group = 0; group < groups; ++group) {
+          const size_type take =
+              nodes / groups + (group < nodes % groups ? 1 : 0);
+          inners.push_back(nullptr);
+          auto *inner = new Inner();
+          inners[inners.size() - 1] = inner;
+          inner->children[0] = level[child];
+          for (size_type i = 1; i < take; ++i) {
+            ::new (static_cast<void *>(inner->keys() + i - 1))
+                Key(KeyOf{}(leftmost_entry(level[child + i])));
+            inner->children[i] = level[child + i];
+            ++inner->count;
+          }
+          child += take;
+          parents.push_back(inner);
+        }
+        level = std::move(parents);
+        ++m_height;
+      }
+      m_root = level[0];
+    } catch (...) {
+      while (m_first != nullptr) {
+        Leaf *next = m_first->next;
+        std::destroy_n(m_first->entries(), m_first->count);
+        delete m_first;
+        m_first = next;
+      }
+      for (size_type i = 0; i < inners.size(); ++i) {
+        if (inners[i] != nullptr) {
+          std::destroy_n(inners[i]->keys(), inners[i]->count);
+          delete inners[i];
+        }
+      }
+      m_last = nullptr;
+      m_size = 0;
+      m_height = 0;
+      throw;
+    }
+  }
+
+  // Tops up a short last leaf from its full predecessor.
+  auto balance_last_leaf() -> void {
+    Leaf *last = m_last;
+    Leaf *prev = last->prev;
+    if (prev == nullptr || last->count >= min_leaf) {
+      return;
+    }
+    const size_type moved = (prev->count + last->count) / 2 - last->count;
+    relocate_overlapping(last->entries(), last->entries() + last->count,
+                         last->entries() + moved);
+    relocate_overlapping(prev->entries() + prev->count - moved,
+                         prev->entries() + prev->count, last->entries());
+    prev->count = static_cast<std::uint16_t>(prev->count - moved);
+    last->count = static_cast<std::uint16_t>(last->count + moved);
+  }
+
+  static auto leftmost_entry(Node *node) noexcept -> const Entry & {
+    while (!node->leaf) {
+      node = static_cast<Inner *>(node)->children[0];
+    }
+    return static_cast<Leaf *>(node)->entries()[0];
+  }
+};
+} // namespace details
+
+/**
+ * @brief Ordered map implemented as a B+tree with linked leaves
+ *
+ * @tparam Key The key type, ordered by Compare
+ * @tparam Value The mapped type
+ * @tparam Compare Strict weak ordering on keys
+ *
+ * @requires Key and Value must be nothrow move constructible
+ *
+ * Entries are stored in sorted runs of leaf_slots per leaf and the inner
+ * levels hold up to inner_slots separator keys each, every node spanning a
+ * few cache lines. A lookup therefore touches O(log_B n) nodes instead of
+ * the O(log n) scattered nodes of a red-black tree, searches each node
+ * without data-dependent branches, and ordered iteration and scan() run
+ * along the leaf chain. The entries are std::pair<Key, Value> rather than
+ * pair<const Key, Value> so that nodes can move them, as in FlatMap; the
+ * key of an entry must not be modified through an iterator.
+ *
+ * Complexity guarantees (B = entries per node):
+ * - find(), contains(), at(): O(log n), O(log_B n) cache misses
+ * - insert(), emplace(), operator[](): O(B + log n)
+ * - erase(): O(B + log n)
+ * - lower_bound(), upper_bound(): O(log n)
+ * - scan(lo, hi, visitor): O(log n + k) for k visited entries
+ * - assign_sorted(): O(n)
+ * - size(), is_empty(): O(1)
+ * - begin(), end(), ++, --: O(1)
+ *
+ * @example
+ * TreeMap<int, std::string> names;
+ * names.insert(2, "two");
+ * names[1] = "one";
+ * names.scan(0, 10, [](int key, const std::string &name) {
+ *   std::cout << key << " " << name << "\n";  // 1 one, then 2 two
+ * });
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class TreeMap {
+private:
+  using Tree = details::BPlusTree<Key, std::pair<Key, Value>,
+                                  details::KeyOfPair, Compare>;
+
+public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<Key, Value>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using key_compare = Compare;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename Tree::iterator;
+  using const_iterator = typename Tree::const_iterator;
+
+  static constexpr size_type leaf_slots = Tree::leaf_slots;
+  static constexpr size_type inner_slots = Tree::inner_slots;
+
+private:
+  Tree m_tree;
+
+public:
+  TreeMap() = default;
+
+  explicit TreeMap(const Compare &compare) : m_tree(compare) {}
+
+  TreeMap(std::initializer_list<value_type> init) {
+    for (const auto &entry : init) {
+      insert(entry.first, entry.second);
+    }
+  }
+
+  // Lookup
+  [[nodiscard]] auto find(const Key &key) -> iterator {
+    return m_tree.mutable_iterator(m_tree.find(key));
+  }
+
+  [[nodiscard]] auto find(const Key &key) const -> const_iterator {
+    return m_tree.find(key);
+  }
+
+  [[nodiscard]] auto contains(const Key &key) const -> bool {
+    return m_tree.find(key) != m_tree.end();
+  }
+
+  [[nodiscard]] auto at(const Key &key) -> Value & {
+    const iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("Key not found in map");
+    }
+    return it->second;
+  }
+
+  [[nodiscard]] auto at(const Key &key) const -> const Value & {
+    const const_iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("Key not found in map");
+    }
+    return it->second;
+  }
+
+  auto operator[](const Key &key) -> Value & {
+    return emplace(key).first->second;
+  }
+
+  /**
+   * @brief First entry whose key is not less than key.
+   */
+  [[nodiscard]] auto lower_bound(const Key &key) const -> const_iterator {
+    return m_tree.lower_bound(key);
+  }
+
+  [[nodiscard]] auto lower_bound(const Key &key) -> iterator {
+    return m_tree.mutable_iterator(m_tree.lower_bound(key));
+  }
+
+  /**
+   * @brief First entry whose key is greater than key.
+   */
+  [[nodiscard]] auto upper_bound(const Key &key) const -> const_iterator {
+    return m_tree.upper_bound(key);
+  }
+
+  [[nodiscard]] auto upper_bound(const Key &key) -> iterator {
+    return m_tree.mutable_iterator(m_tree.upper_bound(key));
+  }
+
+  /**
+   * @brief Visits the entries with keys in [lo, hi) in ascending order.
+   *
+   * @return number of visited entries
+   */
+  template <typename Visitor>
+  auto scan(const Key &lo, const Key &hi, Visitor visit) const -> size_type {
+    auto visit_entry = [&](const value_type &entry) {
+      visit(entry.first, entry.second);
+    };
+    return m_tree.scan(lo, hi, visit_entry);
+  }
+
+  // Modifiers
+  /**
+   * @brief Inserts (key, value) unless key is already present.
+   *
+   * @return iterator to the entry for key and whether it was inserted
+   */
+  auto insert(const Key &key, const Value &value) -> std::pair<iterator, bool> {
+    return emplace(key, value);
+  }
+
+  auto insert(const Key &key, Value &&value) -> std::pair<iterator, bool> {
+    return emplace(key, std::move(value));
+  }
+
+  /**
+   * @brief Inserts or overwrites the value for key.
+   *
+   * @return true if a new entry was inserted
+   */
+  template <typename V>
+  auto insert_or_assign(const Key &key, V &&value) -> bool {
+    auto [it, inserted] = emplace(key, std::forward<V>(value));
+    if (!inserted) {
+      it->second = std::forward<V>(value);
+    }
+    return inserted;
+  }
+
+  /**
+   * @brief Constructs the value for key from args unless key is present.
+   */
+  template <typename... Args>
+  auto emplace(const Key &key, Args &&...args) -> std::pair<iterator, bool> {
+    return m_tree.emplace(key, std::piecewise_construct,
+                          std::forward_as_tuple(key),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  /**
+   * @brief Removes the entry for key.
+   *
+   * @return number of removed entries (0 or 1)
+   */
+  auto erase(const Key &key) -> size_type { return m_tree.erase(key); }
+
+  /**
+   * @brief Removes the entry at pos.
+   *
+   * @return iterator following the removed entry
+   * @throws std::out_of_range if pos is end()
+   */
+  auto erase(const_iterator pos) -> iterator { return m_tree.erase(pos); }
+
+  /**
+   * @brief Replaces the contents with the (key, value) pairs of
+   * [first, last), whose keys must be strictly ascending, in O(n).
+   *
+   * @throws std::invalid_argument if the keys are not strictly ascending;
+   * the map is then left unchanged
+   */
+  template <typename InputIt>
+  auto assign_sorted(InputIt first, InputIt last) -> void {
+    m_tree.assign_sorted(first, last);
+  }
+
+  auto clear() noexcept -> void { m_tree.clear(); }
+
+  auto swap(TreeMap &other) noexcept -> void { m_tree.swap(other.m_tree); }
+
+  // Capacity
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return m_tree.size();
+  }
+  [[nodiscard]] auto is_empty() const noexcept -> bool {
+    return m_tree.is_empty();
+  }
+  /**
+   * @brief Number of node levels, leaves included (0 when empty).
+   */
+  [[nodiscard]] auto height() const noexcept -> size_type {
+    return m_tree.height();
+  }
+
+  // Iterators
+  auto begin() noexcept -> iterator { return m_tree.begin(); }
+  auto end() noexcept -> iterator { return m_tree.end(); }
+  auto begin() const noexcept -> const_iterator { return m_tree.begin(); }
+  auto end() const noexcept -> const_iterator { return m_tree.end(); }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+};
+
+#endif // __TREE_MAP_HPP__
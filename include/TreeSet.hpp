@@ -0,0 +1,180 @@
+#ifndef __TREE_SET_HPP__
+#define __TREE_SET_HPP__
+
+#include "TreeMap.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+/**
+ * @brief Ordered set implemented as a B+tree with linked leaves
+ *
+ * @tparam Key The element type, ordered by Compare
+ * @tparam Compare Strict weak ordering on elements
+ *
+ * @requires Key must be nothrow move constructible
+ *
+ * Shares its tree with TreeMap. Leaves hold nothing but keys, so a leaf of
+ * 4-byte integers carries 64 of them, and arithmetic keys are searched by
+ * counting the smaller keys of a node in one vectorizable pass.
+ *
+ * Complexity guarantees (B = keys per node):
+ * - find(), contains(): O(log n), O(log_B n) cache misses
+ * - insert(), emplace(): O(B + log n)
+ * - erase(): O(B + log n)
+ * - lower_bound(), upper_bound(): O(log n)
+ * - scan(lo, hi, visitor): O(log n + k) for k visited keys
+ * - assign_sorted(): O(n)
+ * - size(), is_empty(): O(1)
+ * - begin(), end(), ++, --: O(1)
+ *
+ * @example
+ * std::vector<int> sorted{1, 3, 5, 7};
+ * TreeSet<int> set;
+ * set.assign_sorted(sorted.begin(), sorted.end());
+ * set.insert(4);
+ * assert(*set.lower_bound(4) == 4 && *set.upper_bound(5) == 7);
+ */
+template <typename Key, typename Compare = std::less<Key>> class TreeSet {
+private:
+  using Tree = details::BPlusTree<Key, Key, details::KeyOfSelf, Compare>;
+
+public:
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using key_compare = Compare;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using const_iterator = typename Tree::const_iterator;
+  using iterator = const_iterator;
+
+  static constexpr size_type leaf_slots = Tree::leaf_slots;
+  static constexpr size_type inner_slots = Tree::inner_slots;
+
+private:
+  Tree m_tree;
+
+public:
+  TreeSet() = default;
+
+  explicit TreeSet(const Compare &compare) : m_tree(compare) {}
+
+  TreeSet(std::initializer_list<Key> init) {
+    for (const auto &key : init) {
+      insert(key);
+    }
+  }
+
+  // Lookup
+  [[nodiscard]] auto find(const Key &key) const -> const_iterator {
+    return m_tree.find(key);
+  }
+
+  [[nodiscard]] auto contains(const Key &key) const -> bool {
+    return m_tree.find(key) != m_tree.end();
+  }
+
+  /**
+   * @brief First key not less than key.
+   */
+  [[nodiscard]] auto lower_bound(const Key &key) const -> const_iterator {
+    return m_tree.lower_bound(key);
+  }
+
+  /**
+   * @brief First key greater than key.
+   */
+  [[nodiscard]] auto upper_bound(const Key &key) const -> const_iterator {
+    return m_tree.upper_bound(key);
+  }
+
+  /**
+   * @brief Visits the keys in [lo, hi) in ascending order.
+   *
+   * @return number of visited keys
+   */
+  template <typename Visitor>
+  auto scan(const Key &lo, const Key &hi, Visitor visit) const -> size_type {
+    auto visit_key = [&](const Key &key) { visit(key); };
+    return m_tree.scan(lo, hi, visit_key);
+  }
+
+  // Modifiers
+  /**
+   * @brief Inserts key unless it is already present.
+   *
+   * @return iterator to key in the set and whether it was inserted
+   */
+  auto insert(const Key &key) -> std::pair<iterator, bool> {
+    return m_tree.emplace(key, key);
+  }
+
+  auto insert(Key &&key) -> std::pair<iterator, bool> {
+    return m_tree.emplace(key, std::move(key));
+  }
+
+  /**
+   * @brief Constructs a key from args and inserts it unless present.
+   */
+  template <typename... Args>
+  auto emplace(Args &&...args) -> std::pair<iterator, bool> {
+    return insert(Key(std::forward<Args>(args)...));
+  }
+
+  /**
+   * @brief Removes key.
+   *
+   * @return number of removed keys (0 or 1)
+   */
+  auto erase(const Key &key) -> size_type { return m_tree.erase(key); }
+
+  /**
+   * @brief Removes the key at pos.
+   *
+   * @return iterator following the removed key
+   * @throws std::out_of_range if pos is end()
+   */
+  auto erase(const_iterator pos) -> iterator { return m_tree.erase(pos); }
+
+  /**
+   * @brief Replaces the contents with the strictly ascending keys of
+   * [first, last) in O(n).
+   *
+   * @throws std::invalid_argument if the keys are not strictly ascending;
+   * the set is then left unchanged
+   */
+  template <typename InputIt>
+  auto assign_sorted(InputIt first, InputIt last) -> void {
+    m_tree.assign_sorted(first, last);
+  }
+
+  auto clear() noexcept -> void { m_tree.clear(); }
+
+  auto swap(TreeSet &other) noexcept -> void { m_tree.swap(other.m_tree); }
+
+  // Capacity
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return m_tree.size();
+  }
+  [[nodiscard]] auto is_empty() const noexcept -> bool {
+    return m_tree.is_empty();
+  }
+  /**
+   * @brief Number of node levels, leaves included (0 when empty).
+   */
+  [[nodiscard]] auto height() const noexcept -> size_type {
+    return m_tree.height();
+  }
+
+  // Iterators
+  auto begin() const noexcept -> const_iterator { return m_tree.begin(); }
+  auto end() const noexcept -> const_iterator { return m_tree.end(); }
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+};
+
+#endif // __TREE_SET_HPP__
@@ -0,0 +1,807 @@
+#ifndef __VECTOR_HPP__
+#define __VECTOR_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Whether a T can be moved to new storage with memcpy, after which
+ * the source bytes are simply released without running the destructor.
+ *
+ * Trivially copyable types qualify. Specialize to std::true_type for other
+ * types whose representation does not depend on their own address, such as
+ * most handle or smart pointer types.
+ */
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+// std::pair has user-provided assignment, so it is never trivially
+// copyable, but it relocates bitwise whenever both members do.
+template <typename First, typename Second>
+struct is_trivially_relocatable<std::pair<First, Second>>
+    : std::bool_constant<
+          is_trivially_relocatable_v<std::remove_const_t<First>> &&
+          is_trivially_relocatable_v<std::remove_const_t<Second>>> {};
+
+/**
+ * @brief Growth policy multiplying the capacity by Numerator / Denominator.
+ */
+template <std::size_t Numerator, std::size_t Denominator = 1>
+struct GrowthFactor {
+  static_assert(Denominator > 0 && Numerator > Denominator,
+                "Growth factor must be greater than 1");
+
+  [[nodiscard]] static constexpr auto
+  next_capacity(std::size_t capacity, std::size_t required) noexcept
+      -> std::size_t {
+    const std::size_t step = capacity / Denominator * (Numerator - Denominator);
+    const std::size_t grown = capacity + (step > 0 ? step : 1);
+    return grown > required ? grown : required;
+  }
+};
+
+using DoublingGrowth = GrowthFactor<2>;
+using GoldenGrowth = GrowthFactor<3, 2>;
+
+namespace details {
+template <typename T> auto allocate_elements(std::size_t count) -> T * {
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "Over-aligned element types are not supported");
+  if (count > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+    throw std::length_error("Vector capacity exceeds maximum size");
+  }
+  void *block = std::malloc(count * sizeof(T));
+  if (block == nullptr) {
+    throw std::bad_alloc();
+  }
+  return static_cast<T *>(block);
+}
+
+inline auto free_elements(void *block) noexcept -> void { std::free(block); }
+
+/**
+ * @brief Moves (or, when moving may throw, copies) count elements into
+ * uninitialized dst. Sources are left alive; on failure the elements
+ * constructed so far are destroyed and the exception is rethrown.
+ */
+template <typename T> auto move_into(T *src, std::size_t count, T *dst) -> void {
+  std::size_t i = 0;
+  try {
+    for (; i < count; ++i) {
+      ::new (static_cast<void *>(dst + i)) T(std::move_if_noexcept(src[i]));
+    }
+  } catch (...) {
+    std::destroy(dst, dst + i);
+    throw;
+  }
+}
+
+/**
+ * @brief First half of a relocation: memcpy for trivially relocatable T,
+ * move_into otherwise. Finish with release_relocated on the sources.
+ */
+template <typename T>
+auto relocate_into(T *src, std::size_t count, T *dst) -> void {
+  if constexpr (is_trivially_relocatable_v<T>) {
+    if (count > 0) {
+      std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src),
+                  count * sizeof(T));
+    }
+  } else {
+    move_into(src, count, dst);
+  }
+}
+
+template <typename T> auto release_relocated(T *first, T *last) noexcept {
+  if constexpr (!is_trivially_relocatable_v<T>) {
+    std::destroy(first, last);
+  }
+}
+} // namespace details
+
+/**
+ * @brief Random access iterator for Vector container
+ *
+ * @tparam VectorType The vector container type this iterator is for
+ */
+template <typename VectorType> class Vector_Iterator {
+public:
+  using value_type = typename VectorType::value_type;
+  using pointer = value_type *;
+  using reference = value_type &;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::random_access_iterator_tag;
+
+public:
+  constexpr explicit Vector_Iterator(pointer ptr = nullptr) noexcept
+      : m_ptr(ptr) {}
+
+  auto operator++() noexcept -> Vector_Iterator & {
+    ++m_ptr;
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> Vector_Iterator {
+    Vector_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> Vector_Iterator & {
+    --m_ptr;
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> Vector_Iterator {
+    Vector_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator+=(difference_type n) noexcept -> Vector_Iterator & {
+    m_ptr += n;
+    return *this;
+  }
+
+  auto operator-=(difference_type n) noexcept -> Vector_Iterator & {
+    m_ptr -= n;
+    return *this;
+  }
+
+  [[nodiscard]] auto operator+(difference_type n) const noexcept
+      -> Vector_Iterator {
+    return Vector_Iterator(m_ptr + n);
+  }
+
+  [[nodiscard]] friend auto operator+(difference_type n,
+                                      const Vector_Iterator &it) noexcept
+      -> Vector_Iterator {
+    return it + n;
+  }
+
+  [[nodiscard]] auto operator-(difference_type n) const noexcept
+      -> Vector_Iterator {
+    return Vector_Iterator(m_ptr - n);
+  }
+
+  [[nodiscard]] auto operator-(const Vector_Iterator &other) const noexcept
+      -> difference_type {
+    return m_ptr - other.m_ptr;
+  }
+
+  [[nodiscard]] auto operator[](difference_type index) const noexcept
+      -> reference {
+    return m_ptr[index];
+  }
+
+  [[nodiscard]] auto operator*() const noexcept -> reference { return *m_ptr; }
+  [[nodiscard]] auto operator->() const noexcept -> pointer { return m_ptr; }
+
+  [[nodiscard]] auto operator==(const Vector_Iterator &other) const noexcept
+      -> bool {
+    return m_ptr == other.m_ptr;
+  }
+  [[nodiscard]] auto operator!=(const Vector_Iterator &other) const noexcept
+      -> bool {
+    return m_ptr != other.m_ptr;
+  }
+  [[nodiscard]] auto operator<(const Vector_Iterator &other) const noexcept
+      -> bool {
+    return m_ptr < other.m_ptr;
+  }
+  [[nodiscard]] auto operator>(const Vector_Iterator &other) const noexcept
+      -> bool {
+    return m_ptr > other.m_ptr;
+  }
+  [[nodiscard]] auto operator<=(const Vector_Iterator &other) const noexcept
+      -> bool {
+    return m_ptr <= other.m_ptr;
+  }
+  [[nodiscard]] auto operator>=(const Vector_Iterator &other) const noexcept
+      -> bool {
+    return m_ptr >= other.m_ptr;
+  }
+
+private:
+  friend VectorType;
+
+  pointer m_ptr;
+};
+
+/**
+ * @brief Const random access iterator for Vector container
+ *
+ * @tparam VectorType The vector container type this const iterator is for
+ */
+template <typename VectorType> class cVector_Iterator {
+public:
+  using value_type = typename VectorType::value_type;
+  using pointer = const value_type *;
+  using reference = const value_type &;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::random_access_iterator_tag;
+
+public:
+  constexpr explicit cVector_Iterator(pointer ptr = nullptr) noexcept
+      : m_ptr(ptr) {}
+
+  auto operator++() noexcept -> cVector_Iterator & {
+    ++m_ptr;
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> cVector_Iterator {
+    cVector_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> cVector_Iterator & {
+    --m_ptr;
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> cVector_Iterator {
+    cVector_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator+=(difference_type n) noexcept -> cVector_Iterator & {
+    m_ptr += n;
+    return *this;
+  }
+
+  auto operator-=(difference_type n) noexcept -> cVector_Iterator & {
+    m_ptr -= n;
+    return *this;
+  }
+
+  [[nodiscard]] auto operator+(difference_type n) const noexcept
+      -> cVector_Iterator {
+    return cVector_Iterator(m_ptr + n);
+  }
+
+  [[nodiscard]] friend auto operator+(difference_type n,
+                                      const cVector_Iterator &it) noexcept
+      -> cVector_Iterator {
+    return it + n;
+  }
+
+  [[nodiscard]] auto operator-(difference_type n) const noexcept
+      -> cVector_Iterator {
+    return cVector_Iterator(m_ptr - n);
+  }
+
+  [[nodiscard]] auto operator-(const cVector_Iterator &other) const noexcept
+      -> difference_type {
+    return m_ptr - other.m_ptr;
+  }
+
+  [[nodiscard]] auto operator[](difference_type index) const noexcept
+      -> reference {
+    return m_ptr[index];
+  }
+
+  [[nodiscard]] auto operator*() const noexcept -> reference { return *m_ptr; }
+  [[nodiscard]] auto operator->() const noexcept -> pointer { return m_ptr; }
+
+  [[nodiscard]] auto operator==(const cVector_Iterator &other) const noexcept
+      -> bool {
+    return m_ptr == other.m_ptr;
+  }
+  [[nodiscard]] auto operator!=(const cVector_Iterator &other) const noexcept
+      -> bool {
+    return m_ptr != other.m_ptr;
+  }
+  [[nodiscard]] auto operator<(const cVector_Iterator &other) const noexcept
+      -> bool {
+    return m_ptr < other.m_ptr;
+  }
+  [[nodiscard]] auto operator>(const cVector_Iterator &other) const noexcept
+      -> bool {
+    return m_ptr > other.m_ptr;
+  }
+  [[nodiscard]] auto operator<=(const cVector_Iterator &other) const noexcept
+      -> bool {
+    return m_ptr <= other.m_ptr;
+  }
+  [[nodiscard]] auto operator>=(const cVector_Iterator &other) const noexcept
+      -> bool {
+    return m_ptr >= other.m_ptr;
+  }
+
+private:
+  pointer m_ptr;
+};
+
+/**
+ * @brief Dynamically sized array with a configurable growth policy
+ *
+ * @tparam ValueType The type of elements stored in the vector
+ * @tparam Growth Policy with static next_capacity(capacity, required)
+ *
+ * @requires ValueType must not be over-aligned, since malloc and realloc
+ * only guarantee alignof(std::max_align_t)
+ *
+ * Storage is raw malloc memory. When ValueType is trivially relocatable,
+ * growth goes through realloc (which can extend in place) and inserts shift
+ * elements with memmove; other types are moved element by element, falling
+ * back to copies when their move constructor may throw, so growth keeps the
+ * strong exception guarantee.
+ *
+ * Complexity guarantees:
+ * - operator[], front(), back(): O(1)
+ * - push_back(), emplace_back(): O(1) amortized
+ * - pop_back(): O(1)
+ * - insert(pos, first, last): O(n + k), at most one reallocation for
+ *   forward iterators
+ * - insert(pos, value), emplace(pos, args), erase(pos): O(n)
+ * - reserve(), shrink_to_fit(): O(n)
+ * - size(), capacity(), empty(): O(1)
+ * - begin(), end(): O(1)
+ *
+ * @example
+ * Vector<int, GoldenGrowth> vector;
+ * vector.reserve(3);
+ * vector.push_back(1);
+ * vector.insert(vector.end(), {2, 3});
+ * assert(vector.back() == 3);
+ */
+template <typename ValueType, typename Growth = DoublingGrowth> class Vector {
+  static_assert(alignof(ValueType) <= alignof(std::max_align_t),
+                "Over-aligned element types are not supported");
+
+public:
+  using value_type = ValueType;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using iterator = Vector_Iterator<Vector>;
+  using const_iterator = cVector_Iterator<Vector>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using growth_policy = Growth;
+
+private:
+  pointer m_data{nullptr};
+  size_type m_size{0};
+  size_type m_capacity{0};
+
+public:
+  // Constructors
+  Vector() noexcept = default;
+
+  explicit Vector(size_type count) { resize(count); }
+
+  Vector(size_type count, const value_type &value) { resize(count, value); }
+
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  Vector(InputIt first, InputIt last) {
+    insert(end(), first, last);
+  }
+
+  Vector(std::initializer_list<value_type> init_list)
+      : Vector(init_list.begin(), init_list.end()) {}
+
+  Vector(const Vector &other) : Vector(other.cbegin(), other.cend()) {}
+
+  Vector(Vector &&other) noexcept { swap(other); }
+
+  auto operator=(const Vector &other) -> Vector & {
+    if (this != &other) {
+      Vector temp(other);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  auto operator=(Vector &&other) noexcept -> Vector & {
+    if (this != &other) {
+      Vector temp(std::move(other));
+      swap(temp);
+    }
+    return *this;
+  }
+
+  ~Vector() {
+    std::destroy(m_data, m_data + m_size);
+    details::free_elements(m_data);
+  }
+
+  // Element access
+  [[nodiscard]] auto operator[](size_type idx) -> reference {
+    if (idx >= m_size) {
+      throw std::out_of_range("Vector index out of bounds");
+    }
+    return m_data[idx];
+  }
+
+  [[nodiscard]] auto operator[](size_type idx) const -> const_reference {
+    if (idx >= m_size) {
+      throw std::out_of_range("Vector index out of bounds");
+    }
+    return m_data[idx];
+  }
+
+  [[nodiscard]] auto front() -> reference {
+    if (empty()) {
+      throw std::out_of_range("Cannot access front of empty vector");
+    }
+    return m_data[0];
+  }
+
+  [[nodiscard]] auto front() const -> const_reference {
+    if (empty()) {
+      throw std::out_of_range("Cannot access front of empty vector");
+    }
+    return m_data[0];
+  }
+
+  [[nodiscard]] auto back() -> reference {
+    if (empty()) {
+      throw std::out_of_range("Cannot access back of empty vector");
+    }
+    return m_data[m_size - 1];
+  }
+
+  [[nodiscard]] auto back() const -> const_reference {
+    if (empty()) {
+      throw std::out_of_range("Cannot access back of empty vector");
+    }
+    return m_data[m_size - 1];
+  }
+
+  [[nodiscard]] auto data() noexcept -> pointer { return m_data; }
+  [[nodiscard]] auto data() const noexcept -> const_pointer { return m_data; }
+
+  // Capacity
+  [[nodiscard]] auto empty() const noexcept -> bool { return m_size == 0; }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return empty(); }
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] auto capacity() const noexcept -> size_type {
+    return m_capacity;
+  }
+  [[nodiscard]] constexpr auto max_size() const noexcept -> size_type {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+  }
+
+  /**
+   * @brief Grows the capacity to exactly new_capacity if it is larger.
+   */
+  auto reserve(size_type new_capacity) -> void {
+    if (new_capacity > m_capacity) {
+      reallocate(new_capacity);
+    }
+  }
+
+  /**
+   * @brief Releases unused capacity.
+   */
+  auto shrink_to_fit() -> void {
+    if (m_capacity > m_size) {
+      reallocate(m_size);
+    }
+  }
+
+  // Modifiers
+  auto push_back(const value_type &value) -> void { emplace_back(value); }
+  auto push_back(value_type &&value) -> void { emplace_back(std::move(value)); }
+
+  template <typename... Args> auto emplace_back(Args &&...args) -> reference {
+    if (m_size == m_capacity) {
+      return emplace_back_grow(std::forward<Args>(args)...);
+    }
+    ::new (static_cast<void *>(m_data + m_size))
+        value_type(std::forward<Args>(args)...);
+    return m_data[m_size++];
+  }
+
+  auto pop_back() -> void {
+    if (empty()) {
+      throw std::out_of_range("Cannot pop from empty vector");
+    }
+    std::destroy_at(m_data + --m_size);
+  }
+
+  auto insert(iterator pos, const value_type &value) -> iterator {
+    return emplace(pos, value);
+  }
+
+  auto insert(iterator pos, value_type &&value) -> iterator {
+    return emplace(pos, std::move(value));
+  }
+
+  auto insert(iterator pos, std::initializer_list<value_type> init_list)
+      -> iterator {
+    return insert(pos, init_list.begin(), init_list.end());
+  }
+
+  /**
+   * @brief Inserts [first, last) before pos.
+   *
+   * Forward iterator ranges are measured first, so the vector reallocates
+   * at most once and the new elements are constructed directly in place.
+   *
+   * @return iterator to the first inserted element
+   */
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  auto insert(iterator pos, InputIt first, InputIt last) -> iterator {
+    const size_type offset = index_of(pos);
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      const auto count = static_cast<size_type>(std::distance(first, last));
+      insert_counted(offset, first, last, count);
+    } else {
+      const size_type old_size = m_size;
+      try {
+        for (; first != last; ++first) {
+          emplace_back(*first);
+        }
+      } catch (...) {
+        std::destroy(m_data + old_size, m_data + m_size);
+        m_size = old_size;
+        throw;
+      }
+      std::rotate(m_data + offset, m_data + old_size, m_data + m_size);
+    }
+    return iterator(m_data + offset);
+  }
+
+  /**
+   * @brief Constructs an element from args before pos.
+   *
+   * @return iterator to the new element
+   */
+  template <typename... Args>
+  auto emplace(iterator pos, Args &&...args) -> iterator {
+    const size_type offset = index_of(pos);
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      value_type value(std::forward<Args>(args)...);
+      reserve_for(m_size + 1);
+      std::memmove(static_cast<void *>(m_data + offset + 1),
+                   static_cast<const void *>(m_data + offset),
+                   (m_size - offset) * sizeof(value_type));
+      ::new (static_cast<void *>(m_data + offset))
+          value_type(std::move(value));
+      ++m_size;
+    } else {
+      emplace_back(std::forward<Args>(args)...);
+      std::rotate(m_data + offset, m_data + m_size - 1, m_data + m_size);
+    }
+    return iterator(m_data + offset);
+  }
+
+  /**
+   * @return iterator following the removed element
+   * @throws std::out_of_range if pos is end()
+   */
+  auto erase(iterator pos) -> iterator {
+    if (pos == end()) {
+      throw std::out_of_range("Cannot erase end iterator");
+    }
+    return erase(pos, pos + 1);
+  }
+
+  auto erase(iterator first, iterator last) -> iterator {
+    if (first != last) {
+      pointer new_end = std::move(last.m_ptr, m_data + m_size, first.m_ptr);
+      std::destroy(new_end, m_data + m_size);
+      m_size = static_cast<size_type>(new_end - m_data);
+    }
+    return first;
+  }
+
+  auto resize(size_type count) -> void { resize_with(count); }
+
+  auto resize(size_type count, const value_type &value) -> void {
+    if (count > m_capacity) {
+      // value may name an element, which growing relocates.
+      const value_type copy(value);
+      resize_with(count, copy);
+    } else {
+      resize_with(count, value);
+    }
+  }
+
+  auto clear() noexcept -> void {
+    std::destroy(m_data, m_data + m_size);
+    m_size = 0;
+  }
+
+  // Iterators
+  [[nodiscard]] auto begin() noexcept -> iterator { return iterator(m_data); }
+  [[nodiscard]] auto end() noexcept -> iterator {
+    return iterator(m_data + m_size);
+  }
+  [[nodiscard]] auto begin() const noexcept -> const_iterator {
+    return const_iterator(m_data);
+  }
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return const_iterator(m_data + m_size);
+  }
+  [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+    return begin();
+  }
+  [[nodiscard]] auto cend() const noexcept -> const_iterator { return end(); }
+
+private:
+  auto swap(Vector &other) noexcept -> void {
+    using std::swap;
+    swap(m_data, other.m_data);
+    swap(m_size, other.m_size);
+    swap(m_capacity, other.m_capacity);
+  }
+
+  auto index_of(iterator pos) const -> size_type {
+    if (pos.m_ptr < m_data || pos.m_ptr > m_data + m_size) {
+      throw std::out_of_range("Iterator does not belong to vector");
+    }
+    return static_cast<size_type>(pos.m_ptr - m_data);
+  }
+
+  auto reserve_for(size_type required) -> void {
+    if (required > m_capacity) {
+      reallocate(Growth::next_capacity(m_capacity, required));
+    }
+  }
+
+  // Moves the elements to storage of exactly new_capacity >= m_size.
+  auto reallocate(size_type new_capacity) -> void {
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      if (new_capacity == 0) {
+        details::free_elements(m_data);
+        m_data = nullptr;
+      } else {
+        if (new_capacity > max_size()) {
+          throw std::length_error("Vector capacity exceeds maximum size");
+        }
+        void *block =
+            std::realloc(static_cast<void *>(m_data),
+                         new_capacity * sizeof(value_type));
+        if (block == nullptr) {
+          throw std::bad_alloc();
+        }
+        m_data = static_cast<pointer>(block);
+      }
+    } else {
+      pointer buffer = new_capacity == 0
+                           ? nullptr
+                           : details::allocate_elements<value_type>(new_capacity);
+      try {
+        details::move_into(m_data, m_size, buffer);
+      } catch (...) {
+        details::free_elements(buffer);
+        throw;
+      }
+      adopt(buffer);
+    }
+    m_capacity = new_capacity;
+  }
+
+  // Replaces the storage with buffer, which already holds the elements.
+  auto adopt(pointer buffer) noexcept -> void {
+    details::release_relocated(m_data, m_data + m_size);
+    details::free_elements(m_data);
+    m_data = buffer;
+  }
+
+  template <typename... Args>
+  auto emplace_back_grow(Args &&...args) -> reference {
+    const size_type new_capacity = Growth::next_capacity(m_capacity, m_size + 1);
+    if constexpr (is_trivially_relocatable_v<value_type>) {
+      // args may refer into the current buffer, which realloc can release.
+      value_type value(std::forward<Args>(args)...);
+      reallocate(new_capacity);
+      ::new (static_cast<void *>(m_data + m_size)) value_type(std::move(value));
+    } else {
+      pointer buffer = details::allocate_elements<value_type>(new_capacity);
+      try {
+        ::new (static_cast<void *>(buffer + m_size))
+            value_type(std::forward<Args>(args)...);
+      } catch (...) {
+        details::free_elements(buffer);
+        throw;
+      }
+      try {
+        details::move_into(m_data, m_size, buffer);
+      } catch (...) {
+        std::destroy_at(buffer + m_size);
+        details::free_elements(buffer);
+        throw;
+      }
+      adopt(buffer);
+      m_capacity = new_capacity;
+    }
+    return m_data[m_size++];
+  }
+
+  template <typename ForwardIt>
+  auto insert_counted(size_type offset, ForwardIt first, ForwardIt last,
+                      size_type count) -> void {
+    if (count == 0) {
+      return;
+    }
+    const size_type tail = m_size - offset;
+    if (m_size + count > m_capacity) {
+      const size_type new_capacity =
+          Growth::next_capacity(m_capacity, m_size + count);
+      pointer buffer = details::allocate_elements<value_type>(new_capacity);
+      try {
+        std::uninitialized_copy(first, last, buffer + offset);
+      } catch (...) {
+        details::free_elements(buffer);
+        throw;
+      }
+      try {
+        details::relocate_into(m_data, offset, buffer);
+        try {
+          details::relocate_into(m_data + offset, tail, buffer + offset + count);
+        } catch (...) {
+          std::destroy(buffer, buffer + offset);
+          throw;
+        }
+      } catch (...) {
+        std::destroy(buffer + offset, buffer + offset + count);
+        details::free_elements(buffer);
+        throw;
+      }
+      adopt(buffer);
+      m_capacity = new_capacity;
+    } else if constexpr (is_trivially_relocatable_v<value_type>) {
+      std::memmove(static_cast<void *>(m_data + offset + count),
+                   static_cast<const void *>(m_data + offset),
+                   tail * sizeof(value_type));
+      try {
+        std::uninitialized_copy(first, last, m_data + offset);
+      } catch (...) {
+        std::memmove(static_cast<void *>(m_data + offset),
+                     static_cast<const void *>(m_data + offset + count),
+                     tail * sizeof(value_type));
+        throw;
+      }
+    } else {
+      std::uninitialized_copy(first, last, m_data + m_size);
+      std::rotate(m_data + offset, m_data + m_size, m_data + m_size + count);
+    }
+    m_size += count;
+  }
+
+  template <typename... Args> auto resize_with(size_type count, Args &...args) {
+    if (count <= m_size) {
+      std::destroy(m_data + count, m_data + m_size);
+      m_size = count;
+      return;
+    }
+    reserve_for(count);
+    const size_type old_size = m_size;
+    try {
+      for (; m_size < count; ++m_size) {
+        ::new (static_cast<void *>(m_data + m_size)) value_type(args...);
+      }
+    } catch (...) {
+      std::destroy(m_data + old_size, m_data + m_size);
+      m_size = old_size;
+      throw;
+    }
+  }
+};
+
+#endif // __VECTOR_HPP__
@@ -0,0 +1,360 @@
+#ifndef __XOR_LIST_HPP__
+#define __XOR_LIST_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace details {
+/**
+ * @brief XorList node: one word holding the address of the previous node
+ * XOR the address of the next node, with nullptr encoded as 0.
+ */
+template <typename T> struct XorNode final {
+  std::uintptr_t link{0};
+  T data;
+
+  template <typename... Args>
+  explicit XorNode(std::in_place_t, Args &&...args)
+      : data(std::forward<Args>(args)...) {}
+
+  [[nodiscard]] auto neighbour(const XorNode *other) const noexcept
+      -> XorNode * {
+    return reinterpret_cast<XorNode *>(
+        link ^ reinterpret_cast<std::uintptr_t>(other));
+  }
+
+  // Replaces from with to in the link, keeping the other neighbour.
+  auto relink(const XorNode *from, const XorNode *to) noexcept -> void {
+    link ^= reinterpret_cast<std::uintptr_t>(from) ^
+            reinterpret_cast<std::uintptr_t>(to);
+  }
+};
+} // namespace details
+
+/**
+ * @brief Bidirectional iterator for XorList
+ *
+ * An XOR link can only be decoded with one neighbour known, so the iterator
+ * carries the previous node along with the current one. end() holds the back
+ * node as its previous node, which lets --end() reach the back.
+ */
+template <typename T> class XorList_Iterator {
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+  using node_pointer = details::XorNode<T> *;
+
+public:
+  constexpr explicit XorList_Iterator(node_pointer prev = nullptr,
+                                      node_pointer curr = nullptr) noexcept
+      : m_prev(prev), m_curr(curr) {}
+
+  auto operator++() noexcept -> XorList_Iterator & {
+    node_pointer next = m_curr->neighbour(m_prev);
+    m_prev = m_curr;
+    m_curr = next;
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> XorList_Iterator {
+    XorList_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> XorList_Iterator & {
+    node_pointer prev = m_prev->neighbour(m_curr);
+    m_curr = m_prev;
+    m_prev = prev;
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> XorList_Iterator {
+    XorList_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference { return m_curr->data; }
+
+  auto operator->() const noexcept -> pointer {
+    return std::addressof(m_curr->data);
+  }
+
+  auto operator==(const XorList_Iterator &other) const noexcept -> bool {
+    return m_curr == other.m_curr && m_prev == other.m_prev;
+  }
+
+  auto operator!=(const XorList_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  node_pointer m_prev;
+  node_pointer m_curr;
+};
+
+/**
+ * @brief Const bidirectional iterator for XorList
+ */
+template <typename T> class cXorList_Iterator {
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T *;
+  using reference = const T &;
+  using node_pointer = const details::XorNode<T> *;
+
+public:
+  constexpr explicit cXorList_Iterator(node_pointer prev = nullptr,
+                                       node_pointer curr = nullptr) noexcept
+      : m_prev(prev), m_curr(curr) {}
+
+  auto operator++() noexcept -> cXorList_Iterator & {
+    node_pointer next = m_curr->neighbour(m_prev);
+    m_prev = m_curr;
+    m_curr = next;
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> cXorList_Iterator {
+    cXorList_Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  auto operator--() noexcept -> cXorList_Iterator & {
+    node_pointer prev = m_prev->neighbour(m_curr);
+    m_curr = m_prev;
+    m_prev = prev;
+    return *this;
+  }
+
+  auto operator--(int) noexcept -> cXorList_Iterator {
+    cXorList_Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  auto operator*() const noexcept -> reference { return m_curr->data; }
+
+  auto operator->() const noexcept -> pointer {
+    return std::addressof(m_curr->data);
+  }
+
+  auto operator==(const cXorList_Iterator &other) const noexcept -> bool {
+    return m_curr == other.m_curr && m_prev == other.m_prev;
+  }
+
+  auto operator!=(const cXorList_Iterator &other) const noexcept -> bool {
+    return !(*this == other);
+  }
+
+private:
+  node_pointer m_prev;
+  node_pointer m_curr;
+};
+
+/**
+ * @brief Doubly linked list storing one XOR-combined link per node
+ *
+ * @tparam T The type of elements stored in the list
+ *
+ * Each node keeps prev ^ next in a single word, halving the link overhead of
+ * DoublyList. The list can be walked from either end, but a node cannot be
+ * reached from its address alone, so the list supports end operations and
+ * iteration only; there is no positional insert or erase.
+ *
+ * Complexity guarantees:
+ * - void add_front(const T& data) = O(1)
+ * - void add_back(const T& data) = O(1)
+ * - T& emplace_front(Args&&... args) = O(1)
+ * - T& emplace_back(Args&&... args) = O(1)
+ * - void remove_front() = O(1)
+ * - void remove_back() = O(1)
+ * - void reverse() = O(1)
+ * - void clear() = O(n)
+ * - const T& top() = O(1)
+ * - const T& bottom() = O(1)
+ * - size_t size() = O(1)
+ * - iterator begin(), end() = O(1)
+ */
+template <typename T> class XorList {
+private:
+  using node_type = details::XorNode<T>;
+
+  node_type *m_front{nullptr};
+  node_type *m_back{nullptr};
+  size_t m_size{0};
+
+public:
+  using iterator = XorList_Iterator<T>;
+  using const_iterator = cXorList_Iterator<T>;
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+public:
+  XorList() = default;
+
+  XorList(std::initializer_list<T> _list) {
+    for (const auto &value : _list) {
+      add_back(value);
+    }
+  }
+
+  XorList(const XorList &other) : XorList() {
+    for (const auto &value : other) {
+      add_back(value);
+    }
+  }
+
+  XorList(XorList &&other) noexcept
+      : m_front(std::exchange(other.m_front, nullptr)),
+        m_back(std::exchange(other.m_back, nullptr)),
+        m_size(std::exchange(other.m_size, 0)) {}
+
+  auto operator=(const XorList &other) -> XorList & {
+    if (this != &other) {
+      XorList temp(other);
+      swap(temp);
+    }
+    return *this;
+  }
+
+  auto operator=(XorList &&other) noexcept -> XorList & {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~XorList() noexcept { clear(); }
+
+  auto add_front(const T &data) -> void { emplace_front(data); }
+  auto add_front(T &&data) -> void { emplace_front(std::move(data)); }
+  auto add_back(const T &data) -> void { emplace_back(data); }
+  auto add_back(T &&data) -> void { emplace_back(std::move(data)); }
+
+  template <typename... Args> auto emplace_front(Args &&...args) -> reference {
+    auto *node = new node_type(std::in_place, std::forward<Args>(args)...);
+    link_end(m_front, m_back, node);
+    return node->data;
+  }
+
+  template <typename... Args> auto emplace_back(Args &&...args) -> reference {
+    auto *node = new node_type(std::in_place, std::forward<Args>(args)...);
+    link_end(m_back, m_front, node);
+    return node->data;
+  }
+
+  auto remove_front() -> void {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot remove from empty list");
+    }
+    unlink_end(m_front, m_back);
+  }
+
+  auto remove_back() -> void {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot remove from empty list");
+    }
+    unlink_end(m_back, m_front);
+  }
+
+  /**
+   * @brief Reverses the list by swapping its ends; no node is touched.
+   */
+  auto reverse() noexcept -> void { std::swap(m_front, m_back); }
+
+  auto clear() noexcept -> void {
+    node_type *prev = nullptr;
+    node_type *curr = m_front;
+    while (curr != nullptr) {
+      node_type *next = curr->neighbour(prev);
+      prev = curr;
+      delete curr;
+      curr = next;
+    }
+    m_front = m_back = nullptr;
+    m_size = 0;
+  }
+
+  [[nodiscard]] auto top() const -> const_reference {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot access top of empty list");
+    }
+    return m_front->data;
+  }
+
+  [[nodiscard]] auto bottom() const -> const_reference {
+    if (is_empty()) {
+      throw std::out_of_range("Cannot access bottom of empty list");
+    }
+    return m_back->data;
+  }
+
+  auto begin() noexcept -> iterator { return iterator(nullptr, m_front); }
+  auto end() noexcept -> iterator { return iterator(m_back, nullptr); }
+
+  auto begin() const noexcept -> const_iterator {
+    return const_iterator(nullptr, m_front);
+  }
+  auto end() const noexcept -> const_iterator {
+    return const_iterator(m_back, nullptr);
+  }
+
+  auto cbegin() const noexcept -> const_iterator { return begin(); }
+  auto cend() const noexcept -> const_iterator { return end(); }
+
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] auto is_empty() const noexcept -> bool { return m_size == 0; }
+
+private:
+  auto swap(XorList &other) noexcept -> void {
+    std::swap(m_front, other.m_front);
+    std::swap(m_back, other.m_back);
+    std::swap(m_size, other.m_size);
+  }
+
+  // Links node beyond end; other_end is the opposite end of the list.
+  auto link_end(node_type *&end, node_type *&other_end,
+                node_type *node) noexcept -> void {
+    node->link = reinterpret_cast<std::uintptr_t>(end);
+    if (end != nullptr) {
+      end->relink(nullptr, node);
+    } else {
+      other_end = node;
+    }
+    end = node;
+    ++m_size;
+  }
+
+  // Unlinks and frees the node at end; other_end is the opposite end.
+  auto unlink_end(node_type *&end, node_type *&other_end) noexcept -> void {
+    node_type *node = end;
+    node_type *next = node->neighbour(nullptr);
+    if (next != nullptr) {
+      next->relink(node, nullptr);
+    } else {
+      other_end = nullptr;
+    }
+    end = next;
+    delete node;
+    --m_size;
+  }
+};
+
+#endif // __XOR_LIST_HPP__
@@ -0,0 +1,182 @@
+#include "../include/ArrayMatrix.hpp"
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+
+// Test fixture for Matrix and ArrayMatrix
+class ArrayMatrixTest : public ::testing::Test {
+protected:
+  template <typename T>
+  static auto random_matrix(std::size_t rows, std::size_t cols,
+                            unsigned seed) -> Matrix<T> {
+    std::mt19937 rng(seed);
+    Matrix<T> result(rows, cols);
+    for (std::size_t i = 0; i < result.size(); ++i) {
+      result.data()[i] = static_cast<T>(static_cast<int>(rng() % 19) - 9);
+    }
+    return result;
+  }
+
+  template <typename T>
+  static auto naive_product(const Matrix<T> &a, const Matrix<T> &b)
+      -> Matrix<T> {
+    Matrix<T> result(a.rows(), b.cols());
+    for (std::size_t i = 0; i < a.rows(); ++i) {
+      for (std::size_t j = 0; j < b.cols(); ++j) {
+        T sum{};
+        for (std::size_t p = 0; p < a.cols(); ++p) {
+          sum += a(i, p) * b(p, j);
+        }
+        result(i, j) = sum;
+      }
+    }
+    return result;
+  }
+
+  // Small integer entries keep every float and double product exact.
+  template <typename T> static auto check_products() -> void {
+    const std::size_t shapes[][3] = {{1, 1, 1},     {7, 13, 5},
+                                     {6, 16, 8},    {13, 300, 33},
+                                     {250, 70, 40}, {5, 2, 2100}};
+    unsigned seed = 1;
+    for (const auto &shape : shapes) {
+      const auto a = random_matrix<T>(shape[0], shape[1], seed++);
+      const auto b = random_matrix<T>(shape[1], shape[2], seed++);
+      ASSERT_EQ(a * b, naive_product(a, b))
+          << shape[0] << "x" << shape[1] << "x" << shape[2];
+    }
+  }
+};
+
+// Basic Operation Tests
+TEST_F(ArrayMatrixTest, ConstructionAndAccess) {
+  Matrix<int> matrix{{1, 2, 3}, {4, 5, 6}};
+  EXPECT_EQ(matrix.rows(), 2);
+  EXPECT_EQ(matrix.cols(), 3);
+  EXPECT_EQ(matrix(1, 2), 6);
+  EXPECT_EQ(matrix.row(1)[0], 4);
+  matrix.at(0, 1) = 20;
+  EXPECT_EQ(matrix(0, 1), 20);
+  EXPECT_THROW((void)matrix.at(2, 0), std::out_of_range);
+  EXPECT_THROW((Matrix<int>{{1, 2}, {3}}), std::invalid_argument);
+
+  Matrix<double> filled(3, 4, 1.5);
+  EXPECT_EQ(filled(2, 3), 1.5);
+  filled.fill(0.0);
+  EXPECT_EQ(filled, (Matrix<double>(3, 4)));
+  EXPECT_TRUE(Matrix<float>().is_empty());
+}
+
+TEST_F(ArrayMatrixTest, ProductsMatchNaiveLoop) {
+  check_products<float>();
+  check_products<double>();
+  check_products<int>();
+  check_products<long>();
+}
+
+TEST_F(ArrayMatrixTest, IdentityAndMismatchedDimensions) {
+  const auto a = random_matrix<double>(40, 40, 3);
+  EXPECT_EQ(a * Matrix<double>::identity(40), a);
+  EXPECT_EQ(Matrix<double>::identity(40) * a, a);
+  EXPECT_THROW((void)a.multiply(Matrix<double>(39, 2)),
+               std::invalid_argument);
+  EXPECT_THROW((void)a.multiply(Vector<double>(41)), std::invalid_argument);
+}
+
+TEST_F(ArrayMatrixTest, ThreadedProductsMatchSerial) {
+  const auto a = random_matrix<float>(700, 90, 5);
+  const auto b = random_matrix<float>(90, 50, 6);
+  const auto serial = a.multiply(b);
+  EXPECT_EQ(a.multiply(b, 4), serial);
+  EXPECT_EQ(a.multiply(b, 64), serial);
+
+  Vector<float> x(90);
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    x.data()[i] = static_cast<float>(i % 7) - 3.0F;
+  }
+  const auto y = a.multiply(x);
+  const auto threaded = a.multiply(x, 3);
+  ASSERT_EQ(y.size(), 700);
+  for (std::size_t r = 0; r < 700; ++r) {
+    float expected = 0;
+    for (std::size_t c = 0; c < 90; ++c) {
+      expected += a(r, c) * x.data()[c];
+    }
+    ASSERT_EQ(y.data()[r], expected);
+    ASSERT_EQ(threaded.data()[r], expected);
+  }
+}
+
+TEST_F(ArrayMatrixTest, MatrixVectorProducts) {
+  for (std::size_t cols : {1, 3, 8, 37}) {
+    const auto a = random_matrix<double>(11, cols, 9);
+    const auto column = random_matrix<double>(cols, 1, 10);
+    Vector<double> x(column.data(), column.data() + cols);
+    const auto y = a * x;
+    const auto expected = naive_product(a, column);
+    EXPECT_EQ(a * column, expected);
+    for (std::size_t r = 0; r < 11; ++r) {
+      EXPECT_EQ(y.data()[r], expected(r, 0));
+    }
+  }
+}
+
+TEST_F(ArrayMatrixTest, Transpose) {
+  const auto a = random_matrix<float>(37, 70, 11);
+  const auto t = a.transpose();
+  ASSERT_EQ(t.rows(), 70);
+  ASSERT_EQ(t.cols(), 37);
+  for (std::size_t i = 0; i < 37; ++i) {
+    for (std::size_t j = 0; j < 70; ++j) {
+      ASSERT_EQ(t(j, i), a(i, j));
+    }
+  }
+  EXPECT_EQ(t.transpose(), a);
+}
+
+// ArrayMatrix Tests
+TEST_F(ArrayMatrixTest, FixedSizeMatrix) {
+  ArrayMatrix<double, 2, 3> a{{1, 2, 3}, {4, 5, 6}};
+  ArrayMatrix<double, 3, 1> x{{1}, {1}, {1}};
+  const ArrayMatrix<double, 2, 1> y = a * x;
+  EXPECT_EQ(y(0, 0), 6);
+  EXPECT_EQ(y(1, 0), 15);
+
+  const ArrayMatrix<double, 3, 2> t = a.transpose();
+  EXPECT_EQ(t(2, 1), 6);
+  const ArrayMatrix<double, 2, 2> square = a.multiply(t, 2);
+  EXPECT_EQ(square, (ArrayMatrix<double, 2, 2>{{14, 32}, {32, 77}}));
+  EXPECT_EQ((square * ArrayMatrix<double, 2, 2>::identity()), square);
+
+  ArrayMatrix<int, 2, 2> partial{{7}};
+  EXPECT_EQ(partial(0, 0), 7);
+  EXPECT_EQ(partial(1, 1), 0);
+  EXPECT_THROW((void)partial.at(0, 2), std::out_of_range);
+  EXPECT_THROW((ArrayMatrix<int, 1, 2>{{1, 2, 3}}), std::length_error);
+  EXPECT_THROW((ArrayMatrix<int, 1, 2>{{1}, {2}}), std::length_error);
+  EXPECT_EQ((ArrayMatrix<int, 3, 4>::size()), 12);
+}
+
+TEST_F(ArrayMatrixTest, MovedFromMatricesStayUsable) {
+  Matrix<float> a{{1, 2}, {3, 4}};
+  Matrix<float> b(std::move(a));
+  EXPECT_EQ(b(1, 0), 3);
+  EXPECT_EQ(a.rows(), 0);
+  EXPECT_EQ(a.cols(), 0);
+  EXPECT_EQ(a, Matrix<float>());
+  EXPECT_NE(a, Matrix<float>(0, 2));
+  EXPECT_EQ(a.transpose(), Matrix<float>());
+  a = std::move(b);
+  EXPECT_EQ(b, Matrix<float>());
+  EXPECT_EQ(a(1, 1), 4);
+
+  ArrayMatrix<int, 2, 2> c{{1, 2}, {3, 4}};
+  ArrayMatrix<int, 2, 2> d(std::move(c));
+  EXPECT_EQ(d(1, 0), 3);
+  EXPECT_EQ(c, (ArrayMatrix<int, 2, 2>()));
+  EXPECT_EQ(c.transpose()(1, 0), 0);
+  c = std::move(d);
+  EXPECT_EQ(c(1, 1), 4);
+  EXPECT_EQ(d, (ArrayMatrix<int, 2, 2>()));
+}
@@ -0,0 +1,202 @@
+#include "../include/ConcurrentHashMap.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+// Two copies of one number: a torn optimistic read would see them differ.
+struct Pair {
+  std::uint64_t first;
+  std::uint64_t second;
+};
+
+// Sends every key to one of four hash values to force long probe runs.
+struct CollidingHash {
+  auto operator()(int key) const noexcept -> std::size_t {
+    return static_cast<std::size_t>(key % 4);
+  }
+};
+} // namespace
+
+// Test fixture for ConcurrentHashMap
+class ConcurrentHashMapTest : public ::testing::Test {
+protected:
+  ConcurrentHashMap<std::uint64_t, std::uint64_t> int_map{8};
+  ConcurrentHashMap<std::string, std::string> string_map{4};
+};
+
+// Basic Operation Tests
+TEST_F(ConcurrentHashMapTest, ShardCountAndReadMode) {
+  EXPECT_EQ(int_map.shard_count(), 8);
+  EXPECT_EQ((ConcurrentHashMap<int, int>(5).shard_count()), 8);
+  EXPECT_THROW((ConcurrentHashMap<int, int>(0)), std::invalid_argument);
+  EXPECT_TRUE((ConcurrentHashMap<int, Pair>::optimistic_reads));
+  EXPECT_FALSE((ConcurrentHashMap<std::string, int>::optimistic_reads));
+}
+
+TEST_F(ConcurrentHashMapTest, InsertGetEraseUpdate) {
+  EXPECT_TRUE(int_map.is_empty());
+  EXPECT_FALSE(int_map.get(1).has_value());
+  EXPECT_TRUE(int_map.insert(1, 10));
+  EXPECT_FALSE(int_map.insert(1, 11));
+  EXPECT_EQ(int_map.get(1), 10U);
+  EXPECT_FALSE(int_map.insert_or_assign(1, 12));
+  EXPECT_TRUE(int_map.insert_or_assign(2, 20));
+  EXPECT_TRUE(int_map.update(2, [](std::uint64_t &value) { value += 1; }));
+  EXPECT_FALSE(int_map.update(3, [](std::uint64_t &value) { value += 1; }));
+  EXPECT_EQ(int_map.get(2), 21U);
+  EXPECT_EQ(int_map.size(), 2);
+  EXPECT_TRUE(int_map.erase(1));
+  EXPECT_FALSE(int_map.erase(1));
+  EXPECT_FALSE(int_map.contains(1));
+  EXPECT_TRUE(int_map.contains(2));
+}
+
+TEST_F(ConcurrentHashMapTest, LockedReadsForStrings) {
+  for (int i = 0; i < 1000; ++i) {
+    string_map.insert(std::to_string(i), std::string(10, 'a' + i % 26));
+  }
+  EXPECT_EQ(string_map.size(), 1000);
+  EXPECT_EQ(string_map.get("27"), std::string(10, 'b'));
+  EXPECT_TRUE(string_map.erase("27"));
+  EXPECT_FALSE(string_map.get("27").has_value());
+  string_map.clear();
+  EXPECT_TRUE(string_map.is_empty());
+  EXPECT_FALSE(string_map.contains("1"));
+  EXPECT_TRUE(string_map.insert("1", "again"));
+}
+
+TEST_F(ConcurrentHashMapTest, CollidingKeysMatchReference) {
+  ConcurrentHashMap<int, int, CollidingHash> map(2);
+  std::map<int, int> reference;
+  std::mt19937 rng(5);
+  for (int step = 0; step < 20000; ++step) {
+    const int key = static_cast<int>(rng() % 500);
+    if (rng() % 3 == 0) {
+      ASSERT_EQ(map.erase(key), reference.erase(key) == 1);
+    } else {
+      map.insert_or_assign(key, step);
+      reference[key] = step;
+    }
+  }
+  ASSERT_EQ(map.size(), reference.size());
+  for (const auto &[key, value] : reference) {
+    ASSERT_EQ(map.get(key), value);
+  }
+}
+
+TEST_F(ConcurrentHashMapTest, ComputeIfAbsentRunsOnce) {
+  int calls = 0;
+  auto make = [&](std::uint64_t key) {
+    ++calls;
+    return key * 3;
+  };
+  EXPECT_EQ(int_map.compute_if_absent(5, make), 15U);
+  EXPECT_EQ(int_map.compute_if_absent(5, make), 15U);
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(string_map.compute_if_absent(
+                "k", [](const std::string &key) { return key + key; }),
+            "kk");
+}
+
+// Iteration Tests
+TEST_F(ConcurrentHashMapTest, ParallelForEachVisitsEveryEntry) {
+  for (std::uint64_t i = 0; i < 10000; ++i) {
+    int_map.insert(i, i * 2);
+  }
+  std::atomic<std::uint64_t> sum{0};
+  std::atomic<std::size_t> visited{0};
+  int_map.parallel_for_each(
+      [&](std::uint64_t key, std::uint64_t value) {
+        sum += value - key;
+        ++visited;
+      },
+      4);
+  EXPECT_EQ(visited.load(), 10000);
+  EXPECT_EQ(sum.load(), 9999U * 10000 / 2);
+
+  std::size_t sequential = 0;
+  int_map.for_each([&](std::uint64_t, std::uint64_t) { ++sequential; });
+  EXPECT_EQ(sequential, 10000);
+
+  EXPECT_THROW(int_map.parallel_for_each(
+                   [](std::uint64_t key, std::uint64_t) {
+                     if (key == 77) {
+                       throw std::runtime_error("stop");
+                     }
+                   },
+                   3),
+               std::runtime_error);
+}
+
+// Concurrency Tests
+TEST_F(ConcurrentHashMapTest, OptimisticReadsNeverSeeTornValues) {
+  ConcurrentHashMap<std::uint64_t, Pair> map(4);
+  constexpr std::uint64_t keys = 512;
+  for (std::uint64_t key = 0; key < keys; ++key) {
+    map.insert(key, Pair{0, 0});
+  }
+  std::atomic<bool> stop{false};
+  std::atomic<std::size_t> torn{0};
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 3; ++t) {
+    readers.emplace_back([&, t]() {
+      std::mt19937_64 rng(static_cast<unsigned>(t));
+      while (!stop.load()) {
+        const auto value = map.get(rng() % keys);
+        if (value && value->first != value->second) {
+          ++torn;
+        }
+      }
+    });
+  }
+  std::mt19937_64 rng(99);
+  for (std::uint64_t step = 1; step < 100000; ++step) {
+    const std::uint64_t key = rng() % keys;
+    if (step % 7 == 0) {
+      // Erasing and reinserting shifts neighbouring slots and regrows.
+      map.erase(key);
+      map.insert(key + keys * (step % 3), Pair{step, step});
+    } else {
+      map.insert_or_assign(key, Pair{step, step});
+    }
+  }
+  stop = true;
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(torn.load(), 0);
+}
+
+TEST_F(ConcurrentHashMapTest, ConcurrentWritersAndComputeIfAbsent) {
+  constexpr int threads = 4;
+  constexpr std::uint64_t per_thread = 5000;
+  std::atomic<int> computed{0};
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t]() {
+      for (std::uint64_t i = 0; i < per_thread; ++i) {
+        int_map.insert(t * per_thread + i, i);
+        int_map.compute_if_absent(1000000 + i % 100, [&](std::uint64_t key) {
+          ++computed;
+          return key;
+        });
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  EXPECT_EQ(int_map.size(), threads * per_thread + 100);
+  EXPECT_EQ(computed.load(), 100);
+  for (int t = 0; t < threads; ++t) {
+    for (std::uint64_t i = 0; i < per_thread; i += 97) {
+      ASSERT_EQ(int_map.get(t * per_thread + i), i);
+    }
+  }
+}
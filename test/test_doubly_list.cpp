@@ -1,7 +1,9 @@
 #include "../include/DoublyList.hpp"
 #include <gtest/gtest.h>
+#include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 class DoublyListTest : public ::testing::Test {
 protected:
@@ -281,4 +283,416 @@ TEST_F(DoublyListTest, TypeRequirements) {
                 "DoublyList must be copy assignable");
   static_assert(std::is_move_assignable_v<DoublyList<int>>,
                 "DoublyList must be move assignable");
-}
\ No newline at end of file
+}
+// Sort, Merge, Splice and Reverse Tests
+TEST_F(DoublyListTest, Sort_OrdersElementsAndKeepsBackwardLinks) {
+  DoublyList<int> list{5, 3, 9, 1, 7, 2, 8};
+  list.sort();
+
+  int expected[] = {1, 2, 3, 5, 7, 8, 9};
+  size_t i = 0;
+  for (const auto &value : list) {
+    EXPECT_EQ(value, expected[i++]);
+  }
+  EXPECT_EQ(i, 7);
+
+  auto it = list.end();
+  for (size_t j = 7; j > 0; --j) {
+    --it;
+    EXPECT_EQ(*it, expected[j - 1]);
+  }
+  EXPECT_EQ(list.top(), 1);
+  EXPECT_EQ(list.bottom(), 9);
+}
+
+TEST_F(DoublyListTest, Sort_WithComparator_IsStable) {
+  DoublyList<std::pair<int, int>> list{
+      {2, 0}, {1, 1}, {2, 2}, {1, 3}, {0, 4}};
+  list.sort([](const auto &a, const auto &b) { return a.first < b.first; });
+
+  std::pair<int, int> expected[] = {{0, 4}, {1, 1}, {1, 3}, {2, 0}, {2, 2}};
+  size_t i = 0;
+  for (const auto &value : list) {
+    EXPECT_EQ(value, expected[i++]);
+  }
+}
+
+TEST_F(DoublyListTest, Merge_CombinesSortedLists) {
+  DoublyList<int> list1{1, 4, 6};
+  DoublyList<int> list2{2, 3, 5, 7};
+  list1.merge(list2);
+
+  EXPECT_TRUE(list2.is_empty());
+  EXPECT_EQ(list1.size(), 7);
+  int expected = 1;
+  for (const auto &value : list1) {
+    EXPECT_EQ(value, expected++);
+  }
+  EXPECT_EQ(list1.bottom(), 7);
+  auto it = list1.end();
+  --it;
+  EXPECT_EQ(*--it, 6);
+}
+
+TEST_F(DoublyListTest, Splice_MovesWholeList) {
+  DoublyList<int> list1{1, 5};
+  DoublyList<int> list2{2, 3, 4};
+
+  auto pos = list1.begin();
+  ++pos;
+  list1.splice(pos, list2);
+
+  EXPECT_TRUE(list2.is_empty());
+  EXPECT_EQ(list1.size(), 5);
+  int expected = 1;
+  for (const auto &value : list1) {
+    EXPECT_EQ(value, expected++);
+  }
+
+  DoublyList<int> empty;
+  empty.splice(empty.end(), list1);
+  EXPECT_EQ(empty.size(), 5);
+  EXPECT_EQ(empty.top(), 1);
+  EXPECT_EQ(empty.bottom(), 5);
+}
+
+TEST_F(DoublyListTest, Splice_MovesSingleElement) {
+  DoublyList<int> list{1, 2, 3};
+
+  auto it = list.end();
+  --it;
+  list.splice(list.begin(), list, it); // [3, 1, 2]
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(list.top(), 3);
+  EXPECT_EQ(list.bottom(), 2);
+
+  DoublyList<int> other{9};
+  list.splice(list.end(), other, other.begin()); // [3, 1, 2, 9]
+  EXPECT_TRUE(other.is_empty());
+  EXPECT_EQ(list.size(), 4);
+  EXPECT_EQ(list.bottom(), 9);
+}
+
+TEST_F(DoublyListTest, Splice_MovesRange) {
+  DoublyList<int> list1{1, 5};
+  DoublyList<int> list2{0, 2, 3, 4, 9};
+
+  auto first = list2.begin();
+  ++first;
+  auto last = list2.end();
+  --last;
+  auto pos = list1.end();
+  --pos;
+  list1.splice(pos, list2, first, last);
+
+  EXPECT_EQ(list1.size(), 5);
+  EXPECT_EQ(list2.size(), 2);
+  int expected = 1;
+  for (const auto &value : list1) {
+    EXPECT_EQ(value, expected++);
+  }
+  EXPECT_EQ(list2.top(), 0);
+  EXPECT_EQ(list2.bottom(), 9);
+}
+
+TEST_F(DoublyListTest, Reverse_ReversesOrder) {
+  DoublyList<int> list{1, 2, 3, 4};
+  list.reverse();
+
+  int expected = 4;
+  for (const auto &value : list) {
+    EXPECT_EQ(value, expected--);
+  }
+  EXPECT_EQ(list.top(), 4);
+  EXPECT_EQ(list.bottom(), 1);
+
+  auto it = list.end();
+  --it;
+  EXPECT_EQ(*it, 1);
+}
+
+// Positional Insert and Erase Tests
+TEST_F(DoublyListTest, Insert_PlacesElementBeforePosition) {
+  DoublyList<int> list{1, 3};
+
+  auto pos = list.begin();
+  ++pos;
+  auto it = list.insert(pos, 2);
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(*++it, 3);
+
+  list.insert(list.begin(), 0);
+  list.insert(list.end(), 4);
+
+  EXPECT_EQ(list.size(), 5);
+  int expected = 0;
+  for (const auto &value : list) {
+    EXPECT_EQ(value, expected++);
+  }
+  EXPECT_EQ(list.top(), 0);
+  EXPECT_EQ(list.bottom(), 4);
+}
+
+TEST_F(DoublyListTest, Emplace_ConstructsInPlace) {
+  DoublyList<std::string> list;
+  auto it = list.emplace(list.end(), 3, 'a');
+  EXPECT_EQ(*it, "aaa");
+
+  list.emplace(list.begin(), "front");
+  EXPECT_EQ(list.size(), 2);
+  EXPECT_EQ(list.top(), "front");
+  EXPECT_EQ(list.bottom(), "aaa");
+}
+
+TEST_F(DoublyListTest, Erase_RemovesElementAndReturnsNext) {
+  DoublyList<int> list{1, 2, 3};
+
+  auto it = list.begin();
+  ++it;
+  it = list.erase(it); // [1, 3]
+  EXPECT_EQ(*it, 3);
+  EXPECT_EQ(list.size(), 2);
+
+  it = list.erase(it); // [1]
+  EXPECT_EQ(it, list.end());
+  EXPECT_EQ(list.bottom(), 1);
+  --it;
+  EXPECT_EQ(*it, 1);
+
+  it = list.erase(list.begin());
+  EXPECT_EQ(it, list.end());
+  EXPECT_TRUE(list.is_empty());
+  EXPECT_THROW(list.erase(list.end()), std::out_of_range);
+}
+
+TEST_F(DoublyListTest, EraseRange_RemovesHalfOpenRange) {
+  DoublyList<int> list{1, 2, 3, 4, 5};
+
+  auto first = list.begin();
+  ++first;
+  auto last = first;
+  ++last;
+  ++last;
+  auto it = list.erase(first, last); // [1, 4, 5]
+  EXPECT_EQ(*it, 4);
+  EXPECT_EQ(list.size(), 3);
+
+  it = list.erase(it, list.end()); // [1]
+  EXPECT_EQ(it, list.end());
+  EXPECT_EQ(list.size(), 1);
+  EXPECT_EQ(list.bottom(), 1);
+}
+
+TEST_F(DoublyListTest, EraseIf_RemovesMatchingElementsInOnePass) {
+  DoublyList<int> list{1, 2, 3, 4, 5, 6};
+
+  auto removed = list.erase_if([](int value) { return value % 2 == 0; });
+  EXPECT_EQ(removed, 3);
+  EXPECT_EQ(list.size(), 3);
+
+  int expected = 1;
+  for (const auto &value : list) {
+    EXPECT_EQ(value, expected);
+    expected += 2;
+  }
+  EXPECT_EQ(list.bottom(), 5);
+
+  EXPECT_EQ(list.erase_if([](int) { return true; }), 3);
+  EXPECT_TRUE(list.is_empty());
+}
+
+// Move and Emplace Tests
+namespace {
+struct Tracked {
+  static inline int copies = 0;
+  static inline int moves = 0;
+
+  std::string value;
+
+  Tracked() = default;
+  explicit Tracked(std::string v) : value(std::move(v)) {}
+  Tracked(std::size_t count, char c) : value(count, c) {}
+  Tracked(const Tracked &other) : value(other.value) { ++copies; }
+  Tracked(Tracked &&other) noexcept : value(std::move(other.value)) {
+    ++moves;
+  }
+
+  static auto reset() -> void { copies = moves = 0; }
+};
+} // namespace
+
+TEST_F(DoublyListTest, AddRvalue_MovesWithoutCopy) {
+  DoublyList<Tracked> list;
+  Tracked::reset();
+
+  list.add(Tracked("moved"));
+  list.add_front(Tracked("front"));
+  list.add_back(Tracked("back"));
+
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(Tracked::moves, 3);
+  EXPECT_EQ(list.top().value, "front");
+  EXPECT_EQ(list.bottom().value, "back");
+}
+
+TEST_F(DoublyListTest, Emplace_ConstructsInsideNode) {
+  DoublyList<Tracked> list;
+  Tracked::reset();
+
+  auto &back = list.emplace_back(64, 'x');
+  auto &front = list.emplace_front("front");
+
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(Tracked::moves, 0);
+  EXPECT_EQ(back.value, std::string(64, 'x'));
+  EXPECT_EQ(front.value, "front");
+  EXPECT_EQ(list.size(), 2);
+}
+
+TEST_F(DoublyListTest, InitializerList_CopiesEachElementOnce) {
+  Tracked::reset();
+  DoublyList<Tracked> list{Tracked("a"), Tracked("b"), Tracked("c")};
+
+  EXPECT_EQ(Tracked::copies, 3);
+  EXPECT_EQ(list.size(), 3);
+}
+
+TEST_F(DoublyListTest, NonDefaultConstructibleElements_AreSupported) {
+  struct Point {
+    Point(int x, int y) : x(x), y(y) {}
+    int x;
+    int y;
+  };
+  DoublyList<Point> list;
+  list.emplace_back(1, 2);
+  list.emplace_front(0, 1);
+  list.add(Point(2, 3));
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(list.top().x, 0);
+  EXPECT_EQ(list.bottom().y, 3);
+}
+
+TEST_F(DoublyListTest, MoveOnlyElements_AreSupported) {
+  DoublyList<std::unique_ptr<int>> list;
+  list.add(std::make_unique<int>(3));
+  list.emplace_back(new int(1));
+  list.emplace_front(std::make_unique<int>(2));
+
+  list.sort([](const auto &a, const auto &b) { return *a < *b; });
+
+  int expected = 1;
+  for (const auto &value : list) {
+    EXPECT_EQ(*value, expected++);
+  }
+  EXPECT_EQ(*list.top(), 1);
+  EXPECT_EQ(*list.bottom(), 3);
+
+  DoublyList<std::unique_ptr<int>> moved(std::move(list));
+  EXPECT_EQ(moved.size(), 3);
+}
+
+// Sentinel Layout and Iterator Checking Tests
+TEST_F(DoublyListTest, SentinelLayout_EndDecrementsToBackAfterMutation) {
+  DoublyList<int> list{1, 2};
+
+  list.add_back(3);
+  auto it = list.end();
+  EXPECT_EQ(*--it, 3);
+
+  list.reverse();
+  it = list.end();
+  EXPECT_EQ(*--it, 1);
+
+  DoublyList<int> moved(std::move(list));
+  it = moved.end();
+  EXPECT_EQ(*--it, 1);
+  EXPECT_EQ(list.begin(), list.end());
+
+  moved.clear();
+  EXPECT_EQ(moved.begin(), moved.end());
+  moved.add(7);
+  it = moved.end();
+  EXPECT_EQ(*--it, 7);
+}
+
+TEST_F(DoublyListTest, IteratorCheckingPolicy_MatchesBuildMode) {
+  DoublyList<int> list{1};
+  static_assert(noexcept(*list.begin()) == !doubly_list_checked_iterators,
+                "Unchecked iterators must not throw");
+  static_assert(noexcept(++list.begin()) == !doubly_list_checked_iterators,
+                "Unchecked iterators must not throw");
+
+#if DOUBLY_LIST_CHECKED_ITERATORS
+  EXPECT_THROW(static_cast<void>(*list.end()), std::out_of_range);
+  EXPECT_THROW(++list.end(), std::out_of_range);
+  EXPECT_THROW(--list.begin(), std::out_of_range);
+  EXPECT_THROW(static_cast<void>(*list.cend()), std::out_of_range);
+#else
+  auto it = list.begin();
+  EXPECT_EQ(--it, list.end()); // the sentinel closes the circle
+#endif
+}
+
+TEST_F(DoublyListTest, ForEach_VisitsFrontToBack) {
+  DoublyList<int> list{1, 2, 3, 4, 5};
+  std::vector<int> seen;
+  list.for_each([&](int &value) { seen.push_back(value++); }, 3);
+  EXPECT_EQ(seen, (std::vector<int>{1, 2, 3, 4, 5}));
+  EXPECT_EQ(list.bottom(), 6);
+
+  const DoublyList<int> &clist = list;
+  int sum = 0;
+  clist.for_each([&](const int &value) { sum += value; });
+  EXPECT_EQ(sum, 20);
+
+  DoublyList<int>().for_each([](int &) { FAIL(); });
+}
+
+TEST_F(DoublyListTest, ForEachBatch_CoversEveryElementOnce) {
+  DoublyList<int> list;
+  for (int i = 0; i < 20; ++i) {
+    list.add_back(i);
+  }
+  std::vector<int> seen;
+  std::vector<size_t> counts;
+  const DoublyList<int> &clist = list;
+  clist.for_each_batch<16>([&](const int *const *items, size_t count) {
+    counts.push_back(count);
+    for (size_t i = 0; i < count; ++i) {
+      seen.push_back(*items[i]);
+    }
+  });
+  EXPECT_EQ(counts, (std::vector<size_t>{16, 4}));
+  ASSERT_EQ(seen.size(), 20);
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_EQ(seen[i], i);
+  }
+}
+
+TEST_F(DoublyListTest, Compact_KeepsOrderAndFollowsAddresses) {
+  DoublyList<std::string> list;
+  for (int i = 0; i < 50; ++i) {
+    list.add_back(std::to_string((i * 37) % 50));
+  }
+  list.sort();
+  std::vector<std::string> before(list.cbegin(), list.cend());
+
+  list.compact();
+  std::vector<std::string> after(list.cbegin(), list.cend());
+  EXPECT_EQ(before, after);
+
+  std::vector<std::string> backwards;
+  for (auto it = list.end(); it != list.begin();) {
+    backwards.push_back(*--it);
+  }
+  EXPECT_EQ(std::vector<std::string>(backwards.rbegin(), backwards.rend()),
+            before);
+
+  const std::string *prev = nullptr;
+  for (const auto &value : list) {
+    if (prev != nullptr) {
+      EXPECT_TRUE(std::less<const std::string *>{}(prev, &value));
+    }
+    prev = &value;
+  }
+}
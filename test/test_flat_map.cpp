@@ -0,0 +1,96 @@
+#include "../include/FlatMap.hpp"
+#include <gtest/gtest.h>
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Test fixture for FlatMap
+class FlatMapTest : public ::testing::Test {
+protected:
+  FlatMap<int, std::string> sorted_map;
+  FlatMap<int, std::string, std::less<int>, FlatLayout::Eytzinger>
+      eytzinger_map;
+
+  template <typename MapType, typename Reference>
+  static auto expect_same(const MapType &map, const Reference &reference)
+      -> void {
+    ASSERT_EQ(map.size(), reference.size());
+    auto it = map.begin();
+    for (const auto &[key, value] : reference) {
+      ASSERT_EQ(it->first, key);
+      ASSERT_EQ(it->second, value);
+      ASSERT_EQ(map.at(key), value);
+      ++it;
+    }
+    ASSERT_EQ(it, map.end());
+  }
+
+  template <typename MapType> static auto fill_and_update(MapType &map) {
+    EXPECT_TRUE(map.insert(2, "b").second);
+    EXPECT_FALSE(map.insert(2, "x").second);
+    EXPECT_TRUE(map.emplace(1, 3, 'a').second);
+    EXPECT_FALSE(map.insert_or_assign(2, "bb"));
+    EXPECT_TRUE(map.insert_or_assign(4, "d"));
+    map[3] = "c";
+    map.find(4)->second += "d";
+    expect_same(map, std::map<int, std::string>{
+                         {1, "aaa"}, {2, "bb"}, {3, "c"}, {4, "dd"}});
+    EXPECT_EQ(map.lower_bound(0)->first, 1);
+    EXPECT_EQ(map.upper_bound(3)->first, 4);
+    EXPECT_EQ(map.upper_bound(4), map.end());
+    EXPECT_THROW((void)map.at(5), std::out_of_range);
+    EXPECT_EQ(map.erase(2), 1);
+    EXPECT_EQ(map.erase(2), 0);
+    EXPECT_FALSE(map.contains(2));
+  }
+};
+
+// Basic Operation Tests
+TEST_F(FlatMapTest, InsertAccessAndErase) {
+  fill_and_update(sorted_map);
+  fill_and_update(eytzinger_map);
+}
+
+TEST_F(FlatMapTest, RangeConstructionAndBatchMerge) {
+  std::vector<std::pair<int, std::string>> rows;
+  std::map<int, std::string> reference;
+  std::mt19937 rng(29);
+  for (int i = 0; i < 5000; ++i) {
+    const int key = static_cast<int>(rng() % 3000);
+    rows.emplace_back(key, std::to_string(i));
+    reference.emplace(key, std::to_string(i));
+  }
+  FlatMap<int, std::string, std::less<int>, FlatLayout::Eytzinger> map(
+      rows.begin(), rows.end());
+  expect_same(map, reference);
+
+  std::vector<std::pair<int, std::string>> more;
+  for (int key = 2990; key < 3100; ++key) {
+    more.emplace_back(key, "new");
+  }
+  std::size_t fresh = 0;
+  for (const auto &entry : more) {
+    fresh += reference.insert(entry).second ? 1 : 0;
+  }
+  EXPECT_EQ(map.insert(more.begin(), more.end()), fresh);
+  expect_same(map, reference);
+}
+
+TEST_F(FlatMapTest, CopyMoveAndClear) {
+  FlatMap<int, int> map{{3, 30}, {1, 10}, {2, 20}};
+  auto copy = map;
+  copy[1] = 11;
+  EXPECT_EQ(map.at(1), 10);
+  FlatMap<int, int> moved(std::move(map));
+  EXPECT_TRUE(map.is_empty());
+  EXPECT_EQ(moved.size(), 3);
+  moved.swap(copy);
+  EXPECT_EQ(moved.at(1), 11);
+  moved.clear();
+  EXPECT_TRUE(moved.is_empty());
+  moved.reserve(64);
+  EXPECT_GE(moved.capacity(), 64);
+}
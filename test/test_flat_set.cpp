@@ -0,0 +1,163 @@
+#include "../include/FlatSet.hpp"
+#include <gtest/gtest.h>
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+using SortedSet = FlatSet<int>;
+using EytzingerSet = FlatSet<int, std::less<int>, FlatLayout::Eytzinger>;
+} // namespace
+
+// Test fixture for FlatSet
+class FlatSetTest : public ::testing::Test {
+protected:
+  SortedSet sorted_set;
+  EytzingerSet eytzinger_set;
+
+  template <typename SetType>
+  static auto keys(const SetType &set)
+      -> std::vector<typename SetType::value_type> {
+    return {set.begin(), set.end()};
+  }
+
+  // Checks contents, both iteration directions and every bound query
+  // around each key against reference.
+  template <typename SetType>
+  static auto expect_same(const SetType &set, const std::set<int> &reference)
+      -> void {
+    ASSERT_EQ(set.size(), reference.size());
+    ASSERT_EQ(keys(set), std::vector<int>(reference.begin(), reference.end()));
+    auto it = set.end();
+    for (auto ref = reference.rbegin(); ref != reference.rend(); ++ref) {
+      ASSERT_EQ(*--it, *ref);
+    }
+    ASSERT_EQ(it, set.begin());
+    const int top = reference.empty() ? 0 : *reference.rbegin() + 2;
+    for (int key = -1; key <= top; ++key) {
+      const auto lower = reference.lower_bound(key);
+      const auto upper = reference.upper_bound(key);
+      ASSERT_EQ(set.lower_bound(key) == set.end(), lower == reference.end());
+      if (lower != reference.end()) {
+        ASSERT_EQ(*set.lower_bound(key), *lower);
+      }
+      ASSERT_EQ(set.upper_bound(key) == set.end(), upper == reference.end());
+      if (upper != reference.end()) {
+        ASSERT_EQ(*set.upper_bound(key), *upper);
+      }
+      ASSERT_EQ(set.contains(key), reference.count(key) == 1);
+    }
+  }
+
+  template <typename SetType> static auto random_operations() -> void {
+    SetType set;
+    std::set<int> reference;
+    std::mt19937 rng(17);
+    for (int step = 0; step < 3000; ++step) {
+      const int key = static_cast<int>(rng() % 600);
+      switch (rng() % 4) {
+      case 0:
+        ASSERT_EQ(set.erase(key), reference.erase(key));
+        break;
+      case 1: {
+        std::vector<int> batch;
+        for (int i = 0; i < 20; ++i) {
+          batch.push_back(static_cast<int>(rng() % 600));
+        }
+        std::size_t fresh = 0;
+        for (int value : batch) {
+          fresh += reference.insert(value).second ? 1 : 0;
+        }
+        ASSERT_EQ(set.insert(batch.begin(), batch.end()), fresh);
+        break;
+      }
+      default: {
+        const auto [it, inserted] = set.insert(key);
+        ASSERT_EQ(inserted, reference.insert(key).second);
+        ASSERT_EQ(*it, key);
+      }
+      }
+    }
+    expect_same(set, reference);
+  }
+};
+
+// Basic Operation Tests
+TEST_F(FlatSetTest, EmptySets) {
+  expect_same(sorted_set, {});
+  expect_same(eytzinger_set, {});
+  EXPECT_EQ(sorted_set.find(1), sorted_set.end());
+  EXPECT_EQ(eytzinger_set.erase(1), 0);
+}
+
+TEST_F(FlatSetTest, InsertFindErase) {
+  for (int key : {5, 1, 3, 5, 9}) {
+    sorted_set.insert(key);
+    eytzinger_set.insert(key);
+  }
+  expect_same(sorted_set, {1, 3, 5, 9});
+  expect_same(eytzinger_set, {1, 3, 5, 9});
+  EXPECT_EQ(*eytzinger_set.find(3), 3);
+  EXPECT_EQ(eytzinger_set.erase(3), 1);
+  EXPECT_EQ(sorted_set.erase(3), 1);
+  expect_same(sorted_set, {1, 5, 9});
+  expect_same(eytzinger_set, {1, 5, 9});
+}
+
+TEST_F(FlatSetTest, EveryTreeShapeSearchesCorrectly) {
+  // Sizes 0..70 cover complete, nearly complete and lopsided last levels.
+  std::set<int> reference;
+  for (int size = 0; size <= 70; ++size) {
+    std::vector<int> odd;
+    for (int i = 0; i < size; ++i) {
+      odd.push_back(2 * i + 1);
+    }
+    EytzingerSet set(odd.begin(), odd.end());
+    expect_same(set, std::set<int>(odd.begin(), odd.end()));
+  }
+}
+
+TEST_F(FlatSetTest, RandomOperationsMatchStdSet) {
+  random_operations<SortedSet>();
+  random_operations<EytzingerSet>();
+}
+
+// Batch Tests
+TEST_F(FlatSetTest, BatchInsertKeepsFirstOfEqualKeys) {
+  struct Entry {
+    int key;
+    int tag;
+  };
+  struct ByKey {
+    auto operator()(const Entry &lhs, const Entry &rhs) const -> bool {
+      return lhs.key < rhs.key;
+    }
+  };
+  FlatSet<Entry, ByKey, FlatLayout::Eytzinger> set;
+  set.insert(Entry{2, 0});
+  std::vector<Entry> batch{{3, 1}, {2, 2}, {3, 3}, {1, 4}};
+  EXPECT_EQ(set.insert(batch.begin(), batch.end()), 2);
+  std::vector<int> tags;
+  for (const auto &entry : set) {
+    tags.push_back(entry.tag);
+  }
+  EXPECT_EQ(tags, (std::vector<int>{4, 0, 1}));
+}
+
+TEST_F(FlatSetTest, StringsAndCopies) {
+  FlatSet<std::string, std::less<std::string>, FlatLayout::Eytzinger> words{
+      "pear", "apple", "fig", "apple"};
+  EXPECT_EQ(keys(words),
+            (std::vector<std::string>{"apple", "fig", "pear"}));
+  auto copy = words;
+  copy.insert(std::string("kiwi"));
+  EXPECT_EQ(words.size(), 3);
+  EXPECT_EQ(*copy.lower_bound("g"), "kiwi");
+  words = std::move(copy);
+  EXPECT_EQ(words.size(), 4);
+  words.clear();
+  EXPECT_TRUE(words.is_empty());
+  EXPECT_EQ(words.begin(), words.end());
+}
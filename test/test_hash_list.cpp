@@ -0,0 +1,215 @@
+#include "../include/HashList.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+// Sends every key to one of three home buckets to force long probe runs.
+struct CollidingHash {
+  auto operator()(int key) const noexcept -> std::size_t {
+    return static_cast<std::size_t>(key % 3);
+  }
+};
+} // namespace
+
+// Test fixture for HashList
+class HashListTest : public ::testing::Test {
+protected:
+  HashList<int, int> int_list;
+  HashList<std::string, int> string_list;
+
+  template <typename ListType>
+  static auto keys(const ListType &list)
+      -> std::vector<typename ListType::key_type> {
+    std::vector<typename ListType::key_type> result;
+    for (const auto &entry : list) {
+      result.push_back(entry.first);
+    }
+    return result;
+  }
+};
+
+// Basic Operation Tests
+TEST_F(HashListTest, EmptyList) {
+  EXPECT_TRUE(int_list.is_empty());
+  EXPECT_FALSE(int_list.contains(1));
+  EXPECT_EQ(int_list.find(1), int_list.end());
+  EXPECT_EQ(int_list.begin(), int_list.end());
+  EXPECT_EQ(int_list.erase(1), 0);
+  EXPECT_FALSE(int_list.move_to_back(1));
+  EXPECT_THROW((void)int_list.at(1), std::out_of_range);
+  EXPECT_THROW((void)int_list.front(), std::out_of_range);
+  EXPECT_THROW((void)int_list.back(), std::out_of_range);
+  EXPECT_THROW(int_list.pop_front(), std::out_of_range);
+  EXPECT_THROW(int_list.erase(int_list.end()), std::out_of_range);
+}
+
+TEST_F(HashListTest, IteratesInInsertionOrder) {
+  EXPECT_TRUE(string_list.insert("c", 3).second);
+  EXPECT_TRUE(string_list.insert("a", 1).second);
+  EXPECT_TRUE(string_list.emplace("b", 2).second);
+  EXPECT_FALSE(string_list.insert("c", 30).second);
+  EXPECT_FALSE(string_list.insert_or_assign("a", 10));
+  string_list["d"] += 4;
+  EXPECT_EQ(keys(string_list),
+            (std::vector<std::string>{"c", "a", "b", "d"}));
+  EXPECT_EQ(string_list.at("a"), 10);
+  EXPECT_EQ(string_list.front().first, "c");
+  EXPECT_EQ(string_list.back().second, 4);
+
+  std::vector<std::string> reversed;
+  for (auto it = string_list.end(); it != string_list.begin();) {
+    reversed.push_back((--it)->first);
+  }
+  EXPECT_EQ(reversed, (std::vector<std::string>{"d", "b", "a", "c"}));
+}
+
+TEST_F(HashListTest, MoveToBackAndPopFront) {
+  for (int i = 0; i < 5; ++i) {
+    int_list.insert(i, i * i);
+  }
+  EXPECT_TRUE(int_list.move_to_back(1));
+  EXPECT_TRUE(int_list.move_to_back(4));
+  int_list.move_to_back(int_list.find(0));
+  EXPECT_EQ(keys(int_list), (std::vector<int>{2, 3, 1, 4, 0}));
+  int_list.pop_front();
+  int_list.pop_front();
+  EXPECT_EQ(keys(int_list), (std::vector<int>{1, 4, 0}));
+  EXPECT_FALSE(int_list.contains(2));
+  EXPECT_EQ(int_list.at(4), 16);
+}
+
+// Erase Tests
+TEST_F(HashListTest, EraseByKeyAndIterator) {
+  for (int i = 0; i < 100; ++i) {
+    int_list.insert(i, i);
+  }
+  EXPECT_EQ(int_list.erase(5), 1);
+  EXPECT_EQ(int_list.erase(5), 0);
+  for (auto it = int_list.begin(); it != int_list.end();) {
+    it = it->first % 2 == 0 ? int_list.erase(it) : std::next(it);
+  }
+  EXPECT_EQ(int_list.size(), 49);
+  const auto remaining = keys(int_list);
+  EXPECT_TRUE(std::is_sorted(remaining.begin(), remaining.end()));
+  EXPECT_TRUE(std::all_of(remaining.begin(), remaining.end(),
+                          [](int key) { return key % 2 == 1 && key != 5; }));
+
+  // Freed nodes are reused before the array grows.
+  const auto capacity = int_list.capacity();
+  for (int i = 0; i < 51; ++i) {
+    int_list.insert(1000 + i, i);
+  }
+  EXPECT_EQ(int_list.capacity(), capacity);
+  EXPECT_EQ(int_list.back().first, 1050);
+}
+
+TEST_F(HashListTest, IteratorsSurviveGrowth) {
+  int_list.insert(7, 70);
+  auto it = int_list.find(7);
+  for (int i = 0; i < 10000; ++i) {
+    int_list.insert(100 + i, i);
+  }
+  EXPECT_EQ(it->second, 70);
+  EXPECT_EQ(it, int_list.begin());
+}
+
+TEST_F(HashListTest, CollidingKeysMatchReference) {
+  HashList<int, int, CollidingHash> list;
+  std::list<std::pair<int, int>> order;
+  std::unordered_map<int, std::list<std::pair<int, int>>::iterator> index;
+  std::mt19937 rng(17);
+  for (int step = 0; step < 20000; ++step) {
+    const int key = static_cast<int>(rng() % 200);
+    const auto found = index.find(key);
+    switch (rng() % 4) {
+    case 0:
+      ASSERT_EQ(list.erase(key), found == index.end() ? 0U : 1U);
+      if (found != index.end()) {
+        order.erase(found->second);
+        index.erase(found);
+      }
+      break;
+    case 1:
+      ASSERT_EQ(list.move_to_back(key), found != index.end());
+      if (found != index.end()) {
+        order.splice(order.end(), order, found->second);
+      }
+      break;
+    default:
+      ASSERT_EQ(list.insert(key, step).second, found == index.end());
+      if (found == index.end()) {
+        order.emplace_back(key, step);
+        index.emplace(key, std::prev(order.end()));
+      }
+    }
+  }
+  ASSERT_EQ(list.size(), order.size());
+  EXPECT_TRUE(std::equal(list.begin(), list.end(), order.begin(), order.end(),
+                         [](const auto &a, const auto &b) {
+                           return a.first == b.first && a.second == b.second;
+                         }));
+}
+
+// Compaction Tests
+TEST_F(HashListTest, CompactKeepsOrderAndLookups) {
+  for (int i = 0; i < 1000; ++i) {
+    string_list.insert(std::to_string(i), i);
+  }
+  for (int i = 0; i < 1000; i += 3) {
+    string_list.erase(std::to_string(i));
+  }
+  for (int i = 1; i < 1000; i += 9) {
+    string_list.move_to_back(std::to_string(i));
+  }
+  const auto before = keys(string_list);
+  string_list.compact();
+  EXPECT_EQ(keys(string_list), before);
+  for (const auto &key : before) {
+    ASSERT_EQ(string_list.at(key), std::stoi(key));
+  }
+  EXPECT_FALSE(string_list.contains("0"));
+  string_list.insert("new", -1);
+  EXPECT_EQ(string_list.back().first, "new");
+}
+
+// Copy and Move Tests
+TEST_F(HashListTest, CopyMoveAndClear) {
+  for (int i = 0; i < 50; ++i) {
+    string_list.insert(std::to_string(i), i);
+  }
+  string_list.move_to_back("0");
+  HashList<std::string, int> copy(string_list);
+  EXPECT_EQ(keys(copy), keys(string_list));
+  copy["0"] = -1;
+  EXPECT_EQ(string_list.at("0"), 0);
+  HashList<std::string, int> moved(std::move(string_list));
+  EXPECT_TRUE(string_list.is_empty());
+  EXPECT_EQ(moved.front().first, "1");
+  string_list = moved;
+  EXPECT_EQ(string_list.back().first, "0");
+  string_list.clear();
+  EXPECT_TRUE(string_list.is_empty());
+  EXPECT_EQ(string_list.begin(), string_list.end());
+  EXPECT_FALSE(string_list.contains("1"));
+  string_list.insert("again", 1);
+  EXPECT_EQ(keys(string_list), (std::vector<std::string>{"again"}));
+}
+
+TEST_F(HashListTest, MoveOnlyValuesAndInitializerList) {
+  HashList<int, std::unique_ptr<int>> list;
+  for (int i = 0; i < 100; ++i) {
+    list.emplace(i, std::make_unique<int>(i));
+  }
+  list.compact();
+  EXPECT_EQ(*list.at(42), 42);
+
+  HashList<int, std::string> from_init{{2, "b"}, {1, "a"}, {2, "c"}};
+  EXPECT_EQ(keys(from_init), (std::vector<int>{2, 1}));
+  EXPECT_EQ(from_init.at(2), "b");
+}
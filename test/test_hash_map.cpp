@@ -0,0 +1,199 @@
+#include "../include/HashMap.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+// Hash and equality that accept std::string, std::string_view and C strings
+// alike.
+struct StringHash {
+  using is_transparent = void;
+  auto operator()(std::string_view text) const noexcept -> std::size_t {
+    return std::hash<std::string_view>{}(text);
+  }
+};
+
+struct StringEqual {
+  using is_transparent = void;
+  auto operator()(std::string_view a, std::string_view b) const noexcept
+      -> bool {
+    return a == b;
+  }
+};
+
+// Sends every key to the same probe start to force long probe chains.
+struct CollidingHash {
+  auto operator()(int key) const noexcept -> std::size_t {
+    return static_cast<std::size_t>(key % 3);
+  }
+};
+} // namespace
+
+// Test fixture for HashMap
+class HashMapTest : public ::testing::Test {
+protected:
+  HashMap<int, int> int_map;
+  HashMap<std::string, int> string_map;
+};
+
+// Basic Operation Tests
+TEST_F(HashMapTest, EmptyMapLookups) {
+  EXPECT_TRUE(int_map.is_empty());
+  EXPECT_EQ(int_map.capacity(), 0);
+  EXPECT_FALSE(int_map.contains(1));
+  EXPECT_EQ(int_map.find(1), int_map.end());
+  EXPECT_EQ(int_map.begin(), int_map.end());
+  EXPECT_EQ(int_map.erase(1), 0);
+  EXPECT_THROW((void)int_map.at(1), std::out_of_range);
+}
+
+TEST_F(HashMapTest, InsertFindAndAssign) {
+  EXPECT_TRUE(string_map.insert("one", 1).second);
+  EXPECT_FALSE(string_map.insert("one", 100).second);
+  EXPECT_EQ(string_map.at("one"), 1);
+  EXPECT_FALSE(string_map.insert_or_assign("one", 11));
+  EXPECT_TRUE(string_map.insert_or_assign("two", 2));
+  string_map["three"] += 3;
+  EXPECT_EQ(string_map.size(), 3);
+  EXPECT_EQ(string_map.find("one")->second, 11);
+  EXPECT_EQ(string_map["three"], 3);
+}
+
+TEST_F(HashMapTest, GrowsAndKeepsEveryEntry) {
+  for (int i = 0; i < 10000; ++i) {
+    int_map.insert(i, i * 2);
+  }
+  EXPECT_EQ(int_map.size(), 10000);
+  EXPECT_LE(int_map.load_factor(), 0.875F);
+  for (int i = 0; i < 10000; ++i) {
+    ASSERT_EQ(int_map.at(i), i * 2);
+  }
+  EXPECT_FALSE(int_map.contains(10000));
+  std::size_t visited = 0;
+  long sum = 0;
+  for (const auto &[key, value] : int_map) {
+    ++visited;
+    sum += value - 2 * key;
+  }
+  EXPECT_EQ(visited, 10000);
+  EXPECT_EQ(sum, 0);
+}
+
+TEST_F(HashMapTest, ReserveAvoidsRehash) {
+  int_map.reserve(1000);
+  const auto capacity = int_map.capacity();
+  EXPECT_GE(capacity * 7 / 8, 1000);
+  for (int i = 0; i < 1000; ++i) {
+    int_map.insert(i, i);
+  }
+  EXPECT_EQ(int_map.capacity(), capacity);
+}
+
+// Erase Tests
+TEST_F(HashMapTest, EraseByKeyAndIterator) {
+  for (int i = 0; i < 100; ++i) {
+    int_map.insert(i, i);
+  }
+  EXPECT_EQ(int_map.erase(5), 1);
+  EXPECT_EQ(int_map.erase(5), 0);
+  EXPECT_FALSE(int_map.contains(5));
+
+  for (auto it = int_map.begin(); it != int_map.end();) {
+    it = it->first % 2 == 0 ? int_map.erase(it) : std::next(it);
+  }
+  EXPECT_EQ(int_map.size(), 49);
+  EXPECT_TRUE(std::all_of(int_map.begin(), int_map.end(),
+                          [](const auto &entry) { return entry.first % 2; }));
+  EXPECT_THROW(int_map.erase(int_map.end()), std::out_of_range);
+}
+
+TEST_F(HashMapTest, SparseErasureLeavesNoTombstones) {
+  for (int i = 0; i < 4; ++i) {
+    int_map.insert(i, i);
+  }
+  const auto capacity = int_map.capacity();
+  // In a mostly empty table every erased slot becomes empty again, so
+  // endless insert/erase churn never forces a rehash.
+  for (int i = 4; i < 100000; ++i) {
+    int_map.insert(i, i);
+    int_map.erase(i - 4);
+  }
+  EXPECT_EQ(int_map.capacity(), capacity);
+  EXPECT_EQ(int_map.size(), 4);
+}
+
+TEST_F(HashMapTest, CollidingKeysSurviveChurn) {
+  HashMap<int, int, CollidingHash> map;
+  std::unordered_map<int, int> reference;
+  std::mt19937 rng(41);
+  for (int step = 0; step < 20000; ++step) {
+    const int key = static_cast<int>(rng() % 300);
+    if (rng() % 3 == 0) {
+      ASSERT_EQ(map.erase(key), reference.erase(key));
+    } else {
+      map.insert_or_assign(key, step);
+      reference[key] = step;
+    }
+  }
+  ASSERT_EQ(map.size(), reference.size());
+  for (const auto &[key, value] : reference) {
+    ASSERT_EQ(map.at(key), value);
+  }
+}
+
+// Heterogeneous Lookup Tests
+TEST_F(HashMapTest, TransparentLookupTakesStringViews) {
+  HashMap<std::string, int, StringHash, StringEqual> map;
+  map.insert("alpha", 1);
+  map.insert("beta", 2);
+  const std::string_view key = "alpha";
+  EXPECT_TRUE(map.contains(key));
+  EXPECT_EQ(map.at("beta"), 2);
+  EXPECT_EQ(map.find(std::string_view("gamma")), map.end());
+  EXPECT_EQ(map.erase(key), 1);
+  EXPECT_FALSE(map.contains("alpha"));
+}
+
+// Copy and Move Tests
+TEST_F(HashMapTest, CopyAndMove) {
+  for (int i = 0; i < 50; ++i) {
+    string_map.insert(std::to_string(i), i);
+  }
+  HashMap<std::string, int> copy(string_map);
+  copy["0"] = -1;
+  EXPECT_EQ(string_map.at("0"), 0);
+  HashMap<std::string, int> moved(std::move(string_map));
+  EXPECT_TRUE(string_map.is_empty());
+  EXPECT_EQ(moved.size(), 50);
+  string_map = moved;
+  EXPECT_EQ(string_map.at("49"), 49);
+  string_map.clear();
+  EXPECT_TRUE(string_map.is_empty());
+  EXPECT_EQ(string_map.begin(), string_map.end());
+  string_map.insert("again", 1);
+  EXPECT_EQ(string_map.size(), 1);
+}
+
+TEST_F(HashMapTest, MoveOnlyValues) {
+  HashMap<int, std::unique_ptr<int>> map;
+  for (int i = 0; i < 100; ++i) {
+    map.emplace(i, std::make_unique<int>(i));
+  }
+  EXPECT_EQ(*map.at(42), 42);
+  HashMap<int, std::unique_ptr<int>> moved(std::move(map));
+  EXPECT_EQ(*moved.at(99), 99);
+}
+
+TEST_F(HashMapTest, InitializerListAndRange) {
+  HashMap<int, std::string> map{{1, "a"}, {2, "b"}, {1, "c"}};
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at(1), "a");
+  const std::vector<std::pair<int, int>> pairs{{1, 10}, {2, 20}};
+  HashMap<int, int> from_range(pairs.begin(), pairs.end());
+  EXPECT_EQ(from_range.at(2), 20);
+}
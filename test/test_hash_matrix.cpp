@@ -0,0 +1,208 @@
+#include "../include/HashMatrix.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+// Sends every column to one of two home slots to force long probe runs.
+struct CollidingHash {
+  auto operator()(int col) const noexcept -> std::size_t {
+    return static_cast<std::size_t>(col % 2);
+  }
+};
+} // namespace
+
+// Test fixture for HashMatrix
+class HashMatrixTest : public ::testing::Test {
+protected:
+  HashMatrix<int, int, int> int_matrix;
+  HashMatrix<std::string, std::string, double> string_matrix;
+
+  template <typename MatrixType, typename Row>
+  static auto row_cells(const MatrixType &matrix, const Row &row)
+      -> std::map<typename MatrixType::column_type,
+                  typename MatrixType::value_type> {
+    std::map<typename MatrixType::column_type, typename MatrixType::value_type>
+        cells;
+    matrix.for_each_in_row(row, [&](const auto &col, const auto &value) {
+      cells.emplace(col, value);
+    });
+    return cells;
+  }
+};
+
+// Basic Operation Tests
+TEST_F(HashMatrixTest, EmptyMatrix) {
+  EXPECT_TRUE(int_matrix.is_empty());
+  EXPECT_EQ(int_matrix.row_count(), 0);
+  EXPECT_FALSE(int_matrix.contains(1, 2));
+  EXPECT_EQ(int_matrix.find(1, 2), nullptr);
+  EXPECT_EQ(int_matrix.erase(1, 2), 0);
+  EXPECT_EQ(int_matrix.erase_row(1), 0);
+  EXPECT_EQ(int_matrix.row_size(1), 0);
+  EXPECT_THROW((void)int_matrix.at(1, 2), std::out_of_range);
+  EXPECT_EQ(int_matrix.memory_usage().total_bytes(), 0);
+}
+
+TEST_F(HashMatrixTest, InsertAndAccessCells) {
+  EXPECT_TRUE(string_matrix.insert("ann", "age", 31));
+  EXPECT_FALSE(string_matrix.insert("ann", "age", 32));
+  EXPECT_TRUE(string_matrix.emplace("bob", "age", 40));
+  EXPECT_FALSE(string_matrix.insert_or_assign("ann", "age", 33));
+  EXPECT_TRUE(string_matrix.insert_or_assign("ann", "score", 0.5));
+  string_matrix("bob", "score") += 2.0;
+  EXPECT_EQ(string_matrix.size(), 4);
+  EXPECT_EQ(string_matrix.row_count(), 2);
+  EXPECT_EQ(string_matrix.at("ann", "age"), 33);
+  EXPECT_EQ(*string_matrix.find("bob", "score"), 2.0);
+  EXPECT_EQ(string_matrix.find("bob", "height"), nullptr);
+  EXPECT_FALSE(string_matrix.contains("carl", "age"));
+  EXPECT_EQ(row_cells(string_matrix, "ann"),
+            (std::map<std::string, double>{{"age", 33}, {"score", 0.5}}));
+}
+
+TEST_F(HashMatrixTest, RaggedRowsGrowIndependently) {
+  for (int col = 0; col < 1000; ++col) {
+    int_matrix.insert(0, col, col);
+  }
+  for (int row = 1; row < 200; ++row) {
+    int_matrix.insert(row, row * 7, row);
+  }
+  EXPECT_EQ(int_matrix.row_size(0), 1000);
+  EXPECT_EQ(int_matrix.row_size(5), 1);
+  EXPECT_EQ(int_matrix.size(), 1199);
+  for (int col = 0; col < 1000; ++col) {
+    ASSERT_EQ(int_matrix.at(0, col), col);
+  }
+  for (int row = 1; row < 200; ++row) {
+    ASSERT_EQ(int_matrix.at(row, row * 7), row);
+    ASSERT_FALSE(int_matrix.contains(row, row * 7 + 1));
+  }
+  long sum = 0;
+  int_matrix.for_each_in_row(0, [&](int col, int &value) {
+    value += 1;
+    sum += value - col;
+  });
+  EXPECT_EQ(sum, 1000);
+}
+
+// Erase Tests
+TEST_F(HashMatrixTest, EraseCellsAndRows) {
+  for (int row = 0; row < 10; ++row) {
+    for (int col = 0; col < 20; ++col) {
+      int_matrix.insert(row, col, row * 100 + col);
+    }
+  }
+  EXPECT_EQ(int_matrix.erase(3, 4), 1);
+  EXPECT_EQ(int_matrix.erase(3, 4), 0);
+  EXPECT_EQ(int_matrix.row_size(3), 19);
+  EXPECT_EQ(int_matrix.erase_row(5), 20);
+  EXPECT_FALSE(int_matrix.contains_row(5));
+  EXPECT_FALSE(int_matrix.contains(5, 0));
+  EXPECT_EQ(int_matrix.size(), 200 - 21);
+
+  // Erasing the last cell of a row removes the row.
+  int_matrix.insert(42, 1, 1);
+  EXPECT_EQ(int_matrix.erase(42, 1), 1);
+  EXPECT_FALSE(int_matrix.contains_row(42));
+  EXPECT_EQ(int_matrix.row_count(), 9);
+}
+
+TEST_F(HashMatrixTest, CollidingColumnsMatchReference) {
+  HashMatrix<int, int, int, std::hash<int>, CollidingHash> matrix;
+  std::map<std::pair<int, int>, int> reference;
+  std::mt19937 rng(23);
+  for (int step = 0; step < 30000; ++step) {
+    const int row = static_cast<int>(rng() % 8);
+    const int col = static_cast<int>(rng() % 64);
+    switch (rng() % 5) {
+    case 0:
+      ASSERT_EQ(matrix.erase(row, col), reference.erase({row, col}));
+      break;
+    case 1:
+      if (rng() % 20 == 0) {
+        std::size_t removed = 0;
+        for (auto it = reference.begin(); it != reference.end();) {
+          if (it->first.first == row) {
+            it = reference.erase(it);
+            ++removed;
+          } else {
+            ++it;
+          }
+        }
+        ASSERT_EQ(matrix.erase_row(row), removed);
+      }
+      break;
+    default:
+      matrix.insert_or_assign(row, col, step);
+      reference[{row, col}] = step;
+    }
+  }
+  ASSERT_EQ(matrix.size(), reference.size());
+  std::map<std::pair<int, int>, int> visited;
+  matrix.for_each([&](int row, int col, int value) {
+    visited[{row, col}] = value;
+  });
+  EXPECT_EQ(visited, reference);
+}
+
+// Memory Tests
+TEST_F(HashMatrixTest, CompactionReclaimsDeadSlots) {
+  for (int row = 0; row < 1000; ++row) {
+    for (int col = 0; col < 10; ++col) {
+      int_matrix.insert(row, col, col);
+    }
+  }
+  for (int row = 0; row < 1000; row += 2) {
+    int_matrix.erase_row(row);
+  }
+  EXPECT_GT(int_matrix.memory_usage().dead_bytes, 0);
+  int_matrix.compact();
+  const auto usage = int_matrix.memory_usage();
+  EXPECT_EQ(usage.dead_bytes, 0);
+  EXPECT_EQ(usage.cell_bytes, 5000 * (sizeof(int) * 2 + 1));
+  EXPECT_EQ(usage.total_bytes(), usage.row_index_bytes + usage.cell_bytes +
+                                     usage.free_bytes + usage.dead_bytes +
+                                     usage.reserved_bytes);
+  for (int row = 1; row < 1000; row += 2) {
+    ASSERT_EQ(int_matrix.row_size(row), 10);
+    ASSERT_EQ(int_matrix.at(row, 9), 9);
+  }
+}
+
+TEST_F(HashMatrixTest, ReserveRowKeepsTableInPlace) {
+  int_matrix.reserve_row(1, 100);
+  const auto before = int_matrix.memory_usage();
+  for (int col = 0; col < 100; ++col) {
+    int_matrix.insert(1, col, col);
+  }
+  EXPECT_EQ(int_matrix.memory_usage().dead_bytes, before.dead_bytes);
+  EXPECT_EQ(int_matrix.row_size(1), 100);
+}
+
+// Copy and Move Tests
+TEST_F(HashMatrixTest, CopyMoveAndClear) {
+  string_matrix.insert("a", "x", 1);
+  string_matrix.insert("a", "y", 2);
+  string_matrix.insert("b", "x", 3);
+  HashMatrix<std::string, std::string, double> copy(string_matrix);
+  copy("a", "x") = 10;
+  EXPECT_EQ(string_matrix.at("a", "x"), 1);
+  HashMatrix<std::string, std::string, double> moved(
+      std::move(string_matrix));
+  EXPECT_TRUE(string_matrix.is_empty());
+  EXPECT_EQ(string_matrix.row_count(), 0);
+  EXPECT_EQ(moved.size(), 3);
+  string_matrix = copy;
+  EXPECT_EQ(string_matrix.at("a", "x"), 10);
+  string_matrix.clear();
+  EXPECT_TRUE(string_matrix.is_empty());
+  EXPECT_FALSE(string_matrix.contains("b", "x"));
+  string_matrix.insert("c", "z", 4);
+  EXPECT_EQ(string_matrix.size(), 1);
+}
@@ -0,0 +1,212 @@
+#include "../include/HashSet.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+// Maps keys onto few hash values so that buckets overflow and the
+// displacement walk and stash get exercised.
+struct FewValuesHash {
+  auto operator()(int key) const noexcept -> std::size_t {
+    return static_cast<std::size_t>(key % 61);
+  }
+};
+
+struct ConstantHash {
+  auto operator()(int) const noexcept -> std::size_t { return 0; }
+};
+
+// Sends keys 0..15 to one hash value and leaves all other keys distinct.
+struct SixteenSharedHash {
+  auto operator()(int key) const noexcept -> std::size_t {
+    return key < 16 ? 0 : static_cast<std::size_t>(key);
+  }
+};
+} // namespace
+
+// Test fixture for HashSet
+class HashSetTest : public ::testing::Test {
+protected:
+  HashSet<std::uint64_t> int_set;
+  HashSet<std::string> string_set;
+
+  template <typename SetType>
+  static auto sorted(const SetType &set)
+      -> std::vector<typename SetType::value_type> {
+    std::vector<typename SetType::value_type> keys(set.begin(), set.end());
+    std::sort(keys.begin(), keys.end());
+    return keys;
+  }
+};
+
+// Basic Operation Tests
+TEST_F(HashSetTest, EmptySet) {
+  EXPECT_TRUE(int_set.is_empty());
+  EXPECT_EQ(int_set.capacity(), 0);
+  EXPECT_FALSE(int_set.contains(1));
+  EXPECT_EQ(int_set.erase(1), 0);
+  EXPECT_EQ(int_set.begin(), int_set.end());
+  EXPECT_EQ(int_set.find(1), int_set.end());
+}
+
+TEST_F(HashSetTest, InsertContainsErase) {
+  EXPECT_TRUE(string_set.insert("a"));
+  EXPECT_FALSE(string_set.insert("a"));
+  EXPECT_TRUE(string_set.emplace(3, 'b'));
+  EXPECT_TRUE(string_set.contains("bbb"));
+  EXPECT_EQ(*string_set.find("bbb"), "bbb");
+  EXPECT_EQ(string_set.count("a"), 1);
+  EXPECT_EQ(string_set.erase("a"), 1);
+  EXPECT_EQ(string_set.erase("a"), 0);
+  EXPECT_EQ(sorted(string_set), (std::vector<std::string>{"bbb"}));
+}
+
+TEST_F(HashSetTest, GrowsToManyKeys) {
+  for (std::uint64_t i = 0; i < 100000; ++i) {
+    ASSERT_TRUE(int_set.insert(i * 7919));
+  }
+  EXPECT_EQ(int_set.size(), 100000);
+  EXPECT_LE(int_set.load_factor(), 0.9F);
+  for (std::uint64_t i = 0; i < 100000; ++i) {
+    ASSERT_TRUE(int_set.contains(i * 7919));
+    ASSERT_FALSE(int_set.contains(i * 7919 + 1));
+  }
+  EXPECT_EQ(static_cast<std::size_t>(
+                std::distance(int_set.begin(), int_set.end())),
+            100000);
+}
+
+TEST_F(HashSetTest, ReserveAvoidsRehash) {
+  int_set.reserve(5000);
+  const auto buckets = int_set.bucket_count();
+  for (std::uint64_t i = 0; i < 5000; ++i) {
+    int_set.insert(i);
+  }
+  EXPECT_EQ(int_set.bucket_count(), buckets);
+}
+
+// Displacement and Stash Tests
+TEST_F(HashSetTest, HeavyCollisionsUseStashAndGrowth) {
+  HashSet<int, FewValuesHash> set;
+  for (int i = 0; i < 200; ++i) {
+    ASSERT_TRUE(set.insert(i));
+  }
+  EXPECT_EQ(set.size(), 200);
+  for (int i = 0; i < 200; ++i) {
+    ASSERT_TRUE(set.contains(i));
+  }
+  for (int i = 0; i < 200; i += 2) {
+    ASSERT_EQ(set.erase(i), 1);
+  }
+  for (int i = 0; i < 200; ++i) {
+    ASSERT_EQ(set.contains(i), i % 2 == 1);
+  }
+  std::vector<int> keys(set.begin(), set.end());
+  EXPECT_EQ(keys.size(), 100);
+}
+
+TEST_F(HashSetTest, RejectsKeysBeyondOneHashValue) {
+  HashSet<int, ConstantHash> set;
+  int inserted = 0;
+  EXPECT_THROW(
+      {
+        for (; inserted < 100; ++inserted) {
+          set.insert(inserted);
+        }
+      },
+      std::length_error);
+  using Set = HashSet<int, ConstantHash>;
+  EXPECT_EQ(inserted, 2 * Set::BucketWays + Set::StashCapacity);
+  EXPECT_EQ(set.size(), static_cast<std::size_t>(inserted));
+  for (int i = 0; i < inserted; ++i) {
+    EXPECT_TRUE(set.contains(i));
+  }
+  EXPECT_FALSE(set.contains(inserted));
+}
+
+TEST_F(HashSetTest, SaturatedHashValueDoesNotBlockOtherKeys) {
+  HashSet<int, SixteenSharedHash> set;
+  for (int i = 0; i < 16; ++i) {
+    ASSERT_TRUE(set.insert(i));
+  }
+  for (int i = 16; i < 5000; ++i) {
+    ASSERT_TRUE(set.insert(i)) << i;
+  }
+  EXPECT_LE(set.load_factor(), 0.9F);
+  EXPECT_GE(set.load_factor(), 0.3F);
+  for (int i = 0; i < 5000; ++i) {
+    ASSERT_TRUE(set.contains(i)) << i;
+  }
+  EXPECT_EQ(set.size(), 5000);
+}
+
+TEST_F(HashSetTest, RandomChurnMatchesReference) {
+  std::unordered_set<std::uint64_t> reference;
+  std::mt19937_64 rng(42);
+  for (int step = 0; step < 50000; ++step) {
+    const std::uint64_t key = rng() % 5000;
+    if (rng() % 3 == 0) {
+      ASSERT_EQ(int_set.erase(key), reference.erase(key));
+    } else {
+      ASSERT_EQ(int_set.insert(key), reference.insert(key).second);
+    }
+  }
+  ASSERT_EQ(int_set.size(), reference.size());
+  for (std::uint64_t key = 0; key < 5000; ++key) {
+    ASSERT_EQ(int_set.contains(key), reference.count(key) == 1);
+  }
+}
+
+// Bulk Lookup Tests
+TEST_F(HashSetTest, ContainsBulkMatchesSingleLookups) {
+  for (std::uint64_t i = 0; i < 1000; i += 3) {
+    int_set.insert(i);
+  }
+  std::vector<std::uint64_t> probes(1000);
+  for (std::uint64_t i = 0; i < probes.size(); ++i) {
+    probes[i] = i;
+  }
+  std::vector<bool> hits;
+  const auto found = int_set.contains_bulk(probes.begin(), probes.end(),
+                                           std::back_inserter(hits));
+  EXPECT_EQ(found, int_set.size());
+  ASSERT_EQ(hits.size(), probes.size());
+  for (std::size_t i = 0; i < probes.size(); ++i) {
+    EXPECT_EQ(hits[i], int_set.contains(probes[i]));
+  }
+
+  HashSet<std::uint64_t> empty;
+  hits.clear();
+  EXPECT_EQ(empty.contains_bulk(probes.begin(), probes.begin() + 3,
+                                std::back_inserter(hits)),
+            0);
+  EXPECT_EQ(hits, (std::vector<bool>{false, false, false}));
+}
+
+// Copy and Move Tests
+TEST_F(HashSetTest, CopyMoveAndClear) {
+  HashSet<int, FewValuesHash> set;
+  for (int i = 0; i < 60; ++i) {
+    set.insert(i);
+  }
+  HashSet<int, FewValuesHash> copy(set);
+  EXPECT_EQ(copy.size(), 60);
+  copy.erase(0);
+  EXPECT_TRUE(set.contains(0));
+  HashSet<int, FewValuesHash> moved(std::move(set));
+  EXPECT_EQ(moved.size(), 60);
+  EXPECT_TRUE(set.is_empty());
+  set = copy;
+  EXPECT_EQ(set.size(), 59);
+  set.clear();
+  EXPECT_TRUE(set.is_empty());
+  EXPECT_FALSE(set.contains(5));
+  EXPECT_TRUE(set.insert(5));
+
+  HashSet<std::string> strings{"x", "y", "x"};
+  EXPECT_EQ(sorted(strings), (std::vector<std::string>{"x", "y"}));
+}
@@ -0,0 +1,146 @@
+#include "../include/Heap.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// Test fixture for Heap
+class HeapTest : public ::testing::Test {
+protected:
+  Heap<int> max_heap;
+  Heap<int, std::greater<int>, 4> min_heap;
+
+  template <typename HeapType>
+  static auto drain(HeapType &heap) -> std::vector<int> {
+    std::vector<int> result;
+    while (!heap.empty()) {
+      result.push_back(heap.top());
+      heap.pop();
+    }
+    return result;
+  }
+};
+
+// Basic Operation Tests
+TEST_F(HeapTest, EmptyHeapThrows) {
+  EXPECT_TRUE(max_heap.is_empty());
+  EXPECT_THROW((void)max_heap.top(), std::out_of_range);
+  EXPECT_THROW((void)max_heap.top_handle(), std::out_of_range);
+  EXPECT_THROW(max_heap.pop(), std::out_of_range);
+}
+
+TEST_F(HeapTest, PushPopOrdersByCompare) {
+  for (int value : {5, 1, 9, 3, 7, 9}) {
+    max_heap.push(value);
+    min_heap.push(value);
+  }
+  EXPECT_EQ(max_heap.size(), 6);
+  EXPECT_EQ(drain(max_heap), (std::vector<int>{9, 9, 7, 5, 3, 1}));
+  EXPECT_EQ(drain(min_heap), (std::vector<int>{1, 3, 5, 7, 9, 9}));
+}
+
+TEST_F(HeapTest, HeapifyFromRangeAssignsHandlesInOrder) {
+  const std::vector<int> values{4, 8, 2, 6, 0};
+  Heap<int, std::greater<int>, 8> heap(values.begin(), values.end());
+  for (Heap<int>::handle_type i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(heap.value(i), values[i]);
+  }
+  EXPECT_EQ(heap.top_handle(), 4);
+  EXPECT_EQ(drain(heap), (std::vector<int>{0, 2, 4, 6, 8}));
+
+  heap.heapify(values.begin(), values.begin() + 2);
+  EXPECT_EQ(heap.size(), 2);
+  EXPECT_EQ(heap.top(), 4);
+}
+
+// Handle Tests
+TEST_F(HeapTest, DecreaseKeyMovesTowardTop) {
+  auto a = min_heap.push(10);
+  min_heap.push(5);
+  auto c = min_heap.push(20);
+  min_heap.decrease_key(c, 1);
+  EXPECT_EQ(min_heap.top(), 1);
+  EXPECT_EQ(min_heap.top_handle(), c);
+  EXPECT_THROW(min_heap.decrease_key(a, 11), std::invalid_argument);
+  EXPECT_EQ(min_heap.value(a), 10);
+}
+
+TEST_F(HeapTest, UpdateMovesEitherWay) {
+  auto a = max_heap.push(10);
+  auto b = max_heap.push(5);
+  max_heap.update(a, 1);
+  EXPECT_EQ(max_heap.top_handle(), b);
+  max_heap.update(a, 50);
+  EXPECT_EQ(max_heap.top_handle(), a);
+}
+
+TEST_F(HeapTest, EraseRemovesArbitraryElement) {
+  std::vector<Heap<int>::handle_type> handles;
+  for (int i = 0; i < 10; ++i) {
+    handles.push_back(max_heap.push(i));
+  }
+  max_heap.erase(handles[9]);
+  max_heap.erase(handles[3]);
+  EXPECT_FALSE(max_heap.contains(handles[3]));
+  EXPECT_THROW(max_heap.erase(handles[3]), std::out_of_range);
+  EXPECT_THROW((void)max_heap.value(1000), std::out_of_range);
+  EXPECT_EQ(drain(max_heap), (std::vector<int>{8, 7, 6, 5, 4, 2, 1, 0}));
+}
+
+TEST_F(HeapTest, HandlesAreRecycled) {
+  auto a = max_heap.push(1);
+  max_heap.pop();
+  EXPECT_FALSE(max_heap.contains(a));
+  auto b = max_heap.push(2);
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(max_heap.value(b), 2);
+}
+
+// Stress Tests
+TEST_F(HeapTest, RandomTraceMatchesReference) {
+  std::mt19937 rng(39);
+  Heap<int, std::greater<int>, 4> heap;
+  std::vector<std::pair<Heap<int>::handle_type, int>> live;
+  for (int step = 0; step < 20000; ++step) {
+    const auto op = rng() % 4;
+    if (op < 2 || live.empty()) {
+      const int value = static_cast<int>(rng() % 100000);
+      live.emplace_back(heap.push(value), value);
+    } else if (op == 2) {
+      auto &entry = live[rng() % live.size()];
+      entry.second -= static_cast<int>(rng() % 1000);
+      heap.decrease_key(entry.first, entry.second);
+    } else {
+      const auto at = rng() % live.size();
+      heap.erase(live[at].first);
+      live.erase(live.begin() + static_cast<std::ptrdiff_t>(at));
+    }
+    ASSERT_EQ(heap.size(), live.size());
+  }
+  std::vector<int> expected;
+  for (const auto &entry : live) {
+    EXPECT_EQ(heap.value(entry.first), entry.second);
+    expected.push_back(entry.second);
+  }
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(drain(heap), expected);
+}
+
+TEST_F(HeapTest, MoveOnlyAndNonTrivialValues) {
+  auto by_value = [](const std::unique_ptr<int> &a,
+                     const std::unique_ptr<int> &b) { return *a < *b; };
+  Heap<std::unique_ptr<int>, decltype(by_value)> heap(by_value);
+  for (int i = 0; i < 20; ++i) {
+    heap.emplace(std::make_unique<int>(i * 7 % 20));
+  }
+  EXPECT_EQ(*heap.top(), 19);
+
+  Heap<std::string> strings{"pear", "apple", "zucchini", "fig"};
+  strings.clear();
+  EXPECT_TRUE(strings.empty());
+  strings.push("kiwi");
+  EXPECT_EQ(strings.top(), "kiwi");
+}
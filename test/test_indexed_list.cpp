@@ -0,0 +1,280 @@
+#include "../include/IndexedList.hpp"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class IndexedListTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+// Singly Linked Tests
+TEST_F(IndexedListTest, DefaultConstructor_CreatesEmptyList) {
+  IndexedList<int> list;
+  EXPECT_TRUE(list.is_empty());
+  EXPECT_EQ(list.size(), 0);
+  EXPECT_EQ(list.begin(), list.end());
+  EXPECT_THROW(static_cast<void>(list.top()), std::out_of_range);
+  EXPECT_THROW(list.remove_front(), std::out_of_range);
+}
+
+TEST_F(IndexedListTest, AddFrontAndBack_LinksInOrder) {
+  IndexedList<int> list;
+  list.add_back(2);
+  list.add_front(1);
+  list.add(3);
+
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(list.top(), 1);
+  EXPECT_EQ(list.bottom(), 3);
+  int expected = 1;
+  for (const auto &value : list) {
+    EXPECT_EQ(value, expected++);
+  }
+}
+
+TEST_F(IndexedListTest, InsertAndEraseAfter_RelinkNeighbours) {
+  IndexedList<int> list{1, 3};
+  auto it = list.insert_after(list.begin(), 2);
+  EXPECT_EQ(*it, 2);
+
+  it = list.insert_after(++it, 4); // [1, 2, 3, 4]
+  EXPECT_EQ(list.bottom(), 4);
+
+  it = list.begin();
+  ++it;
+  list.erase_after(it); // [1, 2, 4]
+  ++it;
+  EXPECT_EQ(*it, 4);
+  EXPECT_EQ(list.size(), 3);
+
+  list.erase_after(list.begin()); // [1, 4]
+  EXPECT_THROW(list.erase_after(it), std::out_of_range);
+  EXPECT_THROW(list.erase_after(list.end()), std::out_of_range);
+  EXPECT_EQ(list.bottom(), 4);
+}
+
+TEST_F(IndexedListTest, RemoveFront_ReusesFreedSlots) {
+  IndexedList<std::string> list{"a", "b", "c"};
+  const auto capacity = list.capacity();
+
+  for (int round = 0; round < 100; ++round) {
+    list.remove_front();
+    list.add_back("x");
+  }
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(list.capacity(), capacity);
+}
+
+TEST_F(IndexedListTest, CopyAndMove_PreserveElements) {
+  IndexedList<std::string> list{"a", "b"};
+  IndexedList<std::string> copy(list);
+  list.add("c");
+  EXPECT_EQ(copy.size(), 2);
+  EXPECT_EQ(copy.bottom(), "b");
+
+  IndexedList<std::string> moved(std::move(list));
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_TRUE(list.is_empty());
+}
+
+TEST_F(IndexedListTest, SerializeRoundTrip_RestoresList) {
+  IndexedList<int> list{1, 2, 3, 4};
+  list.remove_front();
+  list.add_front(0); // reuses the freed slot
+
+  std::vector<unsigned char> buffer(list.serialized_size());
+  list.serialize(buffer.data());
+  auto restored = IndexedList<int>::deserialize(buffer.data(), buffer.size());
+
+  EXPECT_EQ(restored.size(), 4);
+  std::vector<int> values(restored.begin(), restored.end());
+  EXPECT_EQ(values, (std::vector<int>{0, 2, 3, 4}));
+
+  restored.add_back(5);
+  EXPECT_EQ(restored.bottom(), 5);
+  EXPECT_THROW(IndexedList<int>::deserialize(buffer.data(), 3),
+               std::length_error);
+}
+
+TEST_F(IndexedListTest, Deserialize_RejectsCorruptLinks) {
+  IndexedList<int> list{1, 2, 3, 4};
+  list.remove_front(); // slot 0 heads the free chain
+  std::vector<unsigned char> buffer(list.serialized_size());
+  list.serialize(buffer.data());
+
+  using Header = details::IndexedListHeader;
+  using Slot = IndexedList<int>::Slot;
+  const auto corrupt = [&](auto patch) {
+    std::vector<unsigned char> bytes = buffer;
+    Header header{};
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    auto *slots = reinterpret_cast<Slot *>(bytes.data() + sizeof(header));
+    patch(header, slots);
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    return bytes;
+  };
+  const std::vector<std::vector<unsigned char>> bad = {
+      corrupt([](Header &header, Slot *) { header.front = 4; }),
+      corrupt([](Header &header, Slot *) { header.size = 5; }),
+      corrupt([](Header &header, Slot *) { header.size = 2; }),
+      corrupt([](Header &header, Slot *) { header.back = 1; }),
+      corrupt([](Header &, Slot *slots) { slots[2].next = 7; }),
+      corrupt([](Header &, Slot *slots) { slots[3].next = 1; }),
+      corrupt([](Header &, Slot *slots) { slots[0].next = 0; }),
+      corrupt([](Header &header, Slot *) { header.free_head = 2; }),
+  };
+  for (const auto &bytes : bad) {
+    EXPECT_THROW(IndexedList<int>::deserialize(bytes.data(), bytes.size()),
+                 std::invalid_argument);
+  }
+  EXPECT_EQ(IndexedList<int>::deserialize(buffer.data(), buffer.size()).size(),
+            3);
+}
+
+// Doubly Linked Tests
+TEST_F(IndexedListTest, Doubly_BidirectionalTraversal) {
+  IndexedDoublyList<int> list{1, 2, 3};
+
+  auto it = list.end();
+  EXPECT_EQ(*--it, 3);
+  EXPECT_EQ(*--it, 2);
+  EXPECT_EQ(*--it, 1);
+  EXPECT_EQ(it, list.begin());
+}
+
+TEST_F(IndexedListTest, Doubly_InsertAndErase) {
+  IndexedDoublyList<int> list{1, 4};
+  auto pos = list.begin();
+  ++pos;
+  auto it = list.insert(pos, 3);
+  list.insert(it, 2);
+  list.emplace_front(0);
+  list.emplace_back(5);
+
+  std::vector<int> values(list.begin(), list.end());
+  EXPECT_EQ(values, (std::vector<int>{0, 1, 2, 3, 4, 5}));
+
+  it = list.begin();
+  ++it;
+  ++it;
+  it = list.erase(it); // [0, 1, 3, 4, 5]
+  EXPECT_EQ(*it, 3);
+  list.remove_front();
+  list.remove_back();
+  values.assign(list.begin(), list.end());
+  EXPECT_EQ(values, (std::vector<int>{1, 3, 4}));
+  EXPECT_THROW(list.erase(list.end()), std::out_of_range);
+}
+
+TEST_F(IndexedListTest, Doubly_IteratorsSurviveGrowth) {
+  IndexedDoublyList<int> list;
+  auto first = list.insert(list.end(), 7);
+  for (int i = 0; i < 1'000; ++i) {
+    list.add_back(i);
+  }
+  EXPECT_EQ(*first, 7);
+  EXPECT_EQ(list.size(), 1'001);
+}
+
+TEST_F(IndexedListTest, Doubly_MoveOnlyElements) {
+  IndexedDoublyList<std::unique_ptr<int>> list;
+  list.add(std::make_unique<int>(1));
+  list.emplace_back(new int(2));
+  for (int i = 0; i < 20; ++i) { // forces the slot array to grow
+    list.emplace_front(new int(0));
+  }
+  EXPECT_EQ(*list.bottom(), 2);
+  list.clear();
+  EXPECT_TRUE(list.is_empty());
+}
+
+TEST_F(IndexedListTest, ElementsAreConstructedInPlace) {
+  struct Counted {
+    explicit Counted(int v, int &live) : value(v), live(&live) { ++live; }
+    Counted(const Counted &other) : value(other.value), live(other.live) {
+      ++*live;
+    }
+    ~Counted() { --*live; }
+    int value;
+    int *live;
+  };
+  int live = 0;
+  {
+    IndexedDoublyList<Counted> list;
+    for (int i = 0; i < 20; ++i) { // no default constructor, grows twice
+      list.emplace_back(i, live);
+    }
+    EXPECT_EQ(live, 20);
+    list.erase(list.begin());
+    list.remove_back();
+    EXPECT_EQ(live, 18);
+    IndexedDoublyList<Counted> copy(list);
+    EXPECT_EQ(live, 36);
+    EXPECT_EQ(copy.top().value, 1);
+    EXPECT_EQ(copy.bottom().value, 18);
+
+    IndexedList<Counted> singly;
+    for (int i = 0; i < 9; ++i) {
+      singly.emplace_back(i, live);
+    }
+    singly.add(singly.top()); // aliases an element across growth
+    EXPECT_EQ(singly.bottom().value, 0);
+    EXPECT_EQ(live, 46);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+TEST_F(IndexedListTest, Growth_ThrowingCopyLeavesListIntact) {
+  struct Fragile {
+    explicit Fragile(int v) : value(v) {}
+    Fragile(const Fragile &other) : value(other.value) {
+      if (value == 5) {
+        throw std::runtime_error("copy failed");
+      }
+    }
+    int value;
+  };
+  IndexedList<Fragile> list;
+  for (int i = 0; i < 8; ++i) {
+    list.emplace_back(i);
+  }
+  EXPECT_THROW(list.emplace_back(8), std::runtime_error);
+  EXPECT_EQ(list.size(), 8u);
+  int expected = 0;
+  for (const auto &element : list) {
+    EXPECT_EQ(element.value, expected++);
+  }
+}
+
+TEST_F(IndexedListTest, Doubly_SerializeRoundTrip) {
+  IndexedDoublyList<double> list{1.5, 2.5, 3.5};
+  std::vector<unsigned char> buffer(list.serialized_size());
+  list.serialize(buffer.data());
+
+  auto restored =
+      IndexedDoublyList<double>::deserialize(buffer.data(), buffer.size());
+  auto it = restored.end();
+  EXPECT_EQ(*--it, 3.5);
+  EXPECT_EQ(restored.top(), 1.5);
+
+  IndexedDoublyList<double>::Slot slot{};
+  const std::size_t second = sizeof(details::IndexedListHeader) + sizeof(slot);
+  std::memcpy(&slot, buffer.data() + second, sizeof(slot));
+  slot.prev = 2; // should link back to slot 0
+  std::memcpy(buffer.data() + second, &slot, sizeof(slot));
+  EXPECT_THROW(
+      IndexedDoublyList<double>::deserialize(buffer.data(), buffer.size()),
+      std::invalid_argument);
+}
+
+TEST_F(IndexedListTest, SlotLayout_UsesThirtyTwoBitLinks) {
+  static_assert(sizeof(IndexedList<int>::Slot) == 8,
+                "Singly slot must hold the element and one 4-byte link");
+  static_assert(sizeof(IndexedDoublyList<int>::Slot) == 12,
+                "Doubly slot must hold the element and two 4-byte links");
+}
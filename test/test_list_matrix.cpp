@@ -0,0 +1,199 @@
+#include "../include/ListMatrix.hpp"
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+// Test fixture for ListMatrix
+class ListMatrixTest : public ::testing::Test {
+protected:
+  using Cells = std::map<std::pair<std::size_t, std::size_t>, long>;
+
+  // Random triples with repeated cells, plus their summed reference.
+  static auto random_builder(std::size_t rows, std::size_t cols,
+                             std::size_t count, unsigned seed, Cells &cells)
+      -> ListMatrixBuilder<long> {
+    std::mt19937 rng(seed);
+    ListMatrixBuilder<long> builder(rows, cols);
+    for (std::size_t i = 0; i < count; ++i) {
+      const std::size_t row = rng() % rows;
+      // Squaring skews columns towards 0 so that cells repeat.
+      const std::size_t col = (rng() % cols) * (rng() % cols) / cols;
+      const long value = static_cast<long>(rng() % 9) + 1;
+      builder.insert(row, col, value);
+      cells[{row, col}] += value;
+    }
+    return builder;
+  }
+
+  static auto expect_cells(const ListMatrix<long> &matrix, const Cells &cells)
+      -> void {
+    ASSERT_EQ(matrix.nonzeros(), cells.size());
+    auto it = cells.begin();
+    for (std::size_t row = 0; row < matrix.rows(); ++row) {
+      matrix.for_each_in_row(row, [&](std::size_t col, long value) {
+        ASSERT_NE(it, cells.end());
+        ASSERT_EQ(it->first, std::make_pair(row, col));
+        ASSERT_EQ(it->second, value);
+        ++it;
+      });
+    }
+    ASSERT_EQ(it, cells.end());
+  }
+};
+
+// Basic Operation Tests
+TEST_F(ListMatrixTest, BuildSumsRepeatedCells) {
+  ListMatrixBuilder<double> builder(3, 4);
+  builder.insert(2, 1, 1.5);
+  builder.insert(0, 3, 2.0);
+  builder.insert(2, 1, 0.5);
+  builder.insert(2, 0, 4.0);
+  EXPECT_EQ(builder.size(), 4);
+  EXPECT_THROW(builder.insert(3, 0, 1.0), std::out_of_range);
+
+  const auto matrix = builder.build();
+  EXPECT_EQ(matrix.rows(), 3);
+  EXPECT_EQ(matrix.cols(), 4);
+  EXPECT_EQ(matrix.nonzeros(), 3);
+  EXPECT_EQ(matrix.at(2, 1), 2.0);
+  EXPECT_EQ(matrix.at(1, 1), 0.0);
+  EXPECT_TRUE(matrix.contains(2, 0));
+  EXPECT_FALSE(matrix.contains(2, 2));
+  EXPECT_EQ(matrix.row_size(1), 0);
+  EXPECT_EQ(matrix.row_size(2), 2);
+  EXPECT_THROW((void)matrix.at(0, 4), std::out_of_range);
+  EXPECT_THROW((void)matrix.row_size(3), std::out_of_range);
+  EXPECT_EQ(matrix.offsets()[3], 3);
+  EXPECT_EQ(matrix.columns()[1], 0);
+}
+
+TEST_F(ListMatrixTest, RandomTriplesMatchReference) {
+  Cells cells;
+  const auto builder = random_builder(300, 200, 5000, 3, cells);
+  const ListMatrix<long> matrix(builder);
+  expect_cells(matrix, cells);
+  for (const auto &[cell, value] : cells) {
+    ASSERT_EQ(matrix.at(cell.first, cell.second), value);
+  }
+}
+
+TEST_F(ListMatrixTest, ValuesAreMutableInPlace) {
+  ListMatrixBuilder<int> builder(2, 2);
+  builder.insert(1, 1, 5);
+  auto matrix = builder.build();
+  *matrix.find(1, 1) += 1;
+  EXPECT_EQ(matrix.find(0, 0), nullptr);
+  matrix.for_each_in_row(1, [](std::size_t, int &value) { value *= 2; });
+  EXPECT_EQ(matrix.at(1, 1), 12);
+}
+
+// Operation Tests
+TEST_F(ListMatrixTest, MultiplyMatchesDenseProduct) {
+  Cells cells;
+  const auto matrix = random_builder(1000, 700, 20000, 5, cells).build();
+  Vector<long> x(700);
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    x.data()[i] = static_cast<long>(i % 13) - 6;
+  }
+  Vector<long> expected(1000);
+  for (const auto &[cell, value] : cells) {
+    expected.data()[cell.first] += value * x.data()[cell.second];
+  }
+  for (std::size_t threads : {1, 2, 3, 8, 5000}) {
+    const auto y = matrix.multiply(x, threads);
+    ASSERT_EQ(y.size(), 1000);
+    for (std::size_t r = 0; r < 1000; ++r) {
+      ASSERT_EQ(y.data()[r], expected.data()[r]) << threads << " " << r;
+    }
+  }
+  EXPECT_THROW((void)matrix.multiply(Vector<long>(699)),
+               std::invalid_argument);
+}
+
+TEST_F(ListMatrixTest, SkewedRowsSplitAcrossThreads) {
+  // One row holds most of the entries, as a hub in a power-law graph.
+  ListMatrixBuilder<double> builder(64, 4096);
+  for (std::size_t col = 0; col < 4096; ++col) {
+    builder.insert(7, col, 1.0);
+  }
+  builder.insert(63, 0, 2.0);
+  const auto matrix = builder.build();
+  const auto y = matrix * Vector<double>(4096, 1.0);
+  EXPECT_EQ(y.data()[7], 4096.0);
+  EXPECT_EQ(y.data()[63], 2.0);
+  EXPECT_EQ(matrix.multiply(Vector<double>(4096, 1.0), 4).data()[7], 4096.0);
+}
+
+TEST_F(ListMatrixTest, SliceRows) {
+  Cells cells;
+  const auto matrix = random_builder(50, 40, 600, 7, cells).build();
+  const auto slice = matrix.slice_rows(10, 25);
+  ASSERT_EQ(slice.rows(), 15);
+  ASSERT_EQ(slice.cols(), 40);
+  Cells expected;
+  for (const auto &[cell, value] : cells) {
+    if (cell.first >= 10 && cell.first < 25) {
+      expected[{cell.first - 10, cell.second}] = value;
+    }
+  }
+  expect_cells(slice, expected);
+  EXPECT_EQ(matrix.slice_rows(0, 50), matrix);
+  EXPECT_EQ(matrix.slice_rows(20, 20).nonzeros(), 0);
+  EXPECT_THROW((void)matrix.slice_rows(30, 51), std::out_of_range);
+  EXPECT_THROW((void)matrix.slice_rows(30, 29), std::out_of_range);
+}
+
+TEST_F(ListMatrixTest, Transpose) {
+  Cells cells;
+  const auto matrix = random_builder(80, 120, 3000, 9, cells).build();
+  const auto transposed = matrix.transpose();
+  ASSERT_EQ(transposed.rows(), 120);
+  ASSERT_EQ(transposed.cols(), 80);
+  Cells expected;
+  for (const auto &[cell, value] : cells) {
+    expected[{cell.second, cell.first}] = value;
+  }
+  expect_cells(transposed, expected);
+  EXPECT_EQ(transposed.transpose(), matrix);
+
+  ListMatrixBuilder<long, std::uint8_t> narrow(255, 10);
+  narrow.insert(254, 9, 1);
+  EXPECT_EQ(narrow.build().transpose().at(9, 254), 1);
+  EXPECT_THROW((ListMatrixBuilder<long, std::uint8_t>(256, 1)),
+               std::length_error);
+}
+
+TEST_F(ListMatrixTest, EmptyMatrices) {
+  const ListMatrix<float> none;
+  EXPECT_EQ(none.rows(), 0);
+  EXPECT_EQ(none.multiply(Vector<float>()).size(), 0);
+  EXPECT_EQ(none.transpose(), none);
+
+  const auto blank = ListMatrixBuilder<float>(4, 3).build();
+  EXPECT_EQ(blank, (ListMatrix<float>(4, 3)));
+  const auto y = blank.multiply(Vector<float>(3, 1.0F), 2);
+  EXPECT_EQ(y.size(), 4);
+  EXPECT_EQ(y.data()[3], 0.0F);
+}
+
+TEST_F(ListMatrixTest, MovedFromMatrixIsEmpty) {
+  ListMatrixBuilder<long> builder(3, 3);
+  builder.insert(1, 2, 7);
+  ListMatrix<long> source(builder);
+  ListMatrix<long> target(std::move(source));
+  EXPECT_EQ(target.at(1, 2), 7);
+  EXPECT_EQ(source.rows(), 0);
+  EXPECT_EQ(source.cols(), 0);
+  EXPECT_EQ(source, ListMatrix<long>());
+  EXPECT_EQ(source.offsets()[0], 0u);
+  EXPECT_EQ(source.slice_rows(0, 0).rows(), 0);
+
+  source = std::move(target);
+  EXPECT_EQ(source.at(1, 2), 7);
+  EXPECT_EQ(target, ListMatrix<long>(0, 0));
+  EXPECT_EQ(target.transpose().nonzeros(), 0);
+}
@@ -0,0 +1,193 @@
+#include "../include/LruCache.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+class LruCacheTest : public ::testing::Test {
+protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+// Construction Tests
+TEST_F(LruCacheTest, Constructor_CreatesEmptyCache) {
+  LruCache<int, std::string> cache(3);
+  EXPECT_TRUE(cache.is_empty());
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_EQ(cache.capacity(), 3);
+  EXPECT_EQ(cache.bytes(), 0);
+}
+
+TEST_F(LruCacheTest, Constructor_ThrowsOnZeroCapacity) {
+  using Cache = LruCache<int, int>;
+  EXPECT_THROW(Cache cache(0), std::invalid_argument);
+  EXPECT_THROW(Cache cache(1, 0), std::invalid_argument);
+}
+
+// Lookup and Insertion Tests
+TEST_F(LruCacheTest, PutAndGet_ReturnsStoredValue) {
+  LruCache<int, std::string> cache(3);
+  cache.put(1, "one");
+  cache.put(2, "two");
+
+  ASSERT_NE(cache.get(1), nullptr);
+  EXPECT_EQ(*cache.get(1), "one");
+  EXPECT_EQ(cache.get(3), nullptr);
+  EXPECT_TRUE(cache.contains(2));
+  EXPECT_FALSE(cache.contains(3));
+}
+
+TEST_F(LruCacheTest, Put_ReplacesExistingValue) {
+  LruCache<int, std::string> cache(2);
+  cache.put(1, "one");
+  cache.put(1, "uno");
+
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(*cache.get(1), "uno");
+}
+
+// Eviction Tests
+TEST_F(LruCacheTest, Put_EvictsLeastRecentlyUsed) {
+  LruCache<int, int> cache(2);
+  cache.put(1, 10);
+  cache.put(2, 20);
+  static_cast<void>(cache.get(1)); // 2 is now least recently used
+  cache.put(3, 30);
+
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_TRUE(cache.contains(1));
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_TRUE(cache.contains(3));
+}
+
+TEST_F(LruCacheTest, Peek_DoesNotChangeRecency) {
+  LruCache<int, int> cache(2);
+  cache.put(1, 10);
+  cache.put(2, 20);
+  ASSERT_NE(cache.peek(1), nullptr);
+  EXPECT_EQ(*cache.peek(1), 10);
+  cache.put(3, 30);
+
+  EXPECT_FALSE(cache.contains(1));
+}
+
+TEST_F(LruCacheTest, ByteBound_EvictsUntilWithinBudget) {
+  struct StringBytes {
+    auto operator()(int, const std::string &value) const -> std::size_t {
+      return value.size();
+    }
+  };
+  LruCache<int, std::string, std::hash<int>, std::equal_to<int>, StringBytes>
+      cache(10, 10);
+
+  cache.put(1, "aaaa");
+  cache.put(2, "bbbb");
+  EXPECT_EQ(cache.bytes(), 8);
+
+  cache.put(3, "cccccc"); // 14 bytes, evicts 1 and leaves 10
+  EXPECT_EQ(cache.bytes(), 10);
+  EXPECT_FALSE(cache.contains(1));
+  EXPECT_TRUE(cache.contains(2));
+
+  EXPECT_THROW(cache.put(4, std::string(11, 'd')), std::length_error);
+  EXPECT_EQ(cache.size(), 2);
+}
+
+TEST_F(LruCacheTest, OnEvict_ReceivesEvictedEntries) {
+  LruCache<int, std::string> cache(2);
+  std::vector<int> evicted;
+  cache.on_evict(
+      [&evicted](const int &key, std::string &) { evicted.push_back(key); });
+
+  cache.put(1, "one");
+  cache.put(2, "two");
+  cache.put(3, "three");
+  cache.put(4, "four");
+  cache.erase(3);
+
+  ASSERT_EQ(evicted.size(), 2);
+  EXPECT_EQ(evicted[0], 1);
+  EXPECT_EQ(evicted[1], 2);
+}
+
+// Removal Tests
+TEST_F(LruCacheTest, EraseAndClear_RemoveEntries) {
+  LruCache<int, int> cache(3);
+  cache.put(1, 10);
+  cache.put(2, 20);
+
+  EXPECT_TRUE(cache.erase(1));
+  EXPECT_FALSE(cache.erase(1));
+  EXPECT_EQ(cache.size(), 1);
+
+  cache.clear();
+  EXPECT_TRUE(cache.is_empty());
+  EXPECT_EQ(cache.bytes(), 0);
+}
+
+TEST_F(LruCacheTest, ForEach_VisitsMostRecentFirst) {
+  LruCache<int, int> cache(3);
+  cache.put(1, 10);
+  cache.put(2, 20);
+  cache.put(3, 30);
+  static_cast<void>(cache.get(1));
+
+  std::vector<int> order;
+  cache.for_each([&order](const int &key, const int &) { order.push_back(key); });
+  EXPECT_EQ(order, (std::vector<int>{1, 3, 2}));
+}
+
+// Sharded Variant Tests
+TEST_F(LruCacheTest, Sharded_PutGetAndErase) {
+  ShardedLruCache<int, std::string> cache(64, 4);
+  EXPECT_EQ(cache.shard_count(), 4);
+
+  cache.put(1, "one");
+  EXPECT_EQ(cache.get(1), std::optional<std::string>("one"));
+  EXPECT_EQ(cache.get(2), std::nullopt);
+  EXPECT_TRUE(cache.erase(1));
+  EXPECT_EQ(cache.size(), 0);
+
+  EXPECT_THROW((ShardedLruCache<int, int>(4, 8)), std::invalid_argument);
+}
+
+TEST_F(LruCacheTest, Sharded_BoundsAddUpToTotals) {
+  ShardedLruCache<int, int> cache(10, 4);
+  for (int key = 0; key < 1'000; ++key) {
+    cache.put(key, key);
+    ASSERT_LE(cache.size(), 10);
+  }
+  EXPECT_EQ(cache.size(), 10);
+
+  struct UnitWeight {
+    auto operator()(int, int) const noexcept -> std::size_t { return 1; }
+  };
+  ShardedLruCache<int, int, std::hash<int>, std::equal_to<int>, UnitWeight>
+      weighed(100, 4, 10);
+  for (int key = 0; key < 1'000; ++key) {
+    weighed.put(key, key);
+    ASSERT_LE(weighed.size(), 10);
+  }
+  EXPECT_THROW((ShardedLruCache<int, int>(16, 4, 3)), std::invalid_argument);
+}
+
+TEST_F(LruCacheTest, Sharded_ConcurrentAccessRespectsCapacity) {
+  ShardedLruCache<int, int> cache(256, 8);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&cache, t] {
+      for (int i = 0; i < 10'000; ++i) {
+        const int key = (i * 7 + t) % 1'000;
+        if (!cache.get(key)) {
+          cache.put(key, key);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_LE(cache.size(), 256);
+  EXPECT_GT(cache.size(), 0);
+}
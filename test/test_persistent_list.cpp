@@ -0,0 +1,120 @@
+#include "../include/PersistentList.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test fixture for PersistentList
+class PersistentListTest : public ::testing::Test {
+protected:
+  PersistentList<int> int_list;
+  PersistentList<std::string> string_list;
+
+  template <typename T>
+  static auto to_vector(const PersistentList<T> &list) -> std::vector<T> {
+    return std::vector<T>(list.begin(), list.end());
+  }
+};
+
+// Construction Tests
+TEST_F(PersistentListTest, DefaultConstructorCreatesEmptyList) {
+  EXPECT_TRUE(int_list.is_empty());
+  EXPECT_EQ(int_list.size(), 0);
+  EXPECT_EQ(int_list.begin(), int_list.end());
+  EXPECT_THROW((void)int_list.top(), std::out_of_range);
+}
+
+TEST_F(PersistentListTest, InitializerListKeepsOrder) {
+  PersistentList<int> list{1, 2, 3};
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(list.top(), 1);
+  EXPECT_EQ(to_vector(list), (std::vector<int>{1, 2, 3}));
+}
+
+// Modifier Tests
+TEST_F(PersistentListTest, AddAndRemoveFront) {
+  string_list.add_front("b");
+  string_list.add_front(std::string("a"));
+  EXPECT_EQ(string_list.emplace_front(3, 'z'), "zzz");
+  EXPECT_EQ(to_vector(string_list),
+            (std::vector<std::string>{"zzz", "a", "b"}));
+
+  string_list.remove_front();
+  EXPECT_EQ(string_list.top(), "a");
+  EXPECT_EQ(string_list.size(), 2);
+
+  string_list.clear();
+  EXPECT_TRUE(string_list.is_empty());
+  EXPECT_THROW(string_list.remove_front(), std::out_of_range);
+}
+
+// Sharing Tests
+TEST_F(PersistentListTest, SnapshotIsUnaffectedByLaterUpdates) {
+  int_list.add_front(2);
+  int_list.add_front(1);
+  const auto before = int_list.snapshot();
+  EXPECT_TRUE(before.shares_with(int_list));
+
+  int_list.remove_front();
+  int_list.add_front(10);
+  int_list.add_front(20);
+
+  EXPECT_EQ(to_vector(before), (std::vector<int>{1, 2}));
+  EXPECT_EQ(to_vector(int_list), (std::vector<int>{20, 10, 2}));
+  EXPECT_FALSE(before.shares_with(int_list));
+}
+
+TEST_F(PersistentListTest, TailSharesNodes) {
+  PersistentList<int> list{1, 2, 3};
+  const auto rest = list.tail();
+  EXPECT_EQ(rest.size(), 2);
+  EXPECT_EQ(&*rest.begin(), &*std::next(list.begin()));
+  EXPECT_THROW((void)PersistentList<int>().tail(), std::out_of_range);
+}
+
+TEST_F(PersistentListTest, NodesAreFreedWithTheLastOwner) {
+  auto tracker = std::make_shared<int>(0);
+  {
+    PersistentList<std::shared_ptr<int>> list;
+    list.add_front(tracker);
+    auto copy = list;
+    list.clear();
+    EXPECT_EQ(tracker.use_count(), 2);
+    auto moved = std::move(copy);
+    EXPECT_TRUE(copy.is_empty());
+    EXPECT_EQ(tracker.use_count(), 2);
+  }
+  EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST_F(PersistentListTest, LongChainReleasesWithoutRecursion) {
+  for (int i = 0; i < 1000000; ++i) {
+    int_list.add_front(i);
+  }
+  int_list.clear();
+  EXPECT_TRUE(int_list.is_empty());
+}
+
+TEST_F(PersistentListTest, SnapshotsCanBeReadAndDroppedFromOtherThreads) {
+  for (int i = 0; i < 1000; ++i) {
+    int_list.add_front(i);
+  }
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; ++t) {
+    readers.emplace_back([snapshot = int_list.snapshot()] {
+      long sum = 0;
+      for (int value : snapshot) {
+        sum += value;
+      }
+      EXPECT_EQ(sum, 999L * 1000 / 2);
+    });
+  }
+  for (int i = 0; i < 1000; ++i) {
+    int_list.remove_front();
+  }
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  EXPECT_TRUE(int_list.is_empty());
+}
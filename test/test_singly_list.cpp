@@ -1,6 +1,8 @@
 #include "../include/SinglyList.hpp"
 #include <gtest/gtest.h>
+#include <memory>
 #include <string>
+#include <vector>
 
 class SinglyListTest : public ::testing::Test {
 protected:
@@ -154,3 +156,263 @@ TEST_F(SinglyListTest, IteratorOperations) {
   EXPECT_TRUE(it2 != it);
   EXPECT_TRUE(it2 != list.end());
 }
+
+// Sort, Merge, Splice and Reverse Tests
+TEST_F(SinglyListTest, Sort_OrdersElementsAscending) {
+  SinglyList<int> list{5, 3, 9, 1, 7, 2, 8};
+  list.sort();
+
+  int expected[] = {1, 2, 3, 5, 7, 8, 9};
+  size_t i = 0;
+  for (const auto &value : list) {
+    EXPECT_EQ(value, expected[i++]);
+  }
+  EXPECT_EQ(i, 7);
+  EXPECT_EQ(list.top(), 1);
+  EXPECT_EQ(list.bottom(), 9);
+
+  list.add(10);
+  EXPECT_EQ(list.bottom(), 10);
+}
+
+TEST_F(SinglyListTest, Sort_WithComparator_IsStable) {
+  SinglyList<std::pair<int, int>> list{{2, 0}, {1, 1}, {2, 2}, {1, 3}, {0, 4}};
+  list.sort([](const auto &a, const auto &b) { return a.first < b.first; });
+
+  std::pair<int, int> expected[] = {{0, 4}, {1, 1}, {1, 3}, {2, 0}, {2, 2}};
+  size_t i = 0;
+  for (const auto &value : list) {
+    EXPECT_EQ(value, expected[i++]);
+  }
+}
+
+TEST_F(SinglyListTest, Sort_HandlesEmptyAndSingleElement) {
+  SinglyList<int> empty;
+  empty.sort();
+  EXPECT_TRUE(empty.is_empty());
+  EXPECT_EQ(empty.begin(), empty.end());
+
+  SinglyList<int> single{42};
+  single.sort();
+  EXPECT_EQ(single.top(), 42);
+  EXPECT_EQ(single.bottom(), 42);
+}
+
+TEST_F(SinglyListTest, Merge_CombinesSortedLists) {
+  SinglyList<int> list1{1, 4, 6};
+  SinglyList<int> list2{2, 3, 5, 7};
+  list1.merge(list2);
+
+  EXPECT_TRUE(list2.is_empty());
+  EXPECT_EQ(list1.size(), 7);
+  int expected = 1;
+  for (const auto &value : list1) {
+    EXPECT_EQ(value, expected++);
+  }
+  EXPECT_EQ(list1.bottom(), 7);
+}
+
+TEST_F(SinglyListTest, Splice_MovesWholeListAtPosition) {
+  SinglyList<int> list1{1, 5};
+  SinglyList<int> list2{2, 3, 4};
+
+  auto pos = list1.begin();
+  ++pos;
+  list1.splice(pos, list2);
+
+  EXPECT_TRUE(list2.is_empty());
+  EXPECT_EQ(list1.size(), 5);
+  int expected = 1;
+  for (const auto &value : list1) {
+    EXPECT_EQ(value, expected++);
+  }
+
+  SinglyList<int> list3{6};
+  list1.splice(list1.end(), list3);
+  EXPECT_EQ(list1.bottom(), 6);
+}
+
+TEST_F(SinglyListTest, Splice_MovesRange) {
+  SinglyList<int> list1{1, 5};
+  SinglyList<int> list2{0, 2, 3, 4, 9};
+
+  auto first = list2.begin();
+  ++first;
+  auto last = first;
+  ++last;
+  ++last;
+  ++last;
+  auto pos = list1.begin();
+  ++pos;
+  list1.splice(pos, list2, first, last);
+
+  EXPECT_EQ(list1.size(), 5);
+  EXPECT_EQ(list2.size(), 2);
+  int expected = 1;
+  for (const auto &value : list1) {
+    EXPECT_EQ(value, expected++);
+  }
+  EXPECT_EQ(list2.top(), 0);
+  EXPECT_EQ(list2.bottom(), 9);
+}
+
+TEST_F(SinglyListTest, Reverse_ReversesOrder) {
+  SinglyList<int> list{1, 2, 3, 4};
+  list.reverse();
+
+  int expected = 4;
+  for (const auto &value : list) {
+    EXPECT_EQ(value, expected--);
+  }
+  EXPECT_EQ(list.top(), 4);
+  EXPECT_EQ(list.bottom(), 1);
+}
+
+// Move and Emplace Tests
+namespace {
+struct Tracked {
+  static inline int copies = 0;
+  static inline int moves = 0;
+
+  std::string value;
+
+  Tracked() = default;
+  explicit Tracked(std::string v) : value(std::move(v)) {}
+  Tracked(std::size_t count, char c) : value(count, c) {}
+  Tracked(const Tracked &other) : value(other.value) { ++copies; }
+  Tracked(Tracked &&other) noexcept : value(std::move(other.value)) {
+    ++moves;
+  }
+
+  static auto reset() -> void { copies = moves = 0; }
+};
+} // namespace
+
+TEST_F(SinglyListTest, AddRvalue_MovesWithoutCopy) {
+  SinglyList<Tracked> list;
+  Tracked::reset();
+
+  list.add(Tracked("moved"));
+  list.add_front(Tracked("front"));
+  list.add_back(Tracked("back"));
+
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(Tracked::moves, 3);
+  EXPECT_EQ(list.top().value, "front");
+  EXPECT_EQ(list.bottom().value, "back");
+}
+
+TEST_F(SinglyListTest, Emplace_ConstructsInsideNode) {
+  SinglyList<Tracked> list;
+  Tracked::reset();
+
+  auto &back = list.emplace_back(64, 'x');
+  auto &front = list.emplace_front("front");
+
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(Tracked::moves, 0);
+  EXPECT_EQ(back.value, std::string(64, 'x'));
+  EXPECT_EQ(front.value, "front");
+  EXPECT_EQ(list.size(), 2);
+}
+
+TEST_F(SinglyListTest, InitializerList_CopiesEachElementOnce) {
+  Tracked::reset();
+  SinglyList<Tracked> list{Tracked("a"), Tracked("b"), Tracked("c")};
+
+  EXPECT_EQ(Tracked::copies, 3);
+  EXPECT_EQ(list.size(), 3);
+}
+
+TEST_F(SinglyListTest, NonDefaultConstructibleElements_AreSupported) {
+  struct Point {
+    Point(int x, int y) : x(x), y(y) {}
+    int x;
+    int y;
+  };
+  SinglyList<Point> list;
+  list.emplace_back(1, 2);
+  list.emplace_front(0, 1);
+  list.add(Point(2, 3));
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(list.top().x, 0);
+  EXPECT_EQ(list.bottom().y, 3);
+}
+
+TEST_F(SinglyListTest, MoveOnlyElements_AreSupported) {
+  SinglyList<std::unique_ptr<int>> list;
+  list.add(std::make_unique<int>(3));
+  list.emplace_back(new int(1));
+  list.emplace_front(std::make_unique<int>(2));
+
+  list.sort([](const auto &a, const auto &b) { return *a < *b; });
+
+  int expected = 1;
+  for (const auto &value : list) {
+    EXPECT_EQ(*value, expected++);
+  }
+  EXPECT_EQ(*list.top(), 1);
+  EXPECT_EQ(*list.bottom(), 3);
+
+  SinglyList<std::unique_ptr<int>> moved(std::move(list));
+  EXPECT_EQ(moved.size(), 3);
+}
+
+TEST_F(SinglyListTest, ForEach_VisitsInOrder) {
+  SinglyList<int> list{1, 2, 3, 4, 5};
+  std::vector<int> seen;
+  list.for_each([&](int &value) { seen.push_back(value++); }, 2);
+  EXPECT_EQ(seen, (std::vector<int>{1, 2, 3, 4, 5}));
+  EXPECT_EQ(list.top(), 2);
+
+  const SinglyList<int> &clist = list;
+  int sum = 0;
+  clist.for_each([&](const int &value) { sum += value; });
+  EXPECT_EQ(sum, 20);
+
+  SinglyList<int>().for_each([](int &) { FAIL(); });
+}
+
+TEST_F(SinglyListTest, ForEachBatch_CoversEveryElementOnce) {
+  SinglyList<int> list;
+  for (int i = 0; i < 37; ++i) {
+    list.add_back(i);
+  }
+  std::vector<int> seen;
+  std::vector<size_t> counts;
+  list.for_each_batch<8>([&](int *const *items, size_t count) {
+    counts.push_back(count);
+    for (size_t i = 0; i < count; ++i) {
+      seen.push_back(*items[i]);
+    }
+  });
+  EXPECT_EQ(counts, (std::vector<size_t>{8, 8, 8, 8, 5}));
+  ASSERT_EQ(seen.size(), 37);
+  for (int i = 0; i < 37; ++i) {
+    EXPECT_EQ(seen[i], i);
+  }
+}
+
+TEST_F(SinglyListTest, Compact_KeepsOrderAndFollowsAddresses) {
+  SinglyList<std::string> list;
+  for (int i = 0; i < 50; ++i) {
+    list.add_back(std::to_string((i * 37) % 50));
+  }
+  list.sort();
+  std::vector<std::string> before(list.cbegin(), list.cend());
+
+  list.compact();
+  std::vector<std::string> after(list.cbegin(), list.cend());
+  EXPECT_EQ(before, after);
+  EXPECT_EQ(list.bottom(), before.back());
+
+  const std::string *prev = nullptr;
+  for (const auto &value : list) {
+    if (prev != nullptr) {
+      EXPECT_TRUE(std::less<const std::string *>{}(prev, &value));
+    }
+    prev = &value;
+  }
+  list.add_back("tail");
+  EXPECT_EQ(list.bottom(), "tail");
+}
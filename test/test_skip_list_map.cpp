@@ -0,0 +1,223 @@
+#include "../include/SkipListMap.hpp"
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test fixture for SkipListMap
+class SkipListMapTest : public ::testing::Test {
+protected:
+  SkipListMap<int, std::string> map;
+};
+
+// Construction Tests
+TEST_F(SkipListMapTest, DefaultConstructorCreatesEmptyMap) {
+  EXPECT_TRUE(map.is_empty());
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(map.find(1), map.end());
+}
+
+TEST_F(SkipListMapTest, InitializerListConstructorOrdersKeys) {
+  SkipListMap<int, int> ordered{{3, 30}, {1, 10}, {2, 20}, {1, 99}};
+  EXPECT_EQ(ordered.size(), 3);
+  std::vector<int> keys;
+  for (const auto &[key, value] : ordered) {
+    keys.push_back(key);
+    EXPECT_EQ(value, key * 10);
+  }
+  EXPECT_EQ(keys, (std::vector<int>{1, 2, 3}));
+}
+
+TEST_F(SkipListMapTest, CopyAndMovePreserveEntries) {
+  map.insert(2, "b");
+  map.insert(1, "a");
+
+  SkipListMap<int, std::string> copy(map);
+  EXPECT_EQ(copy.size(), 2);
+  EXPECT_EQ(copy.at(1), "a");
+  copy.erase(1);
+  EXPECT_TRUE(map.contains(1));
+
+  SkipListMap<int, std::string> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 1);
+  EXPECT_EQ(moved.at(2), "b");
+  EXPECT_EQ(moved.begin()->first, 2);
+}
+
+// Insertion and Lookup Tests
+TEST_F(SkipListMapTest, InsertRejectsDuplicateKeys) {
+  auto [it, inserted] = map.insert(5, "five");
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(it->second, "five");
+
+  auto [dup, again] = map.insert(5, "other");
+  EXPECT_FALSE(again);
+  EXPECT_EQ(dup, it);
+  EXPECT_EQ(map.at(5), "five");
+  EXPECT_EQ(map.size(), 1);
+}
+
+TEST_F(SkipListMapTest, InsertOrAssignOverwrites) {
+  EXPECT_TRUE(map.insert_or_assign(1, "a"));
+  EXPECT_FALSE(map.insert_or_assign(1, "b"));
+  EXPECT_EQ(map.at(1), "b");
+}
+
+TEST_F(SkipListMapTest, SubscriptDefaultConstructsMissingValues) {
+  map[3] += "x";
+  map[3] += "y";
+  EXPECT_EQ(map.at(3), "xy");
+  EXPECT_EQ(map[4], "");
+  EXPECT_EQ(map.size(), 2);
+}
+
+TEST_F(SkipListMapTest, AtThrowsOnMissingKey) {
+  EXPECT_THROW((void)map.at(1), std::out_of_range);
+  const auto &cmap = map;
+  EXPECT_THROW((void)cmap.at(1), std::out_of_range);
+}
+
+TEST_F(SkipListMapTest, EmplaceSupportsMoveOnlyValues) {
+  SkipListMap<int, std::unique_ptr<int>> owners;
+  owners.emplace(1, std::make_unique<int>(7));
+  EXPECT_EQ(*owners.at(1), 7);
+}
+
+// Erase Tests
+TEST_F(SkipListMapTest, EraseByKey) {
+  map.insert(1, "a");
+  map.insert(2, "b");
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_EQ(map.erase(1), 0);
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(map.begin()->first, 2);
+  EXPECT_EQ((--map.end())->first, 2);
+}
+
+TEST_F(SkipListMapTest, EraseByIteratorReturnsNext) {
+  for (int i = 0; i < 5; ++i) {
+    map.insert(i, std::to_string(i));
+  }
+  auto it = map.erase(map.find(2));
+  EXPECT_EQ(it->first, 3);
+  it = map.erase(--map.end());
+  EXPECT_EQ(it, map.end());
+  EXPECT_EQ((--map.end())->first, 3);
+  EXPECT_THROW(map.erase(map.end()), std::out_of_range);
+}
+
+TEST_F(SkipListMapTest, ClearEmptiesAndStaysUsable) {
+  for (int i = 0; i < 100; ++i) {
+    map.insert(i, "v");
+  }
+  map.clear();
+  EXPECT_TRUE(map.is_empty());
+  EXPECT_EQ(map.begin(), map.end());
+  map.insert(1, "a");
+  EXPECT_EQ(map.at(1), "a");
+}
+
+// Ordered Access Tests
+TEST_F(SkipListMapTest, BoundsAndScan) {
+  for (int i = 0; i < 20; i += 2) {
+    map.insert(i, std::to_string(i));
+  }
+  EXPECT_EQ(map.lower_bound(4)->first, 4);
+  EXPECT_EQ(map.lower_bound(5)->first, 6);
+  EXPECT_EQ(map.upper_bound(4)->first, 6);
+  EXPECT_EQ(map.lower_bound(100), map.end());
+
+  std::vector<int> seen;
+  const auto count = map.scan(
+      3, 11, [&](const int &key, const std::string &) { seen.push_back(key); });
+  EXPECT_EQ(count, 4);
+  EXPECT_EQ(seen, (std::vector<int>{4, 6, 8, 10}));
+}
+
+TEST_F(SkipListMapTest, BidirectionalIteration) {
+  for (int i = 0; i < 10; ++i) {
+    map.insert(i, std::to_string(i));
+  }
+  int expected = 9;
+  for (auto it = map.end(); it != map.begin();) {
+    --it;
+    EXPECT_EQ(it->first, expected--);
+  }
+  EXPECT_EQ(expected, -1);
+}
+
+TEST_F(SkipListMapTest, MatchesStdMapUnderRandomOperations) {
+  SkipListMap<int, int> skip;
+  std::map<int, int> reference;
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> keys(0, 500);
+  for (int i = 0; i < 20000; ++i) {
+    const int key = keys(rng);
+    if (rng() % 3 == 0) {
+      EXPECT_EQ(skip.erase(key), reference.erase(key));
+    } else {
+      EXPECT_EQ(skip.insert(key, i).second, reference.emplace(key, i).second);
+    }
+  }
+  ASSERT_EQ(skip.size(), reference.size());
+  auto it = skip.begin();
+  for (const auto &[key, value] : reference) {
+    EXPECT_EQ(it->first, key);
+    EXPECT_EQ(it->second, value);
+    ++it;
+  }
+  EXPECT_EQ(it, skip.end());
+}
+
+// ConcurrentSkipListMap Tests
+TEST(ConcurrentSkipListMapTest, InsertFindAndScan) {
+  ConcurrentSkipListMap<int, std::string> map;
+  EXPECT_TRUE(map.is_empty());
+  EXPECT_TRUE(map.insert(2, "b"));
+  EXPECT_TRUE(map.insert(1, "a"));
+  EXPECT_FALSE(map.insert(1, "z"));
+  EXPECT_EQ(map.size(), 2);
+  ASSERT_NE(map.find(1), nullptr);
+  EXPECT_EQ(*map.find(1), "a");
+  EXPECT_EQ(map.find(3), nullptr);
+
+  std::vector<int> seen;
+  map.scan(0, 10, [&](const int &key, const std::string &) {
+    seen.push_back(key);
+  });
+  EXPECT_EQ(seen, (std::vector<int>{1, 2}));
+}
+
+TEST(ConcurrentSkipListMapTest, ConcurrentInsertsAreAllVisible) {
+  constexpr int threads = 4;
+  constexpr int per_thread = 5000;
+  ConcurrentSkipListMap<int, int> map;
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&map, t] {
+      // Interleaved keys so threads contend on neighbouring links; every
+      // key is also attempted by a second thread to exercise duplicates.
+      for (int i = 0; i < per_thread; ++i) {
+        map.insert(i * threads + t, t);
+        map.insert(i * threads + (t + 1) % threads, t);
+        (void)map.contains(i * threads);
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  EXPECT_EQ(map.size(), static_cast<size_t>(threads * per_thread));
+  int expected = 0;
+  map.scan(0, threads * per_thread, [&](const int &key, const int &) {
+    EXPECT_EQ(key, expected++);
+  });
+  EXPECT_EQ(expected, threads * per_thread);
+}
@@ -0,0 +1,157 @@
+#include "../include/SmallVector.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Test fixture for SmallVector and GrowableStack
+class SmallVectorTest : public ::testing::Test {
+protected:
+  static constexpr size_t inline_size = 4;
+  SmallVector<int, inline_size> int_vector;
+  SmallVector<std::string, inline_size> string_vector;
+
+  template <typename VectorType>
+  static auto values(const VectorType &vector)
+      -> std::vector<typename VectorType::value_type> {
+    return {vector.begin(), vector.end()};
+  }
+};
+
+// Construction Tests
+TEST_F(SmallVectorTest, DefaultConstructorIsEmptyAndInline) {
+  EXPECT_TRUE(int_vector.empty());
+  EXPECT_TRUE(int_vector.is_inline());
+  EXPECT_EQ(int_vector.capacity(), inline_size);
+  EXPECT_EQ(int_vector.begin(), int_vector.end());
+}
+
+TEST_F(SmallVectorTest, InitializerListSpillsOnlyWhenNeeded) {
+  SmallVector<int, 4> small{1, 2, 3};
+  EXPECT_TRUE(small.is_inline());
+  SmallVector<int, 4> large{1, 2, 3, 4, 5};
+  EXPECT_FALSE(large.is_inline());
+  EXPECT_EQ(values(large), (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+// Growth Tests
+TEST_F(SmallVectorTest, SpillsToHeapBeyondInlineCapacity) {
+  for (int i = 0; i < 4; ++i) {
+    string_vector.push_back(std::to_string(i));
+  }
+  EXPECT_TRUE(string_vector.is_inline());
+  string_vector.push_back(string_vector.front());
+  EXPECT_FALSE(string_vector.is_inline());
+  EXPECT_EQ(string_vector.capacity(), 8);
+  EXPECT_EQ(values(string_vector),
+            (std::vector<std::string>{"0", "1", "2", "3", "0"}));
+}
+
+TEST_F(SmallVectorTest, ShrinkToFitReturnsInline) {
+  for (int i = 0; i < 10; ++i) {
+    int_vector.push_back(i);
+  }
+  while (int_vector.size() > 3) {
+    int_vector.pop_back();
+  }
+  int_vector.shrink_to_fit();
+  EXPECT_TRUE(int_vector.is_inline());
+  EXPECT_EQ(values(int_vector), (std::vector<int>{0, 1, 2}));
+
+  int_vector.reserve(20);
+  EXPECT_FALSE(int_vector.is_inline());
+  EXPECT_EQ(int_vector.capacity(), 20);
+  for (int i = 3; i < 6; ++i) {
+    int_vector.push_back(i);
+  }
+  int_vector.shrink_to_fit();
+  EXPECT_EQ(int_vector.capacity(), 6);
+}
+
+// Copy and Move Tests
+TEST_F(SmallVectorTest, MoveOfInlineVectorRelocatesElements) {
+  string_vector.push_back("a");
+  string_vector.push_back("b");
+  SmallVector<std::string, inline_size> moved(std::move(string_vector));
+  EXPECT_TRUE(moved.is_inline());
+  EXPECT_EQ(values(moved), (std::vector<std::string>{"a", "b"}));
+  EXPECT_TRUE(string_vector.empty());
+  EXPECT_TRUE(string_vector.is_inline());
+}
+
+TEST_F(SmallVectorTest, MoveOfSpilledVectorStealsBuffer) {
+  for (int i = 0; i < 8; ++i) {
+    int_vector.push_back(i);
+  }
+  const int *buffer = int_vector.data();
+  SmallVector<int, inline_size> moved(std::move(int_vector));
+  EXPECT_EQ(moved.data(), buffer);
+  EXPECT_TRUE(int_vector.is_inline());
+  EXPECT_TRUE(int_vector.empty());
+
+  int_vector = std::move(moved);
+  EXPECT_EQ(int_vector.data(), buffer);
+  EXPECT_EQ(int_vector.size(), 8);
+}
+
+TEST_F(SmallVectorTest, CopyIsDeep) {
+  string_vector = {"x", "y", "z", "w", "v"};
+  SmallVector<std::string, inline_size> copy(string_vector);
+  copy[0] = "changed";
+  EXPECT_EQ(string_vector[0], "x");
+  copy = string_vector;
+  EXPECT_EQ(values(copy), values(string_vector));
+}
+
+// Modifier Tests
+TEST_F(SmallVectorTest, EraseAndAccessChecks) {
+  int_vector = {0, 1, 2, 3, 4, 5};
+  EXPECT_EQ(*int_vector.erase(int_vector.begin() + 1), 2);
+  int_vector.erase(int_vector.begin(), int_vector.begin() + 2);
+  EXPECT_EQ(values(int_vector), (std::vector<int>{3, 4, 5}));
+  EXPECT_THROW(int_vector.erase(int_vector.end()), std::out_of_range);
+  EXPECT_THROW((void)int_vector[3], std::out_of_range);
+
+  int_vector.clear();
+  EXPECT_THROW(int_vector.pop_back(), std::out_of_range);
+  EXPECT_THROW((void)int_vector.back(), std::out_of_range);
+}
+
+TEST_F(SmallVectorTest, MoveOnlyElementsAreSupported) {
+  SmallVector<std::unique_ptr<int>, 2> vector;
+  for (int i = 0; i < 5; ++i) {
+    vector.emplace_back(std::make_unique<int>(i));
+  }
+  SmallVector<std::unique_ptr<int>, 2> moved(std::move(vector));
+  EXPECT_EQ(*moved.back(), 4);
+}
+
+// GrowableStack Tests
+TEST_F(SmallVectorTest, GrowableStackNeverOverflows) {
+  GrowableStack<int, 4> stack;
+  EXPECT_THROW((void)stack.top(), std::out_of_range);
+  EXPECT_THROW(stack.pop(), std::out_of_range);
+  for (int i = 0; i < 4; ++i) {
+    stack.push(i);
+  }
+  EXPECT_TRUE(stack.is_inline());
+  for (int i = 4; i < 100; ++i) {
+    stack.emplace(i);
+  }
+  EXPECT_FALSE(stack.is_inline());
+  EXPECT_EQ(stack.size(), 100);
+  for (int i = 99; i >= 0; --i) {
+    EXPECT_EQ(stack.top(), i);
+    stack.pop();
+  }
+  EXPECT_TRUE(stack.is_empty());
+}
+
+TEST_F(SmallVectorTest, GrowableStackIteratesBottomToTop) {
+  GrowableStack<std::string> stack{"a", "b"};
+  stack.push("c");
+  std::vector<std::string> seen(stack.begin(), stack.end());
+  EXPECT_EQ(seen, (std::vector<std::string>{"a", "b", "c"}));
+  stack.top() = "C";
+  EXPECT_EQ(stack.top(), "C");
+}
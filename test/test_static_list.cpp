@@ -0,0 +1,149 @@
+#include "../include/StaticList.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+// Test fixture for StaticList
+class StaticListTest : public ::testing::Test {
+protected:
+  static constexpr size_t test_size = 4;
+  StaticList<int, test_size> int_list;
+  StaticList<std::string, test_size> string_list;
+};
+
+// Construction Tests
+TEST_F(StaticListTest, DefaultConstructorCreatesEmptyList) {
+  EXPECT_TRUE(int_list.empty());
+  EXPECT_EQ(int_list.size(), 0);
+  EXPECT_EQ(int_list.capacity(), test_size);
+  EXPECT_EQ(int_list.begin(), int_list.end());
+}
+
+TEST_F(StaticListTest, InitializerListConstructor) {
+  StaticList<int, 3> list{1, 2, 3};
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_TRUE(list.full());
+  EXPECT_EQ(list.top(), 1);
+  EXPECT_EQ(list.bottom(), 3);
+
+  using List = StaticList<int, 2>;
+  EXPECT_THROW((List{1, 2, 3}), std::length_error);
+}
+
+TEST_F(StaticListTest, CopyAndMovePreserveOrder) {
+  string_list.add_back("b");
+  string_list.add_front("a");
+
+  StaticList<std::string, test_size> copy(string_list);
+  EXPECT_EQ(copy.top(), "a");
+  EXPECT_EQ(copy.bottom(), "b");
+
+  StaticList<std::string, test_size> moved(std::move(string_list));
+  EXPECT_EQ(moved.size(), 2);
+  EXPECT_TRUE(string_list.empty());
+}
+
+// Modifier Tests
+TEST_F(StaticListTest, AddThrowsWhenFull) {
+  for (int i = 0; i < static_cast<int>(test_size); ++i) {
+    int_list.add(i);
+  }
+  EXPECT_TRUE(int_list.full());
+  EXPECT_THROW(int_list.add_back(9), std::length_error);
+  EXPECT_THROW(int_list.add_front(9), std::length_error);
+  EXPECT_EQ(int_list.size(), test_size);
+}
+
+TEST_F(StaticListTest, TryAddReturnsFalseWhenFull) {
+  for (size_t i = 0; i < test_size; ++i) {
+    EXPECT_TRUE(int_list.try_add_back(static_cast<int>(i)));
+  }
+  EXPECT_FALSE(int_list.try_add_back(9));
+  EXPECT_FALSE(int_list.try_add_front(9));
+
+  int_list.remove_front();
+  EXPECT_TRUE(int_list.try_add_front(7));
+  EXPECT_EQ(int_list.top(), 7);
+}
+
+TEST_F(StaticListTest, InsertEraseAndSpliceRelinkNodes) {
+  int_list.add_back(1);
+  int_list.add_back(3);
+  auto pos = int_list.begin();
+  ++pos;
+  int_list.insert(pos, 2); // [1, 2, 3]
+
+  auto it = int_list.erase(int_list.begin()); // [2, 3]
+  EXPECT_EQ(*it, 2);
+
+  auto last = int_list.end();
+  --last;
+  int_list.splice(int_list.begin(), last); // [3, 2]
+
+  std::vector<int> values(int_list.begin(), int_list.end());
+  EXPECT_EQ(values, (std::vector<int>{3, 2}));
+  EXPECT_EQ(int_list.bottom(), 2);
+  EXPECT_THROW(int_list.erase(int_list.end()), std::out_of_range);
+}
+
+TEST_F(StaticListTest, RemoveFromEmptyThrows) {
+  EXPECT_THROW(int_list.remove_front(), std::out_of_range);
+  EXPECT_THROW(int_list.remove_back(), std::out_of_range);
+  EXPECT_THROW(static_cast<void>(int_list.top()), std::out_of_range);
+}
+
+TEST_F(StaticListTest, ChurnReusesNodes) {
+  for (int round = 0; round < 1'000; ++round) {
+    int_list.add_back(round);
+    if (int_list.full()) {
+      int_list.remove_front();
+      int_list.remove_back();
+    }
+  }
+  EXPECT_LE(int_list.size(), test_size);
+
+  int_list.clear();
+  EXPECT_TRUE(int_list.empty());
+  for (size_t i = 0; i < test_size; ++i) {
+    int_list.add_front(static_cast<int>(i));
+  }
+  EXPECT_TRUE(int_list.full());
+}
+
+TEST_F(StaticListTest, ElementsAreConstructedInPlace) {
+  struct Counted {
+    Counted(int v, int &live) : value(v), live(&live) { ++live; }
+    Counted(const Counted &other) : value(other.value), live(other.live) {
+      ++*live;
+    }
+    ~Counted() { --*live; }
+    int value;
+    int *live;
+  };
+  int live = 0;
+  {
+    StaticList<Counted, 8> list; // no default constructor required
+    EXPECT_EQ(live, 0);
+    for (int i = 0; i < 8; ++i) {
+      list.emplace_back(i, live);
+    }
+    EXPECT_EQ(live, 8);
+    list.remove_front();
+    list.erase(list.begin());
+    EXPECT_EQ(live, 6);
+    StaticList<Counted, 8> copy(list);
+    EXPECT_EQ(live, 12);
+    EXPECT_EQ(copy.top().value, 2);
+    copy.clear();
+    EXPECT_EQ(live, 6);
+  }
+  EXPECT_EQ(live, 0);
+}
+
+// Template Constraint Tests
+TEST_F(StaticListTest, StorageIsInline) {
+  static_assert(sizeof(StaticList<int, 16>) >= 16 * sizeof(int),
+                "Nodes must be stored inside the list object");
+  static_assert(std::is_same_v<StaticList<int, 16>::index_type, std::uint16_t>,
+                "Small lists must use 16-bit links");
+}
@@ -0,0 +1,161 @@
+#include "../include/TreeHeap.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+// Test fixture for TreeHeap
+class TreeHeapTest : public ::testing::Test {
+protected:
+  TreeHeap<int> max_heap;
+  TreeHeap<int, std::greater<int>> min_heap;
+
+  template <typename HeapType>
+  static auto drain(HeapType &heap)
+      -> std::vector<typename HeapType::value_type> {
+    std::vector<typename HeapType::value_type> result;
+    while (!heap.empty()) {
+      result.push_back(heap.top());
+      heap.pop();
+    }
+    return result;
+  }
+};
+
+// Basic Operation Tests
+TEST_F(TreeHeapTest, EmptyHeapThrows) {
+  EXPECT_TRUE(max_heap.is_empty());
+  EXPECT_THROW((void)max_heap.top(), std::out_of_range);
+  EXPECT_THROW((void)max_heap.top_handle(), std::out_of_range);
+  EXPECT_THROW(max_heap.pop(), std::out_of_range);
+  EXPECT_THROW((void)max_heap.value({}), std::out_of_range);
+}
+
+TEST_F(TreeHeapTest, PushPopOrdersByCompare) {
+  for (int value : {5, 1, 9, 3, 7, 9}) {
+    max_heap.push(value);
+    min_heap.push(value);
+  }
+  EXPECT_EQ(max_heap.size(), 6);
+  EXPECT_EQ(drain(max_heap), (std::vector<int>{9, 9, 7, 5, 3, 1}));
+  EXPECT_EQ(drain(min_heap), (std::vector<int>{1, 3, 5, 7, 9, 9}));
+}
+
+// Meld Tests
+TEST_F(TreeHeapTest, MeldMovesEverythingAndKeepsHandles) {
+  TreeHeap<int, std::greater<int>> other{8, 2, 6};
+  min_heap.push(5);
+  auto handle = other.push(40);
+  min_heap.meld(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(min_heap.size(), 5);
+  min_heap.decrease_key(handle, 1);
+  EXPECT_EQ(min_heap.top_handle(), handle);
+
+  other.push(3);
+  min_heap.meld(std::move(other));
+  min_heap.meld(min_heap);
+  EXPECT_EQ(drain(min_heap), (std::vector<int>{1, 2, 3, 5, 6, 8}));
+}
+
+TEST_F(TreeHeapTest, MeldedHeapOutlivesSource) {
+  TreeHeap<std::string> target;
+  {
+    TreeHeap<std::string> source;
+    for (int i = 0; i < 5000; ++i) {
+      source.push(std::to_string(i));
+    }
+    target.meld(source);
+    source.push("still usable");
+    EXPECT_EQ(source.top(), "still usable");
+  }
+  EXPECT_EQ(target.size(), 5000);
+  EXPECT_EQ(target.top(), "999");
+}
+
+// Handle Tests
+TEST_F(TreeHeapTest, DecreaseKeyAndErase) {
+  auto a = min_heap.push(10);
+  auto b = min_heap.push(20);
+  auto c = min_heap.push(30);
+  min_heap.push(15);
+  min_heap.decrease_key(c, 5);
+  EXPECT_EQ(min_heap.top_handle(), c);
+  EXPECT_THROW(min_heap.decrease_key(a, 11), std::invalid_argument);
+  min_heap.erase(b);
+  min_heap.erase(c);
+  EXPECT_EQ(min_heap.value(a), 10);
+  EXPECT_EQ(drain(min_heap), (std::vector<int>{10, 15}));
+}
+
+// Copy and Move Tests
+TEST_F(TreeHeapTest, CopyAndMove) {
+  for (int i = 0; i < 50; ++i) {
+    max_heap.push(i * 37 % 50);
+  }
+  max_heap.pop();
+  TreeHeap<int> copy(max_heap);
+  EXPECT_EQ(copy.size(), 49);
+  TreeHeap<int> moved(std::move(max_heap));
+  EXPECT_TRUE(max_heap.empty());
+  EXPECT_EQ(drain(copy), drain(moved));
+
+  max_heap = {1, 2};
+  copy = max_heap;
+  EXPECT_EQ(copy.top(), 2);
+}
+
+// Stress Tests
+TEST_F(TreeHeapTest, RandomTraceMatchesReference) {
+  using HeapType = TreeHeap<int, std::greater<int>>;
+  std::mt19937 rng(40);
+  HeapType heaps[2];
+  std::vector<std::pair<HeapType::handle_type, int>> live[2];
+  for (int step = 0; step < 20000; ++step) {
+    const auto side = rng() % 2;
+    auto &heap = heaps[side];
+    auto &entries = live[side];
+    const auto op = rng() % 16;
+    if (op < 7 || entries.empty()) {
+      const int value = static_cast<int>(rng() % 100000);
+      entries.emplace_back(heap.push(value), value);
+    } else if (op < 10) {
+      auto &entry = entries[rng() % entries.size()];
+      entry.second -= static_cast<int>(rng() % 1000);
+      heap.decrease_key(entry.first, entry.second);
+    } else if (op < 12) {
+      const auto at = rng() % entries.size();
+      heap.erase(entries[at].first);
+      entries.erase(entries.begin() + static_cast<std::ptrdiff_t>(at));
+    } else if (op < 15) {
+      const auto popped = heap.top_handle();
+      const auto entry =
+          std::find_if(entries.begin(), entries.end(),
+                       [&](const auto &e) { return e.first == popped; });
+      ASSERT_NE(entry, entries.end());
+      for (const auto &e : entries) {
+        ASSERT_LE(heap.top(), e.second);
+      }
+      heap.pop();
+      entries.erase(entry);
+    } else {
+      heaps[1 - side].meld(heap);
+      auto &other = live[1 - side];
+      other.insert(other.end(), entries.begin(), entries.end());
+      entries.clear();
+    }
+    ASSERT_EQ(heaps[0].size() + heaps[1].size(),
+              live[0].size() + live[1].size());
+  }
+  for (int side = 0; side < 2; ++side) {
+    std::vector<int> expected;
+    for (const auto &entry : live[side]) {
+      EXPECT_EQ(heaps[side].value(entry.first), entry.second);
+      expected.push_back(entry.second);
+    }
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(drain(heaps[side]), expected);
+  }
+}
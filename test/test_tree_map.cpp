@@ -0,0 +1,279 @@
+#include "../include/TreeMap.hpp"
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+// Key that counts its copies and moves without throwing.
+struct CopyCountedKey {
+  static inline int copies = 0;
+  int value{0};
+
+  explicit CopyCountedKey(int v) : value(v) {}
+  CopyCountedKey(const CopyCountedKey &other) : value(other.value) {
+    ++copies;
+  }
+  CopyCountedKey(CopyCountedKey &&other) noexcept : value(other.value) {}
+  auto operator=(const CopyCountedKey &other) -> CopyCountedKey & {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  auto operator=(CopyCountedKey &&other) noexcept -> CopyCountedKey & {
+    value = other.value;
+    return *this;
+  }
+  auto operator<(const CopyCountedKey &other) const -> bool {
+    return value < other.value;
+  }
+};
+} // namespace
+
+// Test fixture for TreeMap
+class TreeMapTest : public ::testing::Test {
+protected:
+  TreeMap<int, std::string> map;
+
+  // Checks every entry against reference, walking forwards and backwards
+  // along the leaf chain.
+  template <typename MapType, typename Reference>
+  static auto expect_same(const MapType &tree, const Reference &reference)
+      -> void {
+    ASSERT_EQ(tree.size(), reference.size());
+    auto it = tree.begin();
+    for (const auto &[key, value] : reference) {
+      ASSERT_NE(it, tree.end());
+      ASSERT_EQ(it->first, key);
+      ASSERT_EQ(it->second, value);
+      ++it;
+    }
+    ASSERT_EQ(it, tree.end());
+    for (auto ref = reference.rbegin(); ref != reference.rend(); ++ref) {
+      --it;
+      ASSERT_EQ(it->first, ref->first);
+    }
+    ASSERT_EQ(it, tree.begin());
+  }
+};
+
+// Basic Operation Tests
+TEST_F(TreeMapTest, EmptyMap) {
+  EXPECT_TRUE(map.is_empty());
+  EXPECT_EQ(map.height(), 0);
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(map.find(1), map.end());
+  EXPECT_EQ(map.lower_bound(1), map.end());
+  EXPECT_EQ(map.erase(1), 0);
+  EXPECT_THROW((void)map.at(1), std::out_of_range);
+  EXPECT_THROW(map.erase(map.end()), std::out_of_range);
+  EXPECT_EQ(map.scan(0, 10, [](int, const std::string &) {}), 0);
+}
+
+TEST_F(TreeMapTest, InsertFindAndAssign) {
+  EXPECT_TRUE(map.insert(2, "b").second);
+  EXPECT_FALSE(map.insert(2, "x").second);
+  EXPECT_TRUE(map.emplace(1, 3, 'a').second);
+  EXPECT_FALSE(map.insert_or_assign(2, "bb"));
+  EXPECT_TRUE(map.insert_or_assign(3, "c"));
+  map[4] = "d";
+  EXPECT_EQ(map.size(), 4);
+  EXPECT_EQ(map.at(1), "aaa");
+  EXPECT_EQ(map.at(2), "bb");
+  EXPECT_EQ(map.find(4)->second, "d");
+  EXPECT_TRUE(map.contains(3));
+  EXPECT_FALSE(map.contains(5));
+
+  TreeMap<int, int> ordered{{3, 30}, {1, 10}, {2, 20}, {1, 99}};
+  EXPECT_EQ(ordered.size(), 3);
+  EXPECT_EQ(ordered.at(1), 10);
+  TreeMap<int, int> assigned = {{5, 50}, {4, 40}};
+  EXPECT_EQ(assigned.begin()->first, 4);
+}
+
+TEST_F(TreeMapTest, BoundsAcrossLeaves) {
+  TreeMap<int, int> tree;
+  for (int key = 0; key < 10000; key += 2) {
+    tree.insert(key, key);
+  }
+  EXPECT_GT(tree.height(), 2);
+  for (int key = -1; key < 10001; ++key) {
+    const int lower = key < 0 ? 0 : (key + 1) / 2 * 2;
+    const int upper = key < 0 ? 0 : key / 2 * 2 + 2;
+    const auto lo = tree.lower_bound(key);
+    const auto up = tree.upper_bound(key);
+    if (lower >= 10000) {
+      ASSERT_EQ(lo, tree.end());
+    } else {
+      ASSERT_EQ(lo->first, lower);
+    }
+    if (upper >= 10000) {
+      ASSERT_EQ(up, tree.end());
+    } else {
+      ASSERT_EQ(up->first, upper);
+    }
+  }
+}
+
+TEST_F(TreeMapTest, ScanVisitsHalfOpenRange) {
+  TreeMap<int, int> tree;
+  for (int key = 0; key < 5000; ++key) {
+    tree.insert(key * 3, key);
+  }
+  long sum = 0;
+  int previous = -1;
+  const auto visited = tree.scan(100, 4000, [&](int key, int value) {
+    EXPECT_GT(key, previous);
+    previous = key;
+    sum += value;
+  });
+  // Keys 102, 105, ..., 3999 are the values 34 to 1333.
+  EXPECT_EQ(visited, 1300);
+  EXPECT_EQ(sum, (34L + 1333L) * 1300 / 2);
+  EXPECT_EQ(tree.scan(15000, 20000, [](int, int) {}), 0);
+  EXPECT_EQ(tree.scan(50, 50, [](int, int) {}), 0);
+}
+
+// Erase Tests
+TEST_F(TreeMapTest, RandomOperationsMatchStdMap) {
+  TreeMap<int, int> tree;
+  std::map<int, int> reference;
+  std::mt19937 rng(11);
+  for (int step = 0; step < 200000; ++step) {
+    const int key = static_cast<int>(rng() % 4000);
+    // Phases of mostly inserts and mostly erases grow and shrink the tree
+    // through several heights.
+    const bool growing = (step / 20000) % 2 == 0;
+    if (rng() % 10 < (growing ? 3U : 7U)) {
+      ASSERT_EQ(tree.erase(key), reference.erase(key));
+    } else {
+      tree.insert_or_assign(key, step);
+      reference[key] = step;
+    }
+  }
+  expect_same(tree, reference);
+}
+
+TEST_F(TreeMapTest, EraseIteratorReturnsNext) {
+  TreeMap<int, int> tree;
+  std::map<int, int> reference;
+  for (int key = 0; key < 3000; ++key) {
+    tree.insert(key, key);
+    reference.emplace(key, key);
+  }
+  for (auto it = tree.begin(); it != tree.end();) {
+    if (it->first % 3 != 0) {
+      const int next = it->first + 1;
+      it = tree.erase(it);
+      reference.erase(next - 1);
+      if (it != tree.end()) {
+        ASSERT_EQ(it->first, next);
+      }
+    } else {
+      ++it;
+    }
+  }
+  expect_same(tree, reference);
+  while (!tree.is_empty()) {
+    tree.erase(tree.begin());
+  }
+  EXPECT_EQ(tree.height(), 0);
+  EXPECT_EQ(tree.begin(), tree.end());
+}
+
+TEST_F(TreeMapTest, StringKeysShiftSafely) {
+  TreeMap<std::string, std::string> tree;
+  std::map<std::string, std::string> reference;
+  std::mt19937 rng(3);
+  for (int step = 0; step < 20000; ++step) {
+    std::string key = "key-" + std::to_string(rng() % 2000) +
+                      std::string(20, 'x');
+    if (rng() % 3 == 0) {
+      ASSERT_EQ(tree.erase(key), reference.erase(key));
+    } else {
+      tree.insert_or_assign(key, std::to_string(step));
+      reference[key] = std::to_string(step);
+    }
+  }
+  expect_same(tree, reference);
+}
+
+TEST_F(TreeMapTest, ShiftingEntriesNeverCopiesKeys) {
+  TreeMap<CopyCountedKey, std::string> tree;
+  for (int key = 10; key < 15; ++key) {
+    tree.insert(CopyCountedKey(key), std::to_string(key));
+  }
+  CopyCountedKey::copies = 0;
+  EXPECT_TRUE(tree.emplace(CopyCountedKey(5), "5").second);
+  EXPECT_EQ(CopyCountedKey::copies, 1); // the new entry, no shifted ones
+  EXPECT_EQ(tree.erase(CopyCountedKey(10)), 1u);
+  EXPECT_EQ(CopyCountedKey::copies, 1);
+  std::vector<int> keys;
+  for (const auto &[key, value] : tree) {
+    keys.push_back(key.value);
+    EXPECT_EQ(value, std::to_string(key.value));
+  }
+  EXPECT_EQ(keys, (std::vector<int>{5, 11, 12, 13, 14}));
+}
+
+// Bulk Load Tests
+TEST_F(TreeMapTest, AssignSortedBuildsBalancedTree) {
+  std::vector<std::pair<int, int>> sorted;
+  std::map<int, int> reference;
+  for (int key = 0; key < 100000; ++key) {
+    sorted.emplace_back(key * 2, key);
+    reference.emplace(key * 2, key);
+  }
+  TreeMap<int, int> tree;
+  tree.insert(-5, 0);
+  tree.assign_sorted(sorted.begin(), sorted.end());
+  expect_same(tree, reference);
+
+  // Every node is close to full, so the tree is as shallow as possible.
+  std::size_t capacity = TreeMap<int, int>::leaf_slots;
+  std::size_t levels = 1;
+  while (capacity < sorted.size()) {
+    capacity *= TreeMap<int, int>::inner_slots + 1;
+    ++levels;
+  }
+  EXPECT_EQ(tree.height(), levels);
+
+  // The loaded tree keeps working under updates.
+  for (int key = 1; key < 200000; key += 20) {
+    tree.insert(key, key);
+    reference.emplace(key, key);
+  }
+  for (int key = 0; key < 200000; key += 6) {
+    tree.erase(key);
+    reference.erase(key);
+  }
+  expect_same(tree, reference);
+
+  std::vector<std::pair<int, int>> unsorted{{1, 1}, {3, 3}, {2, 2}};
+  EXPECT_THROW(tree.assign_sorted(unsorted.begin(), unsorted.end()),
+               std::invalid_argument);
+  EXPECT_EQ(tree.size(), reference.size());
+}
+
+// Copy and Move Tests
+TEST_F(TreeMapTest, CopyMoveAndClear) {
+  for (int key = 0; key < 1000; ++key) {
+    map.insert(key, std::to_string(key));
+  }
+  TreeMap<int, std::string> copy(map);
+  copy[5] = "five";
+  EXPECT_EQ(map.at(5), "5");
+  TreeMap<int, std::string> moved(std::move(map));
+  EXPECT_TRUE(map.is_empty());
+  EXPECT_EQ(moved.size(), 1000);
+  map = copy;
+  EXPECT_EQ(map.at(5), "five");
+  EXPECT_EQ(map.height(), copy.height());
+  map.clear();
+  EXPECT_TRUE(map.is_empty());
+  EXPECT_FALSE(map.contains(5));
+  map.insert(7, "seven");
+  EXPECT_EQ(map.size(), 1);
+}
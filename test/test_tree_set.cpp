@@ -0,0 +1,117 @@
+#include "../include/TreeSet.hpp"
+#include <gtest/gtest.h>
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+// Test fixture for TreeSet
+class TreeSetTest : public ::testing::Test {
+protected:
+  TreeSet<int> int_set;
+  TreeSet<std::string> string_set;
+
+  template <typename SetType>
+  static auto keys(const SetType &set)
+      -> std::vector<typename SetType::value_type> {
+    return {set.begin(), set.end()};
+  }
+};
+
+// Basic Operation Tests
+TEST_F(TreeSetTest, InsertFindAndErase) {
+  EXPECT_TRUE(int_set.is_empty());
+  EXPECT_TRUE(int_set.insert(3).second);
+  EXPECT_FALSE(int_set.insert(3).second);
+  EXPECT_TRUE(int_set.emplace(1).second);
+  EXPECT_EQ(*int_set.insert(2).first, 2);
+  EXPECT_EQ(keys(int_set), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(*int_set.find(2), 2);
+  EXPECT_EQ(int_set.find(4), int_set.end());
+  EXPECT_EQ(int_set.erase(2), 1);
+  EXPECT_EQ(int_set.erase(2), 0);
+  EXPECT_FALSE(int_set.contains(2));
+
+  TreeSet<int> list{5, 1, 5, 3};
+  EXPECT_EQ(keys(list), (std::vector<int>{1, 3, 5}));
+}
+
+TEST_F(TreeSetTest, CustomOrdering) {
+  TreeSet<int, std::greater<int>> descending;
+  for (int key = 0; key < 1000; ++key) {
+    descending.insert(key);
+  }
+  EXPECT_EQ(*descending.begin(), 999);
+  EXPECT_EQ(*descending.lower_bound(500), 500);
+  EXPECT_EQ(*descending.upper_bound(500), 499);
+  EXPECT_EQ(descending.scan(10, 0, [](int) {}), 10);
+}
+
+TEST_F(TreeSetTest, RandomOperationsMatchStdSet) {
+  std::set<int> reference;
+  std::mt19937 rng(7);
+  for (int step = 0; step < 200000; ++step) {
+    const int key = static_cast<int>(rng() % 10000);
+    const bool growing = (step / 25000) % 2 == 0;
+    if (rng() % 10 < (growing ? 3U : 7U)) {
+      ASSERT_EQ(int_set.erase(key), reference.erase(key));
+    } else {
+      ASSERT_EQ(int_set.insert(key).second, reference.insert(key).second);
+    }
+  }
+  EXPECT_EQ(int_set.size(), reference.size());
+  EXPECT_EQ(keys(int_set), std::vector<int>(reference.begin(),
+                                            reference.end()));
+  for (int key = 0; key < 10000; key += 7) {
+    const auto it = reference.lower_bound(key);
+    const auto found = int_set.lower_bound(key);
+    ASSERT_EQ(found == int_set.end(), it == reference.end());
+    if (it != reference.end()) {
+      ASSERT_EQ(*found, *it);
+    }
+  }
+}
+
+TEST_F(TreeSetTest, ScanAndBulkLoadStrings) {
+  std::vector<std::string> sorted;
+  for (int i = 0; i < 5000; ++i) {
+    sorted.push_back("k" + std::to_string(10000 + i));
+  }
+  string_set.insert("zzz");
+  string_set.assign_sorted(sorted.begin(), sorted.end());
+  EXPECT_EQ(string_set.size(), 5000);
+  EXPECT_FALSE(string_set.contains("zzz"));
+  EXPECT_EQ(keys(string_set), sorted);
+
+  std::vector<std::string> visited;
+  const auto count =
+      string_set.scan("k10100", "k10200",
+                      [&](const std::string &key) { visited.push_back(key); });
+  EXPECT_EQ(count, 100);
+  EXPECT_EQ(visited.front(), "k10100");
+  EXPECT_EQ(visited.back(), "k10199");
+
+  std::vector<std::string> duplicate{"a", "b", "b"};
+  EXPECT_THROW(string_set.assign_sorted(duplicate.begin(), duplicate.end()),
+               std::invalid_argument);
+  EXPECT_EQ(string_set.size(), 5000);
+}
+
+TEST_F(TreeSetTest, EraseAllThroughIterators) {
+  for (int key = 0; key < 5000; ++key) {
+    int_set.insert(key);
+  }
+  TreeSet<int> copy(int_set);
+  auto it = int_set.begin();
+  for (int expected = 0; it != int_set.end(); ++expected) {
+    ASSERT_EQ(*it, expected);
+    it = int_set.erase(it);
+  }
+  EXPECT_TRUE(int_set.is_empty());
+  EXPECT_EQ(int_set.height(), 0);
+  EXPECT_EQ(copy.size(), 5000);
+  int_set = std::move(copy);
+  EXPECT_EQ(int_set.size(), 5000);
+  EXPECT_EQ(*--int_set.end(), 4999);
+}
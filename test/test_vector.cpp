@@ -0,0 +1,298 @@
+#include "../include/Vector.hpp"
+#include <gtest/gtest.h>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+// Counts live instances and can be told to throw on the n-th copy.
+struct Counted {
+  static inline int live = 0;
+  static inline int copies_until_throw = -1;
+  int value{0};
+
+  Counted(int v = 0) : value(v) { ++live; }
+  Counted(const Counted &other) : value(other.value) {
+    if (copies_until_throw == 0) {
+      throw std::runtime_error("copy failed");
+    }
+    if (copies_until_throw > 0) {
+      --copies_until_throw;
+    }
+    ++live;
+  }
+  Counted(Counted &&other) noexcept : value(other.value) { ++live; }
+  auto operator=(const Counted &) -> Counted & = default;
+  auto operator=(Counted &&) noexcept -> Counted & = default;
+  ~Counted() { --live; }
+};
+
+template <typename VectorType>
+auto values(const VectorType &vector) -> std::vector<int> {
+  std::vector<int> result;
+  for (const auto &element : vector) {
+    result.push_back(static_cast<int>(element));
+  }
+  return result;
+}
+} // namespace
+
+// Test fixture for Vector
+class VectorTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    Counted::live = 0;
+    Counted::copies_until_throw = -1;
+  }
+  void TearDown() override { EXPECT_EQ(Counted::live, 0); }
+
+  Vector<int> int_vector;
+  Vector<std::string> string_vector;
+};
+
+// Construction Tests
+TEST_F(VectorTest, DefaultConstructorCreatesEmptyVector) {
+  EXPECT_TRUE(int_vector.empty());
+  EXPECT_EQ(int_vector.size(), 0);
+  EXPECT_EQ(int_vector.capacity(), 0);
+  EXPECT_EQ(int_vector.begin(), int_vector.end());
+}
+
+TEST_F(VectorTest, CountAndRangeConstructors) {
+  Vector<int> zeros(3);
+  EXPECT_EQ(values(zeros), (std::vector<int>{0, 0, 0}));
+  Vector<int> sevens(2, 7);
+  EXPECT_EQ(values(sevens), (std::vector<int>{7, 7}));
+
+  std::list<int> source{1, 2, 3};
+  Vector<int> ranged(source.begin(), source.end());
+  EXPECT_EQ(values(ranged), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(ranged.capacity(), 3);
+}
+
+TEST_F(VectorTest, CopyAndMove) {
+  Vector<std::string> original{"a", "b"};
+  Vector<std::string> copy(original);
+  copy.push_back("c");
+  EXPECT_EQ(original.size(), 2);
+  EXPECT_EQ(copy.back(), "c");
+
+  Vector<std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 3);
+
+  original = moved;
+  EXPECT_EQ(original.size(), 3);
+  moved = std::move(original);
+  EXPECT_EQ(moved[2], "c");
+}
+
+// Element Access Tests
+TEST_F(VectorTest, AccessThrowsWhenOutOfRange) {
+  EXPECT_THROW((void)int_vector[0], std::out_of_range);
+  EXPECT_THROW((void)int_vector.front(), std::out_of_range);
+  EXPECT_THROW((void)int_vector.back(), std::out_of_range);
+  EXPECT_THROW(int_vector.pop_back(), std::out_of_range);
+  int_vector.push_back(4);
+  EXPECT_EQ(int_vector[0], 4);
+  EXPECT_EQ(*int_vector.data(), 4);
+}
+
+// Growth Tests
+TEST_F(VectorTest, GrowthPolicyControlsCapacity) {
+  Vector<int, DoublingGrowth> doubling;
+  Vector<int, GoldenGrowth> golden;
+  std::vector<size_t> doubling_caps;
+  std::vector<size_t> golden_caps;
+  for (int i = 0; i < 10; ++i) {
+    doubling.push_back(i);
+    golden.push_back(i);
+    if (doubling_caps.empty() || doubling_caps.back() != doubling.capacity()) {
+      doubling_caps.push_back(doubling.capacity());
+    }
+    if (golden_caps.empty() || golden_caps.back() != golden.capacity()) {
+      golden_caps.push_back(golden.capacity());
+    }
+  }
+  EXPECT_EQ(doubling_caps, (std::vector<size_t>{1, 2, 4, 8, 16}));
+  EXPECT_EQ(golden_caps, (std::vector<size_t>{1, 2, 3, 4, 6, 9, 13}));
+}
+
+TEST_F(VectorTest, ReserveAndShrinkToFit) {
+  int_vector.reserve(100);
+  EXPECT_EQ(int_vector.capacity(), 100);
+  int_vector.reserve(10);
+  EXPECT_EQ(int_vector.capacity(), 100);
+  int_vector.push_back(1);
+  int_vector.push_back(2);
+  int_vector.shrink_to_fit();
+  EXPECT_EQ(int_vector.capacity(), 2);
+  EXPECT_EQ(values(int_vector), (std::vector<int>{1, 2}));
+  int_vector.clear();
+  int_vector.shrink_to_fit();
+  EXPECT_EQ(int_vector.capacity(), 0);
+}
+
+TEST_F(VectorTest, PushBackOfOwnElementSurvivesGrowth) {
+  int_vector.push_back(42);
+  for (int i = 0; i < 10; ++i) {
+    int_vector.push_back(int_vector[0]);
+  }
+  string_vector.push_back("self");
+  for (int i = 0; i < 10; ++i) {
+    string_vector.push_back(string_vector.front());
+  }
+  EXPECT_EQ(int_vector.back(), 42);
+  EXPECT_EQ(string_vector.back(), "self");
+}
+
+TEST_F(VectorTest, GrowthCopiesWhenMoveMayThrow) {
+  struct ThrowingMove {
+    std::string value;
+    ThrowingMove(std::string v) : value(std::move(v)) {}
+    ThrowingMove(const ThrowingMove &) = default;
+    ThrowingMove(ThrowingMove &&other) noexcept(false)
+        : value(std::move(other.value)) {}
+  };
+  Vector<ThrowingMove> vector;
+  vector.emplace_back("a");
+  vector.emplace_back("b");
+  vector.emplace_back("c");
+  EXPECT_EQ(vector[0].value, "a");
+  EXPECT_EQ(vector[2].value, "c");
+}
+
+TEST_F(VectorTest, FailedGrowthLeavesVectorIntact) {
+  Vector<Counted> vector;
+  vector.emplace_back(1);
+  vector.emplace_back(2);
+  Counted extra(3);
+  Counted::copies_until_throw = 0;
+  EXPECT_THROW(vector.push_back(extra), std::runtime_error);
+  Counted::copies_until_throw = -1;
+  EXPECT_EQ(vector.size(), 2);
+  EXPECT_EQ(vector[1].value, 2);
+}
+
+// Insertion Tests
+TEST_F(VectorTest, RangeInsertAllocatesOnce) {
+  int_vector = {1, 5};
+  std::vector<int> middle{2, 3, 4};
+  auto it = int_vector.insert(int_vector.begin() + 1, middle.begin(),
+                              middle.end());
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(values(int_vector), (std::vector<int>{1, 2, 3, 4, 5}));
+  EXPECT_EQ(int_vector.capacity(), 5);
+
+  int_vector.reserve(10);
+  int_vector.insert(int_vector.begin(), {-1, 0});
+  EXPECT_EQ(values(int_vector), (std::vector<int>{-1, 0, 1, 2, 3, 4, 5}));
+  EXPECT_EQ(int_vector.capacity(), 10);
+}
+
+TEST_F(VectorTest, RangeInsertOfNonTrivialType) {
+  string_vector = {"a", "e"};
+  std::vector<std::string> middle{"b", "c", "d"};
+  string_vector.insert(string_vector.begin() + 1, middle.begin(), middle.end());
+  string_vector.reserve(10);
+  string_vector.insert(string_vector.end() - 1, middle.begin(), middle.end());
+  EXPECT_EQ(std::vector<std::string>(string_vector.begin(), string_vector.end()),
+            (std::vector<std::string>{"a", "b", "c", "d", "b", "c", "d", "e"}));
+}
+
+TEST_F(VectorTest, RangeInsertFromInputIterators) {
+  std::istringstream input("3 4 5");
+  int_vector = {1, 2, 6};
+  int_vector.insert(int_vector.begin() + 2, std::istream_iterator<int>(input),
+                    std::istream_iterator<int>());
+  EXPECT_EQ(values(int_vector), (std::vector<int>{1, 2, 3, 4, 5, 6}));
+}
+
+TEST_F(VectorTest, FailedRangeInsertLeavesVectorIntact) {
+  Vector<Counted> vector;
+  vector.emplace_back(1);
+  vector.emplace_back(4);
+  std::vector<Counted> middle{2, 3};
+  Counted::copies_until_throw = 1;
+  EXPECT_THROW(vector.insert(vector.begin() + 1, middle.begin(), middle.end()),
+               std::runtime_error);
+  Counted::copies_until_throw = -1;
+  ASSERT_EQ(vector.size(), 2);
+  EXPECT_EQ(vector[0].value, 1);
+  EXPECT_EQ(vector[1].value, 4);
+}
+
+TEST_F(VectorTest, EmplaceAndInsertSingleElement) {
+  int_vector = {1, 3};
+  EXPECT_EQ(*int_vector.insert(int_vector.begin() + 1, 2), 2);
+  EXPECT_EQ(*int_vector.emplace(int_vector.begin(), 0), 0);
+  EXPECT_EQ(values(int_vector), (std::vector<int>{0, 1, 2, 3}));
+
+  string_vector = {"b"};
+  string_vector.emplace(string_vector.begin(), 1, 'a');
+  string_vector.insert(string_vector.end(), std::string("c"));
+  EXPECT_EQ(std::vector<std::string>(string_vector.begin(), string_vector.end()),
+            (std::vector<std::string>{"a", "b", "c"}));
+  EXPECT_THROW(int_vector.insert(Vector<int>::iterator(nullptr), 1),
+               std::out_of_range);
+}
+
+// Erase and Resize Tests
+TEST_F(VectorTest, EraseElementsAndRanges) {
+  int_vector = {0, 1, 2, 3, 4, 5};
+  auto it = int_vector.erase(int_vector.begin() + 1);
+  EXPECT_EQ(*it, 2);
+  it = int_vector.erase(int_vector.begin() + 1, int_vector.begin() + 3);
+  EXPECT_EQ(*it, 4);
+  EXPECT_EQ(values(int_vector), (std::vector<int>{0, 4, 5}));
+  EXPECT_THROW(int_vector.erase(int_vector.end()), std::out_of_range);
+}
+
+TEST_F(VectorTest, ResizeGrowsAndShrinks) {
+  Vector<Counted> vector;
+  vector.resize(3);
+  EXPECT_EQ(Counted::live, 3);
+  vector.resize(5, Counted(9));
+  EXPECT_EQ(vector[4].value, 9);
+  vector.resize(1);
+  EXPECT_EQ(Counted::live, 1);
+}
+
+TEST_F(VectorTest, RepeatedResizeGrowsGeometrically) {
+  Vector<int> vector(3); // the count constructor allocates exactly
+  EXPECT_EQ(vector.capacity(), 3u);
+  int reallocations = 0;
+  for (std::size_t count = 4; count <= 1'000; ++count) {
+    const std::size_t capacity = vector.capacity();
+    vector.resize(count);
+    reallocations += vector.capacity() != capacity ? 1 : 0;
+  }
+  EXPECT_LE(reallocations, 10);
+
+  Vector<std::string> strings(1, std::string(32, 'x'));
+  strings.resize(10, strings[0]); // the value aliases an element
+  EXPECT_EQ(strings[9], std::string(32, 'x'));
+}
+
+TEST_F(VectorTest, MoveOnlyElementsAreSupported) {
+  Vector<std::unique_ptr<int>> vector;
+  for (int i = 0; i < 5; ++i) {
+    vector.push_back(std::make_unique<int>(i));
+  }
+  vector.emplace(vector.begin(), new int(-1));
+  vector.erase(vector.begin() + 1);
+  EXPECT_EQ(*vector.front(), -1);
+  EXPECT_EQ(*vector.back(), 4);
+  EXPECT_EQ(vector.size(), 5);
+}
+
+TEST_F(VectorTest, IteratorsAreRandomAccess) {
+  int_vector = {5, 3, 1, 4, 2};
+  std::sort(int_vector.begin(), int_vector.end());
+  EXPECT_EQ(values(int_vector), (std::vector<int>{1, 2, 3, 4, 5}));
+  EXPECT_EQ(int_vector.end() - int_vector.begin(), 5);
+  EXPECT_EQ(int_vector.cbegin()[2], 3);
+  EXPECT_TRUE(int_vector.begin() < int_vector.end());
+}
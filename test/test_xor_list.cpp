@@ -0,0 +1,126 @@
+#include "../include/XorList.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Test fixture for XorList
+class XorListTest : public ::testing::Test {
+protected:
+  XorList<int> int_list;
+  XorList<std::string> string_list;
+
+  template <typename List> static auto forward(const List &list) {
+    return std::vector<typename List::value_type>(list.begin(), list.end());
+  }
+
+  template <typename List> static auto backward(const List &list) {
+    std::vector<typename List::value_type> values;
+    for (auto it = list.end(); it != list.begin();) {
+      values.push_back(*--it);
+    }
+    return values;
+  }
+};
+
+// Construction Tests
+TEST_F(XorListTest, DefaultConstructorCreatesEmptyList) {
+  EXPECT_TRUE(int_list.is_empty());
+  EXPECT_EQ(int_list.size(), 0);
+  EXPECT_EQ(int_list.begin(), int_list.end());
+  EXPECT_THROW((void)int_list.top(), std::out_of_range);
+  EXPECT_THROW((void)int_list.bottom(), std::out_of_range);
+}
+
+TEST_F(XorListTest, InitializerListKeepsOrder) {
+  XorList<int> list{1, 2, 3};
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(list.top(), 1);
+  EXPECT_EQ(list.bottom(), 3);
+  EXPECT_EQ(forward(list), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(backward(list), (std::vector<int>{3, 2, 1}));
+}
+
+TEST_F(XorListTest, CopyAndMove) {
+  XorList<int> list{1, 2, 3};
+  XorList<int> copy(list);
+  copy.remove_front();
+  EXPECT_EQ(forward(list), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(forward(copy), (std::vector<int>{2, 3}));
+
+  XorList<int> moved(std::move(copy));
+  EXPECT_TRUE(copy.is_empty());
+  EXPECT_EQ(backward(moved), (std::vector<int>{3, 2}));
+
+  moved = list;
+  EXPECT_EQ(forward(moved), (std::vector<int>{1, 2, 3}));
+  list = std::move(moved);
+  EXPECT_EQ(list.size(), 3);
+}
+
+// Modifier Tests
+TEST_F(XorListTest, AddAndRemoveAtBothEnds) {
+  string_list.add_back("c");
+  string_list.add_front("b");
+  string_list.add_front(std::string("a"));
+  EXPECT_EQ(string_list.emplace_back(2, 'd'), "dd");
+  EXPECT_EQ(forward(string_list),
+            (std::vector<std::string>{"a", "b", "c", "dd"}));
+
+  string_list.remove_back();
+  string_list.remove_front();
+  EXPECT_EQ(forward(string_list), (std::vector<std::string>{"b", "c"}));
+  EXPECT_EQ(backward(string_list), (std::vector<std::string>{"c", "b"}));
+
+  string_list.remove_front();
+  string_list.remove_back();
+  EXPECT_TRUE(string_list.is_empty());
+  EXPECT_THROW(string_list.remove_front(), std::out_of_range);
+  EXPECT_THROW(string_list.remove_back(), std::out_of_range);
+
+  string_list.add_back("again");
+  EXPECT_EQ(string_list.top(), "again");
+  EXPECT_EQ(string_list.bottom(), "again");
+}
+
+TEST_F(XorListTest, ReverseSwapsEnds) {
+  XorList<int> list{1, 2, 3, 4};
+  list.reverse();
+  EXPECT_EQ(forward(list), (std::vector<int>{4, 3, 2, 1}));
+  list.add_back(0);
+  list.add_front(5);
+  EXPECT_EQ(forward(list), (std::vector<int>{5, 4, 3, 2, 1, 0}));
+  EXPECT_EQ(backward(list), (std::vector<int>{0, 1, 2, 3, 4, 5}));
+}
+
+TEST_F(XorListTest, IteratorsWalkBothWays) {
+  XorList<int> list{1, 2, 3};
+  auto it = list.begin();
+  EXPECT_EQ(*it++, 1);
+  EXPECT_EQ(*it, 2);
+  *it = 20;
+  EXPECT_EQ(*++it, 3);
+  EXPECT_EQ(*--it, 20);
+  EXPECT_EQ(*it--, 20);
+  EXPECT_EQ(it, list.begin());
+  EXPECT_EQ(*std::prev(list.cend()), 3);
+}
+
+TEST_F(XorListTest, MoveOnlyElementsAreSupported) {
+  XorList<std::unique_ptr<int>> list;
+  list.add_back(std::make_unique<int>(2));
+  list.emplace_front(new int(1));
+  EXPECT_EQ(*list.top(), 1);
+  EXPECT_EQ(*list.bottom(), 2);
+}
+
+TEST_F(XorListTest, QueueUsageMatchesOrder) {
+  for (int i = 0; i < 1000; ++i) {
+    int_list.add_back(i);
+  }
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(int_list.top(), i);
+    int_list.remove_front();
+  }
+  EXPECT_TRUE(int_list.is_empty());
+}